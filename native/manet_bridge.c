@@ -3,12 +3,39 @@
 #include <stdint.h>
 #include <string.h>
 #include <stdio.h>
+#include <float.h>
 
 #if !defined(MINIAUDIO_IMPLEMENTATION)
 #define MINIAUDIO_IMPLEMENTATION
 #endif
 #include "miniaudio.h"
 
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/* Kernels for the dynamics nodes. SSE2 is the x86 baseline; AVX2 is compiled per function and chosen at runtime;
+   the NEON kernels need AArch64 for vector division and round-to-nearest conversion. */
+#if (defined(MA_X64) || defined(MA_X86)) && defined(MA_SUPPORT_SSE2)
+#define MANET_SIMD_SSE2
+#endif
+
+#if (defined(MA_X64) || defined(MA_X86)) && (defined(__GNUC__) || defined(__clang__)) && !defined(MA_NO_AVX2)
+#include <immintrin.h>
+#define MANET_SIMD_AVX2
+#define MANET_TARGET_AVX2 __attribute__((target("avx2")))
+#elif defined(MA_SUPPORT_AVX2)
+#define MANET_SIMD_AVX2
+#define MANET_TARGET_AVX2
+#endif
+
+#if defined(MA_SUPPORT_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#define MANET_SIMD_NEON
+#endif
+
 #if defined(_WIN32)
 #define MANET_API __declspec(dllexport)
 #else
@@ -19,8 +46,287 @@ typedef struct manet_context {
     ma_context context;
 } manet_context;
 
+/* Asset registered with a resource manager under a name. miniaudio does not copy registered data, so the bytes
+   (encoded file contents or interleaved f32 PCM) live here; the registry and every sound created from the name
+   each hold a reference. */
+typedef struct manet_registered_data {
+    struct manet_registered_data* next;
+    ma_atomic_uint32 refCount;
+    char* name;
+    void* data;
+    size_t sizeInBytes;
+    /* Registered as encoded bytes rather than decoded frames. */
+    ma_bool32 isEncoded;
+    /* Read-only file mapping backing data (decoded disk cache); unmapped on the last release. */
+    const ma_uint8* mapping;
+    ma_uint64 mappingSize;
+    /* Set for decoded-cache entries, which are unregistered again when the last sound using them is destroyed. */
+    struct manet_data_registry* cacheRegistry;
+} manet_registered_data;
+
+/* Remembers which encoded content a source file held when it was last hashed for the decoded disk cache, so
+   unchanged files (same size and modification time) are not read and hashed again on every load. */
+typedef struct manet_decoded_cache_key {
+    struct manet_decoded_cache_key* next;
+    ma_uint64 sourceSize;
+    ma_uint64 sourceTime;
+    ma_uint64 contentHash;
+    ma_uint64 contentSize;
+    char* path;
+} manet_decoded_cache_key;
+
+/* Name registry for one ma_resource_manager. It is owned by the manet_resource_manager wrapper when the engine was
+   created with one, otherwise by the engine itself, so every engine sharing a resource manager sees the same names. */
+typedef struct manet_data_registry {
+    ma_mutex lock;
+    ma_resource_manager* resourceManager;
+    manet_registered_data* head;
+    /* One small entry per distinct path loaded through the decoded cache; freed with the registry. */
+    manet_decoded_cache_key* cacheKeys;
+} manet_data_registry;
+
+/* Decoded-asset cache for one ma_resource_manager. Each entry is an extra data buffer on a resource-manager node,
+   which keeps the node resident after the last sound using it is destroyed. Entries are kept in LRU order (head is
+   the most recently used) and are only retained while a memory budget is set. The cache keeps a running total of
+   the bytes its entries hold; when that total exceeds the budget, entries whose node is referenced by nothing else
+   are released from the tail. Entries are also chained into a hash index keyed by the node's name hash, so a load
+   finds its entry without walking the list. Nodes still loading (async or paged decodes) grow after the entry is
+   added; they stay unsettled and are re-measured on each trim until their load finishes. */
+typedef struct manet_cache_entry {
+    struct manet_cache_entry* prev;
+    struct manet_cache_entry* next;
+    struct manet_cache_entry* indexNext;
+    ma_uint64 sizeInBytes;
+    ma_bool32 isSettled;
+    ma_resource_manager_data_buffer buffer;
+} manet_cache_entry;
+
+typedef struct manet_resource_cache {
+    ma_mutex lock;
+    ma_resource_manager* resourceManager;
+    ma_uint64 budgetInBytes;
+    manet_cache_entry* head;
+    manet_cache_entry* tail;
+    manet_cache_entry** index;
+    ma_uint32 indexCapacity;
+    ma_uint32 entryCount;
+    ma_uint32 unsettledCount;
+    ma_uint64 entryBytes;
+    ma_atomic_uint64 hits;
+    ma_atomic_uint64 misses;
+    ma_atomic_uint64 evictions;
+} manet_resource_cache;
+
+typedef struct manet_resource_manager_stats {
+    ma_uint64 residentBytes;
+    ma_uint64 cachedBytes;
+    ma_uint64 budgetInBytes;
+    ma_uint64 cacheHits;
+    ma_uint64 cacheMisses;
+    ma_uint64 evictions;
+    ma_uint32 loadedBuffers;
+    ma_uint32 cachedBuffers;
+    ma_uint32 pendingJobs;
+} manet_resource_manager_stats;
+
+#define MANET_JOB_TYPE_SLOTS 16u
+#define MANET_JOB_HISTOGRAM_BUCKETS 20u
+
+/* Durations in microseconds on a log2 scale: bucket 0 counts anything below 2us, bucket i counts [2^i, 2^(i+1))us
+   and the last bucket also takes everything longer. */
+typedef struct manet_job_histogram {
+    ma_uint64 count;
+    ma_uint64 totalMicroseconds;
+    ma_uint64 maxMicroseconds;
+    ma_uint64 buckets[MANET_JOB_HISTOGRAM_BUCKETS];
+} manet_job_histogram;
+
+typedef struct manet_resource_manager_job_stats {
+    ma_uint64 queued[MANET_JOB_TYPE_SLOTS];
+    ma_uint64 completed[MANET_JOB_TYPE_SLOTS];
+    manet_job_histogram queueWait;
+    manet_job_histogram processing;
+    manet_job_histogram decode;
+    ma_uint64 streamRefills;
+    ma_uint64 streamRefillMisses;
+    ma_uint32 pendingJobs;
+    ma_uint32 workerCount;
+} manet_resource_manager_job_stats;
+
+typedef struct manet_queued_job {
+    ma_job job;
+    double enqueuedAt;
+} manet_queued_job;
+
+/* Decode time accumulated over the load and page jobs of one data buffer node that is still decoding. */
+typedef struct manet_decode_timing {
+    struct manet_decode_timing* next;
+    ma_resource_manager_data_buffer_node* node;
+    double seconds;
+} manet_decode_timing;
+
+/* Job threads run by the bridge in place of miniaudio's when job statistics are collected. miniaudio offers no hook on
+   job submission, so a dispatcher thread takes each job off the resource manager queue as soon as it is posted,
+   time-stamps it and hands it to the workers through a bounded ring. */
+typedef struct manet_job_monitor {
+    ma_resource_manager* resourceManager;
+    ma_timer timer;
+    ma_thread dispatcher;
+    ma_thread workers[MA_RESOURCE_MANAGER_MAX_JOB_THREAD_COUNT];
+    ma_uint32 workerCount;
+    ma_uint32 runningWorkers;
+    ma_bool32 isDispatcherRunning;
+    ma_semaphore filledSlots;
+    ma_semaphore freeSlots;
+    ma_mutex ringLock;
+    manet_queued_job* ring;
+    ma_uint32 capacity;
+    ma_uint32 head;
+    ma_uint32 count;
+    ma_bool32 isStopping;
+    ma_mutex statsLock;
+    manet_resource_manager_job_stats stats;
+    manet_decode_timing* decodes;
+} manet_job_monitor;
+
+typedef ma_result (*manet_vfs_open_proc)(void* userData, const char* path, ma_uint32 openMode, void** file);
+typedef ma_result (*manet_vfs_close_proc)(void* userData, void* file);
+typedef ma_result (*manet_vfs_read_proc)(void* userData, void* file, void* dst, size_t sizeInBytes, size_t* bytesRead);
+typedef ma_result (*manet_vfs_seek_proc)(void* userData, void* file, ma_int64 offset, ma_uint32 origin);
+typedef ma_result (*manet_vfs_tell_proc)(void* userData, void* file, ma_int64* cursor);
+typedef ma_result (*manet_vfs_size_proc)(void* userData, void* file, ma_uint64* sizeInBytes);
+
+/* Read-only file system supplied by the host. Paths are always passed as UTF-8. */
+typedef struct manet_vfs_config {
+    manet_vfs_open_proc onOpen;
+    manet_vfs_close_proc onClose;
+    manet_vfs_read_proc onRead;
+    manet_vfs_seek_proc onSeek;
+    manet_vfs_tell_proc onTell;
+    manet_vfs_size_proc onSize;
+    void* userData;
+} manet_vfs_config;
+
+/* Read-only pack of named assets, memory-mapped as a whole. Layout (little endian):
+     header  { char magic[8] = "MANETPAK"; u32 version = 1; u32 entryCount; }
+     records { u64 dataOffset; u64 dataSize; u32 nameOffset; u32 nameLength; } x entryCount
+   followed by the UTF-8 names and asset bytes at the offsets the records point to. */
+#define MANET_ASSET_PACK_MAGIC "MANETPAK"
+#define MANET_ASSET_PACK_VERSION 1u
+#define MANET_ASSET_PACK_HEADER_SIZE 16u
+#define MANET_ASSET_PACK_RECORD_SIZE 24u
+#define MANET_ASSET_PACK_PREFIX "pack://"
+
+/* Decoded PCM cache file: header { char magic[8] = "MANETPCM"; u32 version = 1; u32 format; u32 channels;
+   u32 sampleRate; u64 frameCount; } followed by interleaved frames. Files are named after a hash of the encoded
+   content and the target format, and registered under MANET_DECODED_CACHE_PREFIX + file name while mapped. */
+#define MANET_DECODED_CACHE_MAGIC "MANETPCM"
+#define MANET_DECODED_CACHE_VERSION 1u
+#define MANET_DECODED_CACHE_HEADER_SIZE 32u
+#define MANET_DECODED_CACHE_PREFIX "decoded-cache://"
+
+/* Decoded-cache key file, one per source path, so a new process can find a source's cache file without reading and
+   hashing it: header { char magic[8] = "MANETKEY"; u32 version = 1; u32 pathLength; u64 sourceSize; u64 sourceTime;
+   u64 contentHash; u64 contentSize; } followed by the UTF-8 source path. Named after a hash of the path. */
+#define MANET_DECODED_CACHE_KEY_MAGIC "MANETKEY"
+#define MANET_DECODED_CACHE_KEY_VERSION 1u
+#define MANET_DECODED_CACHE_KEY_HEADER_SIZE 48u
+
+typedef struct manet_asset_pack_entry {
+    const char* name; /* Points into the mapping; not NUL-terminated. */
+    ma_uint32 nameLength;
+    ma_uint64 offset;
+    ma_uint64 sizeInBytes;
+} manet_asset_pack_entry;
+
+/* Shared by the host handle and every resource manager using the pack, so the mapping outlives both. */
+typedef struct manet_asset_pack {
+    ma_atomic_uint32 refCount;
+    const ma_uint8* data;
+    ma_uint64 sizeInBytes;
+    manet_asset_pack_entry* entries; /* Sorted by name. */
+    ma_uint32 entryCount;
+} manet_asset_pack;
+
+/* Resolves "pack://" paths from the asset pack, everything else from the host file system when one was supplied
+   and from the default stdio VFS otherwise. */
+typedef struct manet_vfs {
+    ma_vfs_callbacks cb; /* Must be first so the struct can be passed as an ma_vfs. */
+    manet_vfs_config config;
+    ma_default_vfs defaultVfs;
+    manet_asset_pack* pack;
+} manet_vfs;
+
+typedef struct manet_vfs_file {
+    void* inner; /* Host or default VFS file; unused for pack entries. */
+    ma_bool32 isHostFile;
+    const ma_uint8* data; /* Start of the pack entry, NULL for other files. */
+    ma_uint64 sizeInBytes;
+    ma_uint64 cursor;
+} manet_vfs_file;
+
+#define MANET_METER_BLOCKS_PER_SECOND 10u
+#define MANET_METER_MOMENTARY_BLOCKS 4u
+#define MANET_METER_SHORT_TERM_BLOCKS 30u
+
+/* Published every 100 ms block. Peak and RMS cover the momentary window; the powers are the channel-weighted mean
+   squares of the K-weighted signal over the momentary (400 ms) and short-term (3 s) windows, i.e. loudness before
+   the -0.691 dB offset and log conversion. */
+typedef struct manet_meter_snapshot {
+    ma_uint64 framesProcessed;
+    ma_uint32 channels;
+    float momentaryPower;
+    float shortTermPower;
+    float peak[MA_MAX_CHANNELS];
+    float rms[MA_MAX_CHANNELS];
+} manet_meter_snapshot;
+
+typedef struct manet_meter_biquad {
+    double b0;
+    double b1;
+    double b2;
+    double a1;
+    double a2;
+} manet_meter_biquad;
+
+typedef struct manet_meter_channel {
+    double weight;
+    double shelfState[2];
+    double highPassState[2];
+    double blockWeighted;
+    double blockSquares;
+    float blockPeak;
+    double squareHistory[MANET_METER_MOMENTARY_BLOCKS];
+    float peakHistory[MANET_METER_MOMENTARY_BLOCKS];
+} manet_meter_channel;
+
+/* Output tap fed with every frame the engine delivers, from the device callback or Render. Everything except the
+   snapshot is owned by the audio thread; the snapshot is guarded by a sequence counter that is odd while a block is
+   being published, so readers retry instead of ever blocking the audio thread. */
+typedef struct manet_meter {
+    ma_uint32 channels;
+    ma_uint32 blockFrames;
+    ma_uint32 framesInBlock;
+    ma_uint32 blockIndex;
+    ma_uint64 framesProcessed;
+    manet_meter_biquad shelf;
+    manet_meter_biquad highPass;
+    manet_meter_channel* channelStates;
+    double blockPower[MANET_METER_SHORT_TERM_BLOCKS];
+    ma_uint32 sequence;
+    manet_meter_snapshot snapshot;
+} manet_meter;
+
 typedef struct manet_engine {
     ma_engine engine;
+    manet_data_registry ownRegistry;
+    manet_data_registry* registry;
+    /* Cache of the resource manager passed at creation; NULL when the engine owns its resource manager. */
+    manet_resource_cache* cache;
+    /* On-disk decoded PCM cache of that resource manager, NULL when disabled. */
+    const char* decodedCacheDirectory;
+    /* Output meter, NULL unless metering was enabled at creation. */
+    manet_meter* meter;
 } manet_engine;
 
 enum {
@@ -45,22 +351,270 @@ typedef enum manet_sound_state {
 
 typedef struct manet_pcm_stream manet_pcm_stream;
 typedef struct manet_sound manet_sound;
+
+/* Immutable, ref-counted interleaved f32 clip that any number of PCM sounds can reference without copying.
+   The sample data is allocated in the same block, directly after the header. */
+typedef struct manet_pcm_buffer {
+    ma_atomic_uint32 refCount;
+    ma_uint32 channels;
+    ma_uint32 sampleRate;
+    ma_uint64 frameCount;
+    float* data;
+} manet_pcm_buffer;
 typedef void (*manet_sound_end_proc)(manet_sound* handle, void* userData);
+typedef enum manet_pcm_stream_notification {
+    MANET_PCM_STREAM_NOTIFICATION_LOW_WATERMARK = 1,
+    MANET_PCM_STREAM_NOTIFICATION_WRITE_SPACE = 2
+} manet_pcm_stream_notification;
+
+/* Wakes a waiter thread on behalf of a real-time thread. The real-time side only ORs bits into pending and signals
+   the event; the waiter blocks in manet_signal_wait off the audio thread and takes every pending bit at once, so no
+   managed code ever runs on the real-time thread. Closing wakes the waiter for good. */
+typedef struct manet_signal {
+    ma_event event;
+    ma_atomic_uint32 pending;
+    ma_atomic_bool32 isClosed;
+} manet_signal;
+
+typedef struct manet_pcm_stream_stats {
+    ma_uint64 underrunCount;
+    ma_uint64 silenceFramesInserted;
+    ma_uint64 framesRead;
+    ma_uint64 framesWritten;
+    ma_uint64 minQueuedFrames;
+    ma_uint64 maxQueuedFrames;
+} manet_pcm_stream_stats;
+
+typedef void (*manet_sound_load_proc)(void* userData, ma_result result);
+
+enum {
+    MANET_SOUND_LOAD_PENDING = 0,
+    MANET_SOUND_LOAD_SIGNALED = 1,
+    MANET_SOUND_LOAD_ARMED = 2
+};
+
+/* Resource-manager "done" notification for an asynchronously loaded sound. miniaudio may signal it before
+   ma_sound_init_ex returns, so a signal that arrives while the sound is still PENDING is left for the creator to
+   deliver once initialisation has succeeded; after that (ARMED) the job thread delivers it directly. */
+typedef struct manet_sound_load_notification {
+    ma_async_notification_callbacks cb;
+    manet_sound* sound;
+    manet_sound_load_proc callback;
+    void* userData;
+    ma_atomic_uint32 state;
+} manet_sound_load_notification;
 
 struct manet_sound {
     ma_sound sound;
     manet_sound_state state;
+    /* Flags the sound was created with, reused when it is instanced. */
+    ma_uint32 initFlags;
     ma_bool32 ownsAudioBuffer;
     ma_audio_buffer audioBuffer;
+    /* Shared clip referenced by audioBuffer, released when the sound is destroyed. */
+    manet_pcm_buffer* sharedBuffer;
+    /* Registered asset this sound was loaded from, released when the sound is destroyed. */
+    manet_registered_data* registeredData;
+    /* Cache to trim once this sound no longer references its data buffer. */
+    manet_resource_cache* cache;
     manet_pcm_stream* stream;
     ma_bool32 isStreaming;
     /* Managed callback forwarding. */
     void* managedEndUserData;
     manet_sound_end_proc managedEndCallback;
+    manet_sound_load_notification loadNotification;
 };
 
+typedef enum manet_voice_steal_policy {
+    MANET_VOICE_STEAL_NONE = 0,
+    MANET_VOICE_STEAL_OLDEST = 1,
+    MANET_VOICE_STEAL_QUIETEST = 2
+} manet_voice_steal_policy;
+
+typedef struct manet_voice_pool manet_voice_pool;
+
+/* One pre-initialised slot of a voice pool. The slot is its own data source so a new clip can be swapped in without
+   re-initialising the ma_sound. The audio thread never blocks on a voice: it announces itself in readers while it
+   touches clip, and play unpublishes the old clip and waits for readers to drain before resetting the cursor.
+   Every play gets a fresh generation; activeGeneration is that value while the voice is busy and 0 when it is free,
+   so an end callback for a clip that was already stolen cannot free the voice again. */
+typedef struct manet_voice {
+    ma_data_source_base ds;
+    ma_uint32 channels;
+    ma_uint32 sampleRate;
+    manet_pcm_buffer* clip;
+    ma_atomic_uint64 cursor;
+    ma_atomic_uint32 readers;
+    ma_atomic_uint32 generation;
+    ma_atomic_uint32 activeGeneration;
+    /* Generation of the clip the last read reached the end of; only touched on the audio thread. */
+    ma_uint32 endedGeneration;
+    ma_sound sound;
+    ma_bool32 isSoundInitialized;
+    /* Trigger order and gain used by the steal policies; only touched with the pool lock held. */
+    ma_uint64 startSequence;
+    float volume;
+} manet_voice;
+
+/* Fixed set of voices for fire-and-forget one-shots. Voices are recycled when their end callback fires, so
+   triggering never allocates; when every voice is busy the steal policy picks one to cut off. */
+struct manet_voice_pool {
+    ma_mutex lock;
+    manet_voice* voices;
+    ma_uint32 capacity;
+    ma_uint32 channels;
+    ma_uint32 sampleRate;
+    manet_voice_steal_policy policy;
+    ma_uint64 nextSequence;
+    ma_atomic_uint64 playCount;
+    ma_atomic_uint64 stealCount;
+    ma_atomic_uint64 rejectCount;
+};
+
+/* Bus in the node graph. Sounds are routed into it through the node API, so its volume, pitch and pan are applied
+   once to their mix instead of per voice. */
+typedef struct manet_sound_group {
+    ma_sound_group group;
+} manet_sound_group;
+
+/* Copies its input to every output bus, e.g. to feed a dry and a wet path from the same group. */
+typedef struct manet_splitter {
+    ma_splitter_node node;
+} manet_splitter;
+
+typedef enum manet_effect_type {
+    MANET_EFFECT_LOW_PASS = 1,
+    MANET_EFFECT_HIGH_PASS = 2,
+    MANET_EFFECT_BIQUAD = 3,
+    MANET_EFFECT_PEAKING_EQ = 4,
+    MANET_EFFECT_DELAY = 5
+} manet_effect_type;
+
+/* One of miniaudio's built-in effect nodes. Parameters are changed with the node's reinit/setters, which keep the
+   filter state, so they can be updated while the node is processing. */
+typedef struct manet_effect_node {
+    manet_effect_type type;
+    ma_uint32 channels;
+    ma_uint32 sampleRate;
+    ma_uint32 order;
+    union {
+        ma_lpf_node lowPass;
+        ma_hpf_node highPass;
+        ma_biquad_node biquad;
+        ma_peak_node peakingEq;
+        ma_delay_node delay;
+    } node;
+} manet_effect_node;
+
+/* Handed to a custom node's process callback. Every bus carries `channels` interleaved f32 channels and holds exactly
+   `frameCount` frames; inputs is NULL only when the node has no input buses. */
+typedef struct manet_node_process_info {
+    void* userData;
+    const float* const* inputs;
+    float* const* outputs;
+    ma_uint32 inputBusCount;
+    ma_uint32 outputBusCount;
+    ma_uint32 channels;
+    ma_uint32 frameCount;
+} manet_node_process_info;
+
+typedef void (*manet_custom_node_process_proc)(const manet_node_process_info* info);
+
+/* A node whose processing is supplied by the host. The base must come first so the struct can be used as an ma_node,
+   and the vtable lives in the node because its flags are chosen per instance. */
+typedef struct manet_custom_node {
+    ma_node_base base;
+    ma_node_vtable vtable;
+    manet_custom_node_process_proc process;
+    void* userData;
+    ma_uint32 channels;
+} manet_custom_node;
+
+/* MA_NODE_FLAG_ALLOW_NULL_INPUT is left out: miniaudio only passes NULL for the first chunk after the input cache
+   drains, so hosts would still have to handle silent buffers. */
+#define MANET_CUSTOM_NODE_FLAGS (MA_NODE_FLAG_CONTINUOUS_PROCESSING | MA_NODE_FLAG_SILENT_OUTPUT)
+
+typedef enum manet_dynamics_kernel_type {
+    MANET_DYNAMICS_KERNEL_AUTO = 0,
+    MANET_DYNAMICS_KERNEL_SCALAR = 1,
+    MANET_DYNAMICS_KERNEL_SSE2 = 2,
+    MANET_DYNAMICS_KERNEL_AVX2 = 3,
+    MANET_DYNAMICS_KERNEL_NEON = 4
+} manet_dynamics_kernel_type;
+
+/* Per-chunk loops of the dynamics nodes. Only the envelope followers are serial; detection, the gain curve and the
+   gain application run over whole chunks so they can be vectorised. */
+typedef struct manet_dynamics_kernels {
+    manet_dynamics_kernel_type type;
+    void (*detect)(const float* frames, ma_uint32 frameCount, ma_uint32 channels, float* peak, float* power);
+    void (*limiter_gain)(const float* peak, ma_uint32 frameCount, float ceiling, float* gain);
+    void (*compressor_gain)(const float* power, ma_uint32 frameCount, float thresholdPower, float exponent, float makeup, float* gain);
+    void (*apply)(const float* framesIn, float* framesOut, ma_uint32 frameCount, ma_uint32 channels, const float* gain);
+} manet_dynamics_kernels;
+
+typedef enum manet_dynamics_mode {
+    MANET_DYNAMICS_LIMITER = 1,
+    MANET_DYNAMICS_COMPRESSOR = 2
+} manet_dynamics_mode;
+
+#define MANET_DYNAMICS_CHUNK_FRAMES 256
+
+/* Level ranges accepted by the dynamics nodes. Beyond them the linear values underflow or overflow float and the gain
+   computer divides 0 by 0 or infinity by infinity. */
+#define MANET_DYNAMICS_MIN_LEVEL_DB  -96.0f
+#define MANET_DYNAMICS_MAX_LEVEL_DB    0.0f
+#define MANET_DYNAMICS_MAX_MAKEUP_DB  48.0f
+
+/* Limiter: the per-frame gain needed to keep the peak under the ceiling gets an instant-attack/exponential-release
+   envelope, then a running minimum and a moving average over lookahead + 1 frames, and is applied to the input
+   delayed by lookahead frames. Every average that reaches a peak only contains values at or below the gain it needs,
+   so the ceiling holds while the gain ramps in smoothly.
+   Compressor: the mean-square level follows attack/release ballistics and feeds a hard-knee RMS gain curve. */
+typedef struct manet_dynamics_node {
+    ma_node_base base;
+    manet_dynamics_mode mode;
+    const manet_dynamics_kernels* kernels;
+    ma_uint32 channels;
+    ma_uint32 sampleRate;
+    /* Written by the host, read once per chunk on the audio thread. */
+    ma_atomic_float threshold;
+    ma_atomic_float exponent;
+    ma_atomic_float makeup;
+    ma_atomic_float attackCoeff;
+    ma_atomic_float releaseCoeff;
+    /* Lowest gain applied (before makeup) since the host last read it. */
+    ma_atomic_float minGain;
+    /* Audio thread only. */
+    float envelope;
+    ma_uint32 lookahead;
+    ma_uint64 frameIndex;
+    float* delay;
+    ma_uint32 delayCursor;
+    float* windowValues;
+    ma_uint64* windowIndices;
+    ma_uint32 windowHead;
+    ma_uint32 windowCount;
+    float* averageValues;
+    double averageSum;
+    ma_uint32 averageCursor;
+} manet_dynamics_node;
+
+typedef struct manet_voice_pool_stats {
+    ma_uint32 capacity;
+    ma_uint32 activeVoices;
+    ma_uint64 playCount;
+    ma_uint64 stealCount;
+    ma_uint64 rejectCount;
+} manet_voice_pool_stats;
+
 typedef struct manet_resource_manager {
     ma_resource_manager manager;
+    manet_data_registry registry;
+    manet_resource_cache cache;
+    manet_vfs vfs;
+    char* decodedCacheDirectory;
+    /* Only allocated when job statistics are collected. */
+    manet_job_monitor* jobMonitor;
 } manet_resource_manager;
 
 typedef struct manet_resource_manager_config_simple {
@@ -69,6 +623,10 @@ typedef struct manet_resource_manager_config_simple {
     ma_uint32 decodedChannels;
     ma_uint32 decodedSampleRate;
     ma_uint32 jobThreadCount;
+    const manet_vfs_config* vfs;
+    manet_asset_pack* assetPack;
+    const char* decodedCacheDirectory;
+    ma_uint32 collectJobStatistics;
 } manet_resource_manager_config_simple;
 
 typedef void (*manet_capture_device_proc)(const float* samples, ma_uint32 frameCount, ma_uint32 channelCount, void* userData);
@@ -78,21 +636,144 @@ typedef struct manet_capture_device {
     manet_capture_device_proc callback;
     void* userData;
     ma_uint32 channelCount;
+    /* Optional pull-model ring filled by the device thread and drained by manet_capture_device_read. The device
+       thread only touches the ring, the drop counter and readSignal: once readRequest frames are available it
+       raises MANET_CAPTURE_NOTIFICATION_READ for a waiter thread, so no managed code runs on the device thread. */
+    ma_bool32 hasRingBuffer;
+    ma_pcm_rb ringBuffer;
+    ma_atomic_uint64 droppedFrames;
+    ma_atomic_uint32 readRequest;
+    manet_signal readSignal;
 } manet_capture_device;
 
+#define MANET_CAPTURE_NOTIFICATION_READ 1
+
 static void manet_copy_string(char* dst, size_t dstSize, const char* src);
 static void manet_device_id_to_hex(const ma_device_id* id, char* buffer, size_t bufferSize);
 static int manet_hex_value(char digit);
 static ma_bool32 manet_device_id_from_hex(const char* hex, ma_device_id* id);
 static void manet_write_device_descriptor(manet_device_descriptor* dst, const ma_device_info* src, ma_device_type type);
 static ma_uint32 manet_min_u32(ma_uint32 a, ma_uint32 b);
-static manet_engine* manet_engine_create_with_config(const ma_engine_config* inputConfig);
+static manet_engine* manet_engine_create_with_config(const ma_engine_config* inputConfig, manet_resource_manager* sharedManager, ma_bool32 enableMetering);
+static manet_meter* manet_meter_create(ma_uint32 channels, ma_uint32 sampleRate);
+static void manet_meter_destroy(manet_meter* meter);
+static void manet_meter_process(manet_meter* meter, const float* frames, ma_uint64 frameCount);
+static void manet_engine_metered_data_callback(ma_device* device, void* output, const void* input, ma_uint32 frameCount);
 static void manet_apply_resource_manager_settings(ma_resource_manager_config* config, const manet_resource_manager_config_simple* settings);
 static void manet_sound_end_callback_trampoline(void* pUserData, ma_sound* pSound);
+static manet_sound* manet_sound_create_from_path(manet_engine* engineHandle, const char* path, const wchar_t* pathW, ma_uint32 flags, manet_sound_load_proc callback, void* userData);
+static void manet_sound_load_notification_on_signal(ma_async_notification* pNotification);
+static void manet_sound_load_notification_deliver(manet_sound_load_notification* notification);
+static void manet_data_buffer_wait_for_jobs(ma_resource_manager_data_buffer* dataBuffer);
 static void manet_capture_device_data_callback(ma_device* pDevice, void* pOutput, const void* pInput, ma_uint32 frameCount);
-static manet_pcm_stream* manet_pcm_stream_create(ma_uint32 channels, ma_uint32 sampleRate, ma_uint32 capacityInFrames);
+static void manet_capture_device_write_ring(manet_capture_device* handle, const float* samples, ma_uint32 frameCount);
+static manet_pcm_stream* manet_pcm_stream_create(ma_uint32 channels, ma_uint32 sampleRate, ma_uint32 capacityInFrames, ma_format inputFormat);
 static void manet_pcm_stream_destroy(manet_pcm_stream* stream);
-static ma_result manet_pcm_stream_append_pcm_frames(manet_pcm_stream* stream, const float* frames, ma_uint64 frameCount, ma_uint64* framesWritten);
+static ma_result manet_pcm_stream_append_pcm_frames(manet_pcm_stream* stream, const void* frames, ma_format format, ma_uint64 frameCount, ma_uint64* framesWritten);
+static ma_result manet_pcm_stream_append_pcm_planes(manet_pcm_stream* stream, const float* const* planes, ma_uint64 frameCount, ma_uint64* framesWritten);
+static ma_result manet_pcm_stream_write(manet_pcm_stream* stream, const void* frames, const float* const* planes, ma_format format, ma_uint64 frameCount, ma_uint64* framesWritten);
+static void manet_interleave_f32_planes(float* dst, const float* const* planes, ma_uint64 planeOffset, ma_uint64 frameCount, ma_uint32 channels);
+static manet_sound* manet_sound_create_pcm_buffer(manet_engine* engineHandle, const float* frames, const float* const* planes, ma_uint64 frameCount, ma_uint32 channels, ma_uint32 sampleRate, ma_uint32 flags, ma_bool32 copyFrames);
+static void manet_pcm_buffer_retain(manet_pcm_buffer* buffer);
+static ma_result manet_data_registry_init(manet_data_registry* registry, ma_resource_manager* resourceManager);
+static void manet_data_registry_uninit(manet_data_registry* registry);
+static manet_registered_data* manet_data_registry_alloc_entry(const char* name, const void* data, size_t sizeInBytes);
+static ma_result manet_data_registry_add_encoded(manet_data_registry* registry, const char* name, const void* data, ma_uint64 sizeInBytes, ma_bool32 shareIdentical);
+static ma_bool32 manet_registered_data_matches_encoded(const manet_registered_data* entry, const void* data, ma_uint64 sizeInBytes);
+static ma_result manet_data_registry_add_decoded(manet_data_registry* registry, const char* name, const float* frames, ma_uint64 frameCount, ma_uint32 channels, ma_uint32 sampleRate);
+static ma_result manet_data_registry_remove(manet_data_registry* registry, const char* name);
+static ma_bool32 manet_data_registry_contains(manet_data_registry* registry, const char* name);
+static manet_registered_data* manet_data_registry_find(manet_data_registry* registry, const char* name);
+static manet_registered_data* manet_data_registry_acquire(manet_data_registry* registry, const char* name);
+static ma_result manet_data_registry_add_mapped(manet_data_registry* registry, const char* name, const ma_uint8* mapping, ma_uint64 mappingSize, size_t dataOffset, ma_uint64 frameCount, ma_format format, ma_uint32 channels, ma_uint32 sampleRate);
+static void manet_registered_data_release(manet_registered_data* entry);
+static void manet_registered_data_release_from_sound(manet_registered_data* entry);
+static void manet_sound_copy_output_routing(manet_sound* sourceHandle, manet_sound* soundHandle);
+static ma_result manet_resource_cache_init(manet_resource_cache* cache, ma_resource_manager* resourceManager);
+static ma_bool32 manet_vfs_init(manet_vfs* vfs, const manet_vfs_config* config, manet_asset_pack* pack);
+static void manet_vfs_uninit(manet_vfs* vfs);
+static ma_result manet_vfs_open_utf8(manet_vfs* vfs, const char* path, const wchar_t* pathW, ma_uint32 openMode, ma_vfs_file* pFile);
+static ma_result manet_vfs_on_open(ma_vfs* pVFS, const char* pFilePath, ma_uint32 openMode, ma_vfs_file* pFile);
+static ma_result manet_vfs_on_open_w(ma_vfs* pVFS, const wchar_t* pFilePath, ma_uint32 openMode, ma_vfs_file* pFile);
+static ma_result manet_vfs_on_close(ma_vfs* pVFS, ma_vfs_file file);
+static ma_result manet_vfs_on_read(ma_vfs* pVFS, ma_vfs_file file, void* pDst, size_t sizeInBytes, size_t* pBytesRead);
+static ma_result manet_vfs_on_write(ma_vfs* pVFS, ma_vfs_file file, const void* pSrc, size_t sizeInBytes, size_t* pBytesWritten);
+static ma_result manet_vfs_on_seek(ma_vfs* pVFS, ma_vfs_file file, ma_int64 offset, ma_seek_origin origin);
+static ma_result manet_vfs_on_tell(ma_vfs* pVFS, ma_vfs_file file, ma_int64* pCursor);
+static ma_result manet_vfs_on_info(ma_vfs* pVFS, ma_vfs_file file, ma_file_info* pInfo);
+static char* manet_utf8_from_wide(const wchar_t* text);
+static ma_result manet_asset_pack_parse(manet_asset_pack* pack);
+static manet_asset_pack* manet_asset_pack_map(const char* path, const wchar_t* pathW);
+static const manet_asset_pack_entry* manet_asset_pack_find(const manet_asset_pack* pack, const char* name);
+static void manet_asset_pack_release(manet_asset_pack* pack);
+static const ma_uint8* manet_map_file(const char* path, const wchar_t* pathW, ma_uint64* pSize);
+static void manet_unmap_file(const ma_uint8* data, ma_uint64 sizeInBytes);
+#if defined(_WIN32)
+static wchar_t* manet_wide_from_utf8(const char* text);
+#endif
+static void manet_write_le32(ma_uint8* p, ma_uint32 value);
+static void manet_write_le64(ma_uint8* p, ma_uint64 value);
+static ma_uint64 manet_hash_bytes(const void* data, size_t sizeInBytes);
+static ma_bool32 manet_file_stamp(const char* path, const wchar_t* pathW, ma_uint64* pSize, ma_uint64* pTime);
+static ma_bool32 manet_decoded_cache_find_key(manet_data_registry* registry, const char* path, ma_uint64 sourceSize, ma_uint64 sourceTime, ma_uint64* pContentHash, ma_uint64* pContentSize);
+static void manet_decoded_cache_remember_key(manet_data_registry* registry, const char* path, ma_uint64 sourceSize, ma_uint64 sourceTime, ma_uint64 contentHash, ma_uint64 contentSize);
+static ma_bool32 manet_decoded_cache_validate(const ma_uint8* data, ma_uint64 sizeInBytes, ma_format format, ma_uint32 channels, ma_uint32 sampleRate, ma_uint64* pFrameCount);
+static ma_result manet_decoded_cache_write(const char* filePath, const void* frames, ma_uint64 frameCount, ma_format format, ma_uint32 channels, ma_uint32 sampleRate);
+static char* manet_decoded_cache_key_file_path(const char* directory, const char* path);
+static ma_bool32 manet_decoded_cache_read_key_file(const char* directory, const char* path, ma_uint64 sourceSize, ma_uint64 sourceTime, ma_uint64* pContentHash, ma_uint64* pContentSize);
+static void manet_decoded_cache_write_key_file(const char* directory, const char* path, ma_uint64 sourceSize, ma_uint64 sourceTime, ma_uint64 contentHash, ma_uint64 contentSize);
+static ma_result manet_write_file_replace(const char* filePath, const void* header, size_t headerSize, const void* data, size_t dataSize);
+static manet_registered_data* manet_decoded_cache_acquire(manet_engine* engineHandle, const char* path, const wchar_t* pathW, ma_bool32 allowPopulate);
+static void manet_resource_cache_uninit(manet_resource_cache* cache);
+static void manet_resource_cache_on_sound_loaded(manet_resource_cache* cache, manet_sound* soundHandle);
+static void manet_resource_cache_trim(manet_resource_cache* cache, ma_bool32 releaseAll);
+static void manet_resource_cache_measure(manet_resource_cache* cache, ma_uint32* bufferCount, ma_uint64* residentBytes);
+static void manet_resource_cache_remove_entry(manet_resource_cache* cache, manet_cache_entry* entry);
+static void manet_resource_cache_update_entry_size(manet_resource_cache* cache, manet_cache_entry* entry);
+static void manet_resource_cache_update_unsettled_sizes(manet_resource_cache* cache);
+static manet_cache_entry* manet_resource_cache_find(manet_resource_cache* cache, ma_resource_manager_data_buffer_node* node);
+static ma_result manet_resource_cache_index_insert(manet_resource_cache* cache, manet_cache_entry* entry);
+static void manet_resource_cache_index_remove(manet_resource_cache* cache, manet_cache_entry* entry);
+static manet_job_monitor* manet_job_monitor_start(ma_resource_manager* resourceManager, ma_uint32 workerCount, size_t stackSize);
+static void manet_job_monitor_stop(manet_job_monitor* monitor);
+static ma_thread_result MA_THREADCALL manet_job_monitor_dispatch(void* userData);
+static manet_effect_node* manet_effect_node_alloc(manet_engine* engineHandle, manet_effect_type type, ma_uint32 channels);
+static manet_effect_node* manet_effect_node_finish_create(manet_effect_node* handle, ma_result result);
+static ma_bool32 manet_effect_frequency_is_valid(double frequency, ma_uint32 sampleRate);
+static void manet_custom_node_process(ma_node* node, const float** framesIn, ma_uint32* frameCountIn, float** framesOut, ma_uint32* frameCountOut);
+static const manet_dynamics_kernels* manet_dynamics_find_kernels(manet_dynamics_kernel_type type);
+static manet_dynamics_node* manet_dynamics_node_init(manet_engine* engineHandle, manet_dynamics_mode mode, ma_uint32 channels, ma_uint32 lookahead, ma_uint32 kernel);
+static manet_dynamics_node* manet_dynamics_node_attach(manet_engine* engineHandle, manet_dynamics_node* handle);
+static void manet_dynamics_node_free(manet_dynamics_node* handle);
+static void manet_dynamics_node_process(ma_node* node, const float** framesIn, ma_uint32* frameCountIn, float** framesOut, ma_uint32* frameCountOut);
+static void manet_dynamics_limit_chunk(manet_dynamics_node* handle, const float* framesIn, float* framesOut, ma_uint32 frameCount, float* peak, float* power, float* gain);
+static void manet_dynamics_compress_chunk(manet_dynamics_node* handle, const float* framesIn, float* framesOut, ma_uint32 frameCount, float* peak, float* power, float* gain);
+static ma_thread_result MA_THREADCALL manet_job_monitor_work(void* userData);
+static void manet_job_monitor_process(manet_job_monitor* monitor, manet_queued_job* queued);
+static void manet_job_monitor_track_decode(manet_job_monitor* monitor, ma_resource_manager_data_buffer_node* node, double seconds, ma_bool32 isFinished, ma_bool32 succeeded);
+static void manet_job_histogram_record(manet_job_histogram* histogram, double seconds);
+static ma_uint64 manet_data_buffer_node_size(ma_resource_manager_data_buffer_node* node);
+static manet_voice* manet_voice_pool_acquire_voice(manet_voice_pool* pool);
+static void manet_voice_end_callback(void* pUserData, ma_sound* pSound);
+static ma_result manet_voice_on_read(ma_data_source* pDataSource, void* pFramesOut, ma_uint64 frameCount, ma_uint64* pFramesRead);
+static ma_result manet_voice_on_seek(ma_data_source* pDataSource, ma_uint64 frameIndex);
+static ma_result manet_voice_on_get_data_format(ma_data_source* pDataSource, ma_format* pFormat, ma_uint32* pChannels, ma_uint32* pSampleRate, ma_channel* pChannelMap, size_t channelMapCap);
+static ma_result manet_voice_on_get_cursor(ma_data_source* pDataSource, ma_uint64* pCursor);
+static ma_result manet_voice_on_get_length(ma_data_source* pDataSource, ma_uint64* pLength);
+static ma_result manet_pcm_stream_acquire_write(manet_pcm_stream* stream, ma_uint32* frameCount, void** buffer);
+static ma_result manet_pcm_stream_commit_write(manet_pcm_stream* stream, ma_uint32 frameCount);
+static void manet_pcm_stream_set_low_watermark(manet_pcm_stream* stream, ma_uint32 frames);
+static void manet_pcm_stream_request_write_space(manet_pcm_stream* stream, ma_uint32 frames);
+static ma_result manet_signal_init(manet_signal* signal);
+static void manet_signal_uninit(manet_signal* signal);
+static void manet_signal_raise(manet_signal* signal, ma_uint32 bits);
+static ma_result manet_signal_wait(manet_signal* signal, ma_uint32* bits);
+static void manet_signal_close(manet_signal* signal);
+static void manet_pcm_stream_check_notifications(manet_pcm_stream* stream);
+static void manet_pcm_stream_on_frames_written(manet_pcm_stream* stream, ma_uint64 frameCount);
+static void manet_pcm_stream_on_frames_read(manet_pcm_stream* stream, ma_uint64 framesRead, ma_uint64 silenceFrames);
+static void manet_pcm_stream_get_stats(manet_pcm_stream* stream, manet_pcm_stream_stats* stats);
+static void manet_pcm_stream_reset_stats(manet_pcm_stream* stream);
 static ma_uint64 manet_pcm_stream_capacity(const manet_pcm_stream* stream);
 static ma_uint64 manet_pcm_stream_available_read(const manet_pcm_stream* stream);
 static ma_uint64 manet_pcm_stream_available_write(const manet_pcm_stream* stream);
@@ -110,6 +791,27 @@ struct manet_pcm_stream {
     ma_pcm_rb ringBuffer;
     ma_atomic_bool32 endRequested;
     ma_uint64 capacityInFrames;
+    /* Sample format accepted by append_raw; the ring buffer itself always holds f32 frames. */
+    ma_format inputFormat;
+    /* Frames handed out by the last acquire_write that have not been committed yet (producer side only). */
+    ma_uint32 acquiredWriteFrames;
+    /* Notifications raised from the audio thread after a read, delivered as manet_pcm_stream_notification bits on
+       the signal.
+       LOW_WATERMARK fires once when fewer than lowWatermark frames remain queued and is re-armed by the next write.
+       WRITE_SPACE fires once when at least writeSpaceRequest frames are free and is re-armed by the next request.
+       A threshold of 0 disables the corresponding notification. */
+    ma_atomic_uint32 lowWatermark;
+    ma_atomic_bool32 lowWatermarkArmed;
+    ma_atomic_uint32 writeSpaceRequest;
+    manet_signal signal;
+    /* Buffer-health telemetry. Totals are updated by whichever side produced them; minQueued is only lowered by the
+       audio thread after a read and maxQueued is only raised by the producer after a write. */
+    ma_atomic_uint64 underrunCount;
+    ma_atomic_uint64 silenceFramesInserted;
+    ma_atomic_uint64 framesRead;
+    ma_atomic_uint64 framesWritten;
+    ma_atomic_uint32 minQueuedFrames;
+    ma_atomic_uint32 maxQueuedFrames;
 };
 
 static ma_data_source_vtable g_manet_pcm_stream_vtable = {
@@ -122,6 +824,16 @@ static ma_data_source_vtable g_manet_pcm_stream_vtable = {
     0
 };
 
+static ma_data_source_vtable g_manet_voice_vtable = {
+    manet_voice_on_read,
+    manet_voice_on_seek,
+    manet_voice_on_get_data_format,
+    manet_voice_on_get_cursor,
+    manet_voice_on_get_length,
+    NULL,
+    0
+};
+
 static void* manet_alloc(size_t size)
 {
     if (size == 0) {
@@ -219,20 +931,63 @@ static void manet_capture_device_data_callback(ma_device* pDevice, void* pOutput
     }
 
     manet_capture_device* handle = (manet_capture_device*)pDevice->pUserData;
-    if (handle == NULL || handle->callback == NULL || pInput == NULL) {
+    if (handle == NULL || pInput == NULL) {
         return;
     }
 
-    handle->callback((const float*)pInput, frameCount, handle->channelCount, handle->userData);
+    if (handle->hasRingBuffer) {
+        manet_capture_device_write_ring(handle, (const float*)pInput, frameCount);
+    }
+
+    if (handle->callback != NULL) {
+        handle->callback((const float*)pInput, frameCount, handle->channelCount, handle->userData);
+    }
+}
+
+static void manet_capture_device_write_ring(manet_capture_device* handle, const float* samples, ma_uint32 frameCount)
+{
+    ma_pcm_rb* rb = &handle->ringBuffer;
+    ma_uint32 totalWritten = 0;
+
+    while (totalWritten < frameCount) {
+        ma_uint32 mappedFrameCount = frameCount - totalWritten;
+        void* mappedBuffer = NULL;
+        if (ma_pcm_rb_acquire_write(rb, &mappedFrameCount, &mappedBuffer) != MA_SUCCESS || mappedFrameCount == 0) {
+            break;
+        }
+
+        ma_copy_pcm_frames(mappedBuffer, ma_offset_pcm_frames_const_ptr(samples, totalWritten, rb->format, rb->channels), mappedFrameCount, rb->format, rb->channels);
+        if (ma_pcm_rb_commit_write(rb, mappedFrameCount) != MA_SUCCESS) {
+            break;
+        }
+
+        totalWritten += mappedFrameCount;
+    }
+
+    /* The consumer is not keeping up; newest frames are dropped rather than blocking the device thread. */
+    if (totalWritten < frameCount) {
+        ma_atomic_uint64_fetch_add(&handle->droppedFrames, frameCount - totalWritten);
+    }
+
+    ma_uint32 request = ma_atomic_uint32_get(&handle->readRequest);
+    if (request != 0 && ma_pcm_rb_available_read(rb) >= request) {
+        if (ma_atomic_uint32_compare_and_swap(&handle->readRequest, request, 0) == request) {
+            manet_signal_raise(&handle->readSignal, MANET_CAPTURE_NOTIFICATION_READ);
+        }
+    }
 }
 #endif
 
-static manet_pcm_stream* manet_pcm_stream_create(ma_uint32 channels, ma_uint32 sampleRate, ma_uint32 capacityInFrames)
+static manet_pcm_stream* manet_pcm_stream_create(ma_uint32 channels, ma_uint32 sampleRate, ma_uint32 capacityInFrames, ma_format inputFormat)
 {
     if (channels == 0 || sampleRate == 0 || capacityInFrames == 0) {
         return NULL;
     }
 
+    if (inputFormat == ma_format_unknown || inputFormat >= ma_format_count) {
+        return NULL;
+    }
+
     manet_pcm_stream* stream = (manet_pcm_stream*)manet_alloc(sizeof(*stream));
     if (stream == NULL) {
         return NULL;
@@ -246,7 +1001,15 @@ static manet_pcm_stream* manet_pcm_stream_create(ma_uint32 channels, ma_uint32 s
         return NULL;
     }
 
+    result = manet_signal_init(&stream->signal);
+    if (result != MA_SUCCESS) {
+        ma_pcm_rb_uninit(&stream->ringBuffer);
+        manet_free(stream);
+        return NULL;
+    }
+
     stream->capacityInFrames = capacityInFrames;
+    stream->inputFormat = inputFormat;
     stream->ringBuffer.sampleRate = sampleRate;
     ma_atomic_bool32_set(&stream->endRequested, MA_FALSE);
 
@@ -255,6 +1018,7 @@ static manet_pcm_stream* manet_pcm_stream_create(ma_uint32 channels, ma_uint32 s
 
     result = ma_data_source_init(&config, &stream->ds);
     if (result != MA_SUCCESS) {
+        manet_signal_uninit(&stream->signal);
         ma_pcm_rb_uninit(&stream->ringBuffer);
         manet_free(stream);
         return NULL;
@@ -270,6 +1034,7 @@ static void manet_pcm_stream_destroy(manet_pcm_stream* stream)
     }
 
     ma_data_source_uninit((ma_data_source*)&stream->ds);
+    manet_signal_uninit(&stream->signal);
     ma_pcm_rb_uninit(&stream->ringBuffer);
     manet_free(stream);
 }
@@ -309,6 +1074,11 @@ static ma_result manet_pcm_stream_reset(manet_pcm_stream* stream)
 
     ma_pcm_rb_reset(&stream->ringBuffer);
     ma_atomic_bool32_set(&stream->endRequested, MA_FALSE);
+    stream->acquiredWriteFrames = 0;
+    ma_atomic_bool32_set(&stream->lowWatermarkArmed, MA_TRUE);
+
+    /* The buffer is empty now, so a pending writer or refill waiter can proceed without waiting for a read. */
+    manet_pcm_stream_check_notifications(stream);
     return MA_SUCCESS;
 }
 
@@ -357,7 +1127,7 @@ static ma_uint32 manet_pcm_stream_get_sample_rate(const manet_pcm_stream* stream
     return stream->ringBuffer.sampleRate;
 }
 
-static ma_result manet_pcm_stream_append_pcm_frames(manet_pcm_stream* stream, const float* frames, ma_uint64 frameCount, ma_uint64* framesWritten)
+static ma_result manet_pcm_stream_append_pcm_frames(manet_pcm_stream* stream, const void* frames, ma_format format, ma_uint64 frameCount, ma_uint64* framesWritten)
 {
     if (framesWritten != NULL) {
         *framesWritten = 0;
@@ -375,6 +1145,39 @@ static ma_result manet_pcm_stream_append_pcm_frames(manet_pcm_stream* stream, co
         return MA_INVALID_ARGS;
     }
 
+    return manet_pcm_stream_write(stream, frames, NULL, format, frameCount, framesWritten);
+}
+
+static ma_result manet_pcm_stream_append_pcm_planes(manet_pcm_stream* stream, const float* const* planes, ma_uint64 frameCount, ma_uint64* framesWritten)
+{
+    if (framesWritten != NULL) {
+        *framesWritten = 0;
+    }
+
+    if (stream == NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    if (frameCount == 0) {
+        return MA_SUCCESS;
+    }
+
+    if (planes == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    for (ma_uint32 channel = 0; channel < stream->ringBuffer.channels; channel += 1) {
+        if (planes[channel] == NULL) {
+            return MA_INVALID_ARGS;
+        }
+    }
+
+    return manet_pcm_stream_write(stream, NULL, planes, ma_format_f32, frameCount, framesWritten);
+}
+
+/* Shared producer loop for interleaved and planar input. Exactly one of frames/planes is non-NULL. */
+static ma_result manet_pcm_stream_write(manet_pcm_stream* stream, const void* frames, const float* const* planes, ma_format format, ma_uint64 frameCount, ma_uint64* framesWritten)
+{
     if (manet_pcm_stream_is_end_requested(stream)) {
         return MA_INVALID_OPERATION;
     }
@@ -410,8 +1213,13 @@ static ma_result manet_pcm_stream_append_pcm_frames(manet_pcm_stream* stream, co
             break;
         }
 
-        const void* source = ma_offset_pcm_frames_const_ptr(frames, totalWritten, rb->format, rb->channels);
-        ma_copy_pcm_frames(mappedBuffer, source, mappedFrameCount, rb->format, rb->channels);
+        if (planes != NULL) {
+            manet_interleave_f32_planes((float*)mappedBuffer, planes, totalWritten, mappedFrameCount, rb->channels);
+        } else {
+            /* Converts straight into the mapped ring region; ma_pcm_convert degrades to a plain copy for f32 input. */
+            const void* source = ma_offset_pcm_frames_const_ptr(frames, totalWritten, format, rb->channels);
+            ma_pcm_convert(mappedBuffer, rb->format, source, format, (ma_uint64)mappedFrameCount * rb->channels, ma_dither_mode_none);
+        }
 
         result = ma_pcm_rb_commit_write(rb, mappedFrameCount);
         if (result != MA_SUCCESS) {
@@ -422,6 +1230,8 @@ static ma_result manet_pcm_stream_append_pcm_frames(manet_pcm_stream* stream, co
         totalWritten += mappedFrameCount;
     }
 
+    manet_pcm_stream_on_frames_written(stream, totalWritten);
+
     if (framesWritten != NULL) {
         *framesWritten = totalWritten;
     }
@@ -429,6 +1239,215 @@ static ma_result manet_pcm_stream_append_pcm_frames(manet_pcm_stream* stream, co
     return MA_SUCCESS;
 }
 
+static void manet_interleave_f32_planes(float* dst, const float* const* planes, ma_uint64 planeOffset, ma_uint64 frameCount, ma_uint32 channels)
+{
+    if (channels == 2) {
+        const float* left = planes[0] + planeOffset;
+        const float* right = planes[1] + planeOffset;
+        for (ma_uint64 frame = 0; frame < frameCount; frame += 1) {
+            dst[frame * 2 + 0] = left[frame];
+            dst[frame * 2 + 1] = right[frame];
+        }
+        return;
+    }
+
+    for (ma_uint32 channel = 0; channel < channels; channel += 1) {
+        const float* src = planes[channel] + planeOffset;
+        float* out = dst + channel;
+        for (ma_uint64 frame = 0; frame < frameCount; frame += 1) {
+            out[frame * channels] = src[frame];
+        }
+    }
+}
+
+static ma_result manet_pcm_stream_acquire_write(manet_pcm_stream* stream, ma_uint32* frameCount, void** buffer)
+{
+    if (buffer != NULL) {
+        *buffer = NULL;
+    }
+
+    if (stream == NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    if (frameCount == NULL || buffer == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    if (manet_pcm_stream_is_end_requested(stream)) {
+        *frameCount = 0;
+        return MA_INVALID_OPERATION;
+    }
+
+    /* The mapped region never wraps, so it may be shorter than requested even when more space is free. */
+    ma_result result = ma_pcm_rb_acquire_write(&stream->ringBuffer, frameCount, buffer);
+    if (result != MA_SUCCESS) {
+        *frameCount = 0;
+        *buffer = NULL;
+        stream->acquiredWriteFrames = 0;
+        return result;
+    }
+
+    stream->acquiredWriteFrames = *frameCount;
+    return MA_SUCCESS;
+}
+
+static ma_result manet_pcm_stream_commit_write(manet_pcm_stream* stream, ma_uint32 frameCount)
+{
+    if (stream == NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    if (frameCount > stream->acquiredWriteFrames) {
+        return MA_INVALID_ARGS;
+    }
+
+    stream->acquiredWriteFrames = 0;
+    ma_result result = ma_pcm_rb_commit_write(&stream->ringBuffer, frameCount);
+    if (result == MA_SUCCESS) {
+        manet_pcm_stream_on_frames_written(stream, frameCount);
+    }
+
+    return result;
+}
+
+static void manet_pcm_stream_on_frames_written(manet_pcm_stream* stream, ma_uint64 frameCount)
+{
+    if (frameCount == 0) {
+        return;
+    }
+
+    ma_atomic_bool32_set(&stream->lowWatermarkArmed, MA_TRUE);
+    ma_atomic_uint64_fetch_add(&stream->framesWritten, frameCount);
+
+    ma_uint32 queued = ma_pcm_rb_available_read(&stream->ringBuffer);
+    if (queued > ma_atomic_uint32_get(&stream->maxQueuedFrames)) {
+        ma_atomic_uint32_set(&stream->maxQueuedFrames, queued);
+    }
+}
+
+static void manet_pcm_stream_on_frames_read(manet_pcm_stream* stream, ma_uint64 framesRead, ma_uint64 silenceFrames)
+{
+    if (framesRead > 0) {
+        ma_atomic_uint64_fetch_add(&stream->framesRead, framesRead);
+    }
+
+    if (silenceFrames > 0) {
+        ma_atomic_uint64_fetch_add(&stream->underrunCount, 1);
+        ma_atomic_uint64_fetch_add(&stream->silenceFramesInserted, silenceFrames);
+    }
+
+    ma_uint32 queued = ma_pcm_rb_available_read(&stream->ringBuffer);
+    if (queued < ma_atomic_uint32_get(&stream->minQueuedFrames)) {
+        ma_atomic_uint32_set(&stream->minQueuedFrames, queued);
+    }
+}
+
+static void manet_pcm_stream_get_stats(manet_pcm_stream* stream, manet_pcm_stream_stats* stats)
+{
+    stats->underrunCount = ma_atomic_uint64_get(&stream->underrunCount);
+    stats->silenceFramesInserted = ma_atomic_uint64_get(&stream->silenceFramesInserted);
+    stats->framesRead = ma_atomic_uint64_get(&stream->framesRead);
+    stats->framesWritten = ma_atomic_uint64_get(&stream->framesWritten);
+    stats->minQueuedFrames = ma_atomic_uint32_get(&stream->minQueuedFrames);
+    stats->maxQueuedFrames = ma_atomic_uint32_get(&stream->maxQueuedFrames);
+}
+
+static void manet_pcm_stream_reset_stats(manet_pcm_stream* stream)
+{
+    ma_uint32 queued = ma_pcm_rb_available_read(&stream->ringBuffer);
+
+    ma_atomic_uint64_set(&stream->underrunCount, 0);
+    ma_atomic_uint64_set(&stream->silenceFramesInserted, 0);
+    ma_atomic_uint64_set(&stream->framesRead, 0);
+    ma_atomic_uint64_set(&stream->framesWritten, 0);
+    ma_atomic_uint32_set(&stream->minQueuedFrames, queued);
+    ma_atomic_uint32_set(&stream->maxQueuedFrames, queued);
+}
+
+static void manet_pcm_stream_set_low_watermark(manet_pcm_stream* stream, ma_uint32 frames)
+{
+    if (stream == NULL) {
+        return;
+    }
+
+    ma_atomic_bool32_set(&stream->lowWatermarkArmed, MA_TRUE);
+    ma_atomic_uint32_set(&stream->lowWatermark, frames);
+}
+
+static void manet_pcm_stream_request_write_space(manet_pcm_stream* stream, ma_uint32 frames)
+{
+    if (stream == NULL) {
+        return;
+    }
+
+    ma_atomic_uint32_set(&stream->writeSpaceRequest, frames);
+}
+
+static ma_result manet_signal_init(manet_signal* signal)
+{
+    ma_atomic_uint32_set(&signal->pending, 0);
+    ma_atomic_bool32_set(&signal->isClosed, MA_FALSE);
+    return ma_event_init(&signal->event);
+}
+
+static void manet_signal_uninit(manet_signal* signal)
+{
+    ma_event_uninit(&signal->event);
+}
+
+static void manet_signal_raise(manet_signal* signal, ma_uint32 bits)
+{
+    /* The event is auto-reset and stays set until the waiter takes it, so a bit the waiter has not collected yet
+       needs no second wakeup. */
+    ma_uint32 previous = ma_atomic_uint32_fetch_or(&signal->pending, bits);
+    if ((previous & bits) != bits) {
+        ma_event_signal(&signal->event);
+    }
+}
+
+/* Blocks until at least one bit is pending or the signal is closed. Returns MA_CANCELLED once closed. */
+static ma_result manet_signal_wait(manet_signal* signal, ma_uint32* bits)
+{
+    for (;;) {
+        if (ma_atomic_bool32_get(&signal->isClosed)) {
+            *bits = 0;
+            return MA_CANCELLED;
+        }
+
+        ma_uint32 pending = ma_atomic_uint32_exchange(&signal->pending, 0);
+        if (pending != 0) {
+            *bits = pending;
+            return MA_SUCCESS;
+        }
+
+        ma_event_wait(&signal->event);
+    }
+}
+
+static void manet_signal_close(manet_signal* signal)
+{
+    ma_atomic_bool32_set(&signal->isClosed, MA_TRUE);
+    ma_event_signal(&signal->event);
+}
+
+static void manet_pcm_stream_check_notifications(manet_pcm_stream* stream)
+{
+    ma_uint32 watermark = ma_atomic_uint32_get(&stream->lowWatermark);
+    if (watermark != 0 && ma_pcm_rb_available_read(&stream->ringBuffer) < watermark) {
+        if (ma_atomic_bool32_exchange(&stream->lowWatermarkArmed, MA_FALSE) == MA_TRUE) {
+            manet_signal_raise(&stream->signal, MANET_PCM_STREAM_NOTIFICATION_LOW_WATERMARK);
+        }
+    }
+
+    ma_uint32 request = ma_atomic_uint32_get(&stream->writeSpaceRequest);
+    if (request != 0 && ma_pcm_rb_available_write(&stream->ringBuffer) >= request) {
+        if (ma_atomic_uint32_compare_and_swap(&stream->writeSpaceRequest, request, 0) == request) {
+            manet_signal_raise(&stream->signal, MANET_PCM_STREAM_NOTIFICATION_WRITE_SPACE);
+        }
+    }
+}
+
 static ma_result manet_pcm_stream_on_read(ma_data_source* pDataSource, void* pFramesOut, ma_uint64 frameCount, ma_uint64* pFramesRead)
 {
     manet_pcm_stream* stream = (manet_pcm_stream*)pDataSource;
@@ -473,8 +1492,11 @@ static ma_result manet_pcm_stream_on_read(ma_data_source* pDataSource, void* pFr
         totalFramesRead += mappedFrameCount;
     }
 
+    manet_pcm_stream_check_notifications(stream);
+
     if (totalFramesRead == 0) {
         if (manet_pcm_stream_is_end_requested(stream) && ma_pcm_rb_available_read(rb) == 0) {
+            manet_pcm_stream_on_frames_read(stream, 0, 0);
             return MA_AT_END;
         }
 
@@ -482,6 +1504,8 @@ static ma_result manet_pcm_stream_on_read(ma_data_source* pDataSource, void* pFr
             ma_silence_pcm_frames(pFramesOut, frameCount, rb->format, rb->channels);
         }
 
+        manet_pcm_stream_on_frames_read(stream, 0, frameCount);
+
         if (pFramesRead != NULL) {
             *pFramesRead = frameCount;
         }
@@ -489,20 +1513,23 @@ static ma_result manet_pcm_stream_on_read(ma_data_source* pDataSource, void* pFr
         return MA_SUCCESS;
     }
 
+    ma_uint64 silenceFrames = 0;
     if (totalFramesRead < frameCount) {
         if (!manet_pcm_stream_is_end_requested(stream) || ma_pcm_rb_available_read(rb) != 0) {
+            silenceFrames = frameCount - totalFramesRead;
             if (pFramesOut != NULL) {
                 ma_silence_pcm_frames(
                     ma_offset_pcm_frames_ptr(pFramesOut, totalFramesRead, rb->format, rb->channels),
-                    frameCount - totalFramesRead,
+                    silenceFrames,
                     rb->format,
                     rb->channels);
             }
-
-            totalFramesRead = frameCount;
         }
     }
 
+    manet_pcm_stream_on_frames_read(stream, totalFramesRead, silenceFrames);
+    totalFramesRead += silenceFrames;
+
     if (pFramesRead != NULL) {
         *pFramesRead = totalFramesRead;
     }
@@ -538,7 +1565,7 @@ static ma_result manet_pcm_stream_on_get_data_format(ma_data_source* pDataSource
 
 MANET_API manet_engine* manet_engine_create_default(void)
 {
-    return manet_engine_create_with_config(NULL);
+    return manet_engine_create_with_config(NULL, NULL, MA_FALSE);
 }
 
 MANET_API void manet_engine_destroy(manet_engine* handle)
@@ -547,868 +1574,5463 @@ MANET_API void manet_engine_destroy(manet_engine* handle)
         return;
     }
 
+    if (handle->registry == &handle->ownRegistry) {
+        manet_data_registry_uninit(&handle->ownRegistry);
+    }
+
     ma_engine_uninit(&handle->engine);
+    manet_meter_destroy(handle->meter);
     manet_free(handle);
 }
 
-MANET_API ma_result manet_engine_start(manet_engine* handle)
+MANET_API ma_result manet_engine_register_encoded_data(manet_engine* handle, const char* name, const void* data, ma_uint64 sizeInBytes)
 {
     if (manet_validate_engine(handle) != MA_SUCCESS) {
         return MA_INVALID_OPERATION;
     }
 
-    return ma_engine_start(&handle->engine);
+    return manet_data_registry_add_encoded(handle->registry, name, data, sizeInBytes, MA_FALSE);
 }
 
-MANET_API ma_result manet_engine_stop(manet_engine* handle)
+/* Like manet_engine_register_encoded_data, but succeeds without copying when the name already holds the same bytes.
+   MA_ALREADY_EXISTS means the name is taken by different content. */
+MANET_API ma_result manet_engine_register_shared_encoded_data(manet_engine* handle, const char* name, const void* data, ma_uint64 sizeInBytes)
 {
     if (manet_validate_engine(handle) != MA_SUCCESS) {
         return MA_INVALID_OPERATION;
     }
 
-    return ma_engine_stop(&handle->engine);
+    return manet_data_registry_add_encoded(handle->registry, name, data, sizeInBytes, MA_TRUE);
 }
 
-MANET_API ma_uint64 manet_engine_get_time_in_pcm_frames(manet_engine* handle)
+MANET_API ma_result manet_engine_register_decoded_data(manet_engine* handle, const char* name, const float* frames, ma_uint64 frameCount, ma_uint32 channels, ma_uint32 sampleRate)
 {
     if (manet_validate_engine(handle) != MA_SUCCESS) {
-        return 0;
+        return MA_INVALID_OPERATION;
     }
 
-    return ma_engine_get_time_in_pcm_frames(&handle->engine);
+    return manet_data_registry_add_decoded(handle->registry, name, frames, frameCount, channels, sampleRate);
 }
 
-MANET_API ma_uint64 manet_engine_get_time_in_milliseconds(manet_engine* handle)
+MANET_API ma_result manet_engine_unregister_data(manet_engine* handle, const char* name)
 {
     if (manet_validate_engine(handle) != MA_SUCCESS) {
-        return 0;
+        return MA_INVALID_OPERATION;
     }
 
-    return ma_engine_get_time_in_milliseconds(&handle->engine);
+    return manet_data_registry_remove(handle->registry, name);
 }
 
-MANET_API ma_result manet_engine_set_time_in_pcm_frames(manet_engine* handle, ma_uint64 globalTime)
+MANET_API ma_bool32 manet_engine_is_data_registered(manet_engine* handle, const char* name)
 {
     if (manet_validate_engine(handle) != MA_SUCCESS) {
-        return MA_INVALID_OPERATION;
+        return MA_FALSE;
     }
 
-    return ma_engine_set_time_in_pcm_frames(&handle->engine, globalTime);
+    return manet_data_registry_contains(handle->registry, name);
 }
 
-MANET_API ma_result manet_engine_set_time_in_milliseconds(manet_engine* handle, ma_uint64 globalTime)
+static ma_result manet_data_registry_init(manet_data_registry* registry, ma_resource_manager* resourceManager)
 {
-    if (manet_validate_engine(handle) != MA_SUCCESS) {
-        return MA_INVALID_OPERATION;
-    }
-
-    return ma_engine_set_time_in_milliseconds(&handle->engine, globalTime);
+    memset(registry, 0, sizeof(*registry));
+    registry->resourceManager = resourceManager;
+    return ma_mutex_init(&registry->lock);
 }
 
-MANET_API ma_result manet_engine_set_volume(manet_engine* handle, float volume)
+static void manet_data_registry_uninit(manet_data_registry* registry)
 {
-    if (manet_validate_engine(handle) != MA_SUCCESS) {
-        return MA_INVALID_OPERATION;
-    }
+    manet_registered_data* entry = registry->head;
+    while (entry != NULL) {
+        manet_registered_data* next = entry->next;
+        if (registry->resourceManager != NULL) {
+            ma_resource_manager_unregister_data(registry->resourceManager, entry->name);
+        }
 
-    return ma_engine_set_volume(&handle->engine, volume);
-}
+        entry->cacheRegistry = NULL;
+        manet_registered_data_release(entry);
+        entry = next;
+    }
 
-MANET_API float manet_engine_get_volume(manet_engine* handle)
-{
-    if (manet_validate_engine(handle) != MA_SUCCESS) {
-        return 0.0f;
+    manet_decoded_cache_key* key = registry->cacheKeys;
+    while (key != NULL) {
+        manet_decoded_cache_key* next = key->next;
+        manet_free(key);
+        key = next;
     }
 
-    return ma_engine_get_volume(&handle->engine);
+    registry->head = NULL;
+    registry->cacheKeys = NULL;
+    ma_mutex_uninit(&registry->lock);
 }
 
-MANET_API ma_result manet_engine_set_gain_db(manet_engine* handle, float gainDB)
+static manet_registered_data* manet_data_registry_alloc_entry(const char* name, const void* data, size_t sizeInBytes)
 {
-    if (manet_validate_engine(handle) != MA_SUCCESS) {
-        return MA_INVALID_OPERATION;
+    size_t nameLength = strlen(name);
+    manet_registered_data* entry = (manet_registered_data*)manet_alloc(sizeof(*entry) + sizeInBytes + nameLength + 1);
+    if (entry == NULL) {
+        return NULL;
     }
 
-    return ma_engine_set_gain_db(&handle->engine, gainDB);
+    /* Payload first so decoded f32 samples stay aligned; the name follows it. */
+    memset(entry, 0, sizeof(*entry));
+    entry->data = entry + 1;
+    entry->sizeInBytes = sizeInBytes;
+    if (sizeInBytes > 0) {
+        memcpy(entry->data, data, sizeInBytes);
+    }
+    entry->name = (char*)entry->data + sizeInBytes;
+    memcpy(entry->name, name, nameLength + 1);
+    ma_atomic_uint32_set(&entry->refCount, 1);
+
+    return entry;
 }
 
-MANET_API float manet_engine_get_gain_db(manet_engine* handle)
+static ma_bool32 manet_registered_data_matches_encoded(const manet_registered_data* entry, const void* data, ma_uint64 sizeInBytes)
 {
-    if (manet_validate_engine(handle) != MA_SUCCESS) {
-        return 0.0f;
-    }
-
-    return ma_engine_get_gain_db(&handle->engine);
+    return entry->isEncoded && entry->sizeInBytes == sizeInBytes && memcmp(entry->data, data, (size_t)sizeInBytes) == 0;
 }
 
-MANET_API ma_uint32 manet_engine_get_sample_rate(manet_engine* handle)
+static ma_result manet_data_registry_add_encoded(manet_data_registry* registry, const char* name, const void* data, ma_uint64 sizeInBytes, ma_bool32 shareIdentical)
 {
-    if (manet_validate_engine(handle) != MA_SUCCESS) {
-        return 0;
+    if (name == NULL || name[0] == '\0' || data == NULL || sizeInBytes == 0 || sizeInBytes > MA_SIZE_MAX / 2) {
+        return MA_INVALID_ARGS;
     }
 
-    return ma_engine_get_sample_rate(&handle->engine);
-}
-
-MANET_API ma_uint32 manet_engine_get_channels(manet_engine* handle)
-{
-    if (manet_validate_engine(handle) != MA_SUCCESS) {
-        return 0;
+    if (registry->resourceManager == NULL) {
+        return MA_INVALID_OPERATION;
     }
 
-    return ma_engine_get_channels(&handle->engine);
-}
+    /* Repeat registrations of the same asset are settled before copying the bytes. */
+    if (shareIdentical) {
+        ma_mutex_lock(&registry->lock);
+        const manet_registered_data* existing = manet_data_registry_find(registry, name);
+        ma_result existingResult = MA_SUCCESS;
+        if (existing != NULL && !manet_registered_data_matches_encoded(existing, data, sizeInBytes)) {
+            existingResult = MA_ALREADY_EXISTS;
+        }
+        ma_mutex_unlock(&registry->lock);
 
-MANET_API ma_uint32 manet_engine_get_listener_count(manet_engine* handle)
-{
-    if (manet_validate_engine(handle) != MA_SUCCESS) {
-        return 0;
+        if (existing != NULL) {
+            return existingResult;
+        }
     }
 
-    return ma_engine_get_listener_count(&handle->engine);
-}
+    manet_registered_data* entry = manet_data_registry_alloc_entry(name, data, (size_t)sizeInBytes);
+    if (entry == NULL) {
+        return MA_OUT_OF_MEMORY;
+    }
 
-MANET_API ma_uint32 manet_engine_find_closest_listener(manet_engine* handle, float x, float y, float z)
-{
-    if (manet_validate_engine(handle) != MA_SUCCESS) {
-        return MA_LISTENER_INDEX_CLOSEST;
+    entry->isEncoded = MA_TRUE;
+    ma_mutex_lock(&registry->lock);
+
+    /* miniaudio would silently keep the first registration for a duplicate name, so reject it explicitly. */
+    ma_result result = MA_ALREADY_EXISTS;
+    const manet_registered_data* existing = manet_data_registry_find(registry, name);
+    if (existing == NULL) {
+        result = ma_resource_manager_register_encoded_data(registry->resourceManager, entry->name, entry->data, entry->sizeInBytes);
+        if (result == MA_SUCCESS) {
+            entry->next = registry->head;
+            registry->head = entry;
+        }
+    } else if (shareIdentical && manet_registered_data_matches_encoded(existing, data, sizeInBytes)) {
+        /* Another thread registered the same bytes in the meantime. */
+        result = MA_SUCCESS;
+        manet_free(entry);
+        entry = NULL;
     }
 
-    return ma_engine_find_closest_listener(&handle->engine, x, y, z);
-}
+    ma_mutex_unlock(&registry->lock);
 
-MANET_API ma_result manet_engine_play_sound(manet_engine* handle, const char* path)
-{
-    if (manet_validate_engine(handle) != MA_SUCCESS || path == NULL) {
-        return MA_INVALID_OPERATION;
+    if (result != MA_SUCCESS) {
+        manet_free(entry);
     }
 
-    return ma_engine_play_sound(&handle->engine, path, NULL);
+    return result;
 }
 
-MANET_API ma_result manet_engine_set_listener_position(manet_engine* handle, ma_uint32 index, float x, float y, float z)
+static ma_result manet_data_registry_add_decoded(manet_data_registry* registry, const char* name, const float* frames, ma_uint64 frameCount, ma_uint32 channels, ma_uint32 sampleRate)
 {
-    if (manet_validate_engine(handle) != MA_SUCCESS) {
-        return MA_INVALID_OPERATION;
+    if (name == NULL || name[0] == '\0' || frames == NULL || frameCount == 0 || channels == 0 || sampleRate == 0) {
+        return MA_INVALID_ARGS;
     }
 
-    ma_engine_listener_set_position(&handle->engine, index, x, y, z);
-    return MA_SUCCESS;
-}
+    ma_uint32 bytesPerFrame = ma_get_bytes_per_frame(ma_format_f32, channels);
+    if (frameCount > (MA_SIZE_MAX / 2) / bytesPerFrame) {
+        return MA_INVALID_ARGS;
+    }
 
-MANET_API ma_result manet_engine_get_listener_position(manet_engine* handle, ma_uint32 index, float* x, float* y, float* z)
-{
-    if (manet_validate_engine(handle) != MA_SUCCESS || x == NULL || y == NULL || z == NULL) {
+    if (registry->resourceManager == NULL) {
         return MA_INVALID_OPERATION;
     }
 
-    ma_vec3f position = ma_engine_listener_get_position(&handle->engine, index);
-    *x = position.x;
-    *y = position.y;
-    *z = position.z;
+    manet_registered_data* entry = manet_data_registry_alloc_entry(name, frames, (size_t)(frameCount * bytesPerFrame));
+    if (entry == NULL) {
+        return MA_OUT_OF_MEMORY;
+    }
 
-    return MA_SUCCESS;
-}
+    ma_mutex_lock(&registry->lock);
 
-MANET_API ma_result manet_engine_set_listener_direction(manet_engine* handle, ma_uint32 index, float x, float y, float z)
-{
-    if (manet_validate_engine(handle) != MA_SUCCESS) {
-        return MA_INVALID_OPERATION;
+    ma_result result = MA_ALREADY_EXISTS;
+    if (manet_data_registry_find(registry, name) == NULL) {
+        result = ma_resource_manager_register_decoded_data(registry->resourceManager, entry->name, entry->data, frameCount, ma_format_f32, channels, sampleRate);
+        if (result == MA_SUCCESS) {
+            entry->next = registry->head;
+            registry->head = entry;
+        }
     }
 
-    ma_engine_listener_set_direction(&handle->engine, index, x, y, z);
-    return MA_SUCCESS;
-}
+    ma_mutex_unlock(&registry->lock);
 
-MANET_API ma_result manet_engine_get_listener_direction(manet_engine* handle, ma_uint32 index, float* x, float* y, float* z)
-{
-    if (manet_validate_engine(handle) != MA_SUCCESS || x == NULL || y == NULL || z == NULL) {
-        return MA_INVALID_OPERATION;
+    if (result != MA_SUCCESS) {
+        manet_free(entry);
     }
 
-    ma_vec3f direction = ma_engine_listener_get_direction(&handle->engine, index);
-    *x = direction.x;
-    *y = direction.y;
-    *z = direction.z;
-
-    return MA_SUCCESS;
+    return result;
 }
 
-MANET_API ma_result manet_engine_set_listener_world_up(manet_engine* handle, ma_uint32 index, float x, float y, float z)
+static ma_result manet_data_registry_remove(manet_data_registry* registry, const char* name)
 {
-    if (manet_validate_engine(handle) != MA_SUCCESS) {
-        return MA_INVALID_OPERATION;
+    if (name == NULL) {
+        return MA_INVALID_ARGS;
     }
 
-    ma_engine_listener_set_world_up(&handle->engine, index, x, y, z);
-    return MA_SUCCESS;
-}
+    ma_mutex_lock(&registry->lock);
 
-MANET_API ma_result manet_engine_get_listener_world_up(manet_engine* handle, ma_uint32 index, float* x, float* y, float* z)
-{
-    if (manet_validate_engine(handle) != MA_SUCCESS || x == NULL || y == NULL || z == NULL) {
-        return MA_INVALID_OPERATION;
+    manet_registered_data* entry = NULL;
+    manet_registered_data** link = &registry->head;
+    while (*link != NULL) {
+        if (strcmp((*link)->name, name) == 0) {
+            entry = *link;
+            *link = entry->next;
+            entry->next = NULL;
+            break;
+        }
+
+        link = &(*link)->next;
     }
 
-    ma_vec3f up = ma_engine_listener_get_world_up(&handle->engine, index);
-    *x = up.x;
-    *y = up.y;
-    *z = up.z;
+    if (entry != NULL) {
+        ma_resource_manager_unregister_data(registry->resourceManager, entry->name);
+    }
 
-    return MA_SUCCESS;
-}
+    ma_mutex_unlock(&registry->lock);
 
-MANET_API ma_result manet_engine_set_listener_velocity(manet_engine* handle, ma_uint32 index, float x, float y, float z)
-{
-    if (manet_validate_engine(handle) != MA_SUCCESS) {
-        return MA_INVALID_OPERATION;
+    if (entry == NULL) {
+        return MA_DOES_NOT_EXIST;
     }
 
-    ma_engine_listener_set_velocity(&handle->engine, index, x, y, z);
+    /* Sounds still playing the asset keep their own reference to the bytes. */
+    manet_registered_data_release(entry);
     return MA_SUCCESS;
 }
 
-MANET_API ma_result manet_engine_get_listener_velocity(manet_engine* handle, ma_uint32 index, float* x, float* y, float* z)
+static ma_bool32 manet_data_registry_contains(manet_data_registry* registry, const char* name)
 {
-    if (manet_validate_engine(handle) != MA_SUCCESS || x == NULL || y == NULL || z == NULL) {
-        return MA_INVALID_OPERATION;
+    if (name == NULL) {
+        return MA_FALSE;
     }
 
-    ma_vec3f velocity = ma_engine_listener_get_velocity(&handle->engine, index);
-    *x = velocity.x;
-    *y = velocity.y;
-    *z = velocity.z;
+    ma_mutex_lock(&registry->lock);
+    ma_bool32 found = manet_data_registry_find(registry, name) != NULL;
+    ma_mutex_unlock(&registry->lock);
 
-    return MA_SUCCESS;
+    return found;
 }
 
-MANET_API ma_result manet_engine_set_listener_cone(manet_engine* handle, ma_uint32 index, float innerAngleInRadians, float outerAngleInRadians, float outerGain)
+/* Caller must hold the registry lock. */
+static manet_registered_data* manet_data_registry_find(manet_data_registry* registry, const char* name)
 {
-    if (manet_validate_engine(handle) != MA_SUCCESS) {
-        return MA_INVALID_OPERATION;
+    for (manet_registered_data* entry = registry->head; entry != NULL; entry = entry->next) {
+        if (strcmp(entry->name, name) == 0) {
+            return entry;
+        }
     }
 
-    ma_engine_listener_set_cone(&handle->engine, index, innerAngleInRadians, outerAngleInRadians, outerGain);
-    return MA_SUCCESS;
+    return NULL;
 }
 
-MANET_API ma_result manet_engine_get_listener_cone(manet_engine* handle, ma_uint32 index, float* innerAngleInRadians, float* outerAngleInRadians, float* outerGain)
+static manet_registered_data* manet_data_registry_acquire(manet_data_registry* registry, const char* name)
 {
-    if (manet_validate_engine(handle) != MA_SUCCESS || innerAngleInRadians == NULL || outerAngleInRadians == NULL || outerGain == NULL) {
-        return MA_INVALID_OPERATION;
+    ma_mutex_lock(&registry->lock);
+
+    manet_registered_data* entry = manet_data_registry_find(registry, name);
+    if (entry != NULL) {
+        ma_atomic_uint32_fetch_add(&entry->refCount, 1);
     }
 
-    ma_engine_listener_get_cone(&handle->engine, index, innerAngleInRadians, outerAngleInRadians, outerGain);
-    return MA_SUCCESS;
+    ma_mutex_unlock(&registry->lock);
+    return entry;
 }
 
-MANET_API ma_result manet_engine_set_listener_enabled(manet_engine* handle, ma_uint32 index, ma_bool32 isEnabled)
+static ma_result manet_data_registry_add_mapped(manet_data_registry* registry, const char* name, const ma_uint8* mapping, ma_uint64 mappingSize, size_t dataOffset, ma_uint64 frameCount, ma_format format, ma_uint32 channels, ma_uint32 sampleRate)
 {
-    if (manet_validate_engine(handle) != MA_SUCCESS) {
+    if (registry->resourceManager == NULL) {
         return MA_INVALID_OPERATION;
     }
 
-    ma_engine_listener_set_enabled(&handle->engine, index, isEnabled);
-    return MA_SUCCESS;
-}
+    /* Only the name is copied; the frames stay in the mapping, which the entry takes over on success. */
+    manet_registered_data* entry = manet_data_registry_alloc_entry(name, NULL, 0);
+    if (entry == NULL) {
+        return MA_OUT_OF_MEMORY;
+    }
 
-MANET_API ma_bool32 manet_engine_is_listener_enabled(manet_engine* handle, ma_uint32 index)
-{
-    if (manet_validate_engine(handle) != MA_SUCCESS) {
-        return MA_FALSE;
+    entry->data = (void*)(mapping + dataOffset);
+    entry->sizeInBytes = (size_t)(mappingSize - dataOffset);
+
+    ma_mutex_lock(&registry->lock);
+
+    ma_result result = MA_ALREADY_EXISTS;
+    if (manet_data_registry_find(registry, name) == NULL) {
+        result = ma_resource_manager_register_decoded_data(registry->resourceManager, entry->name, entry->data, frameCount, format, channels, sampleRate);
+        if (result == MA_SUCCESS) {
+            entry->mapping = mapping;
+            entry->mappingSize = mappingSize;
+            entry->cacheRegistry = registry;
+            entry->next = registry->head;
+            registry->head = entry;
+        }
     }
 
-    return ma_engine_listener_is_enabled(&handle->engine, index);
+    ma_mutex_unlock(&registry->lock);
+
+    if (result != MA_SUCCESS) {
+        manet_free(entry);
+    }
+
+    return result;
 }
 
-MANET_API manet_engine* manet_engine_create_with_options(
-    manet_context* contextHandle,
-    manet_resource_manager* resourceManagerHandle,
-    const char* playbackDeviceId,
-    ma_uint32 sampleRate,
-    ma_uint32 channelCount,
-    ma_uint32 periodSizeInFrames,
-    ma_uint32 periodSizeInMilliseconds,
-    ma_bool32 noAutoStart,
-    ma_bool32 noDevice)
+static void manet_registered_data_release(manet_registered_data* entry)
 {
-    ma_engine_config config = ma_engine_config_init();
-
-#if !defined(MA_NO_DEVICE_IO)
-    if (contextHandle != NULL) {
-        config.pContext = &contextHandle->context;
+    if (entry != NULL && ma_atomic_uint32_fetch_sub(&entry->refCount, 1) == 1) {
+        manet_unmap_file(entry->mapping, entry->mappingSize);
+        manet_free(entry);
     }
+}
 
-    ma_device_id playbackId;
-    ma_device_id* playbackIdPtr = NULL;
-    MA_ZERO_OBJECT(&playbackId);
+/* Drops a sound's reference. The last sound using a decoded-cache entry also takes it out of the registry, so cache
+   mappings stay registered only while something plays them; the next load maps the cache file again. */
+static void manet_registered_data_release_from_sound(manet_registered_data* entry)
+{
+    manet_data_registry* registry = (entry != NULL) ? entry->cacheRegistry : NULL;
+    if (registry != NULL) {
+        ma_mutex_lock(&registry->lock);
+
+        /* Only the registry and this sound remain. Sounds acquire under the lock, so no new reference can appear. */
+        if (ma_atomic_uint32_get(&entry->refCount) == 2) {
+            manet_registered_data** link = &registry->head;
+            while (*link != NULL && *link != entry) {
+                link = &(*link)->next;
+            }
 
-    if (playbackDeviceId != NULL && playbackDeviceId[0] != '\0') {
-        if (manet_device_id_from_hex(playbackDeviceId, &playbackId) == MA_FALSE) {
-            return NULL;
+            if (*link == entry) {
+                *link = entry->next;
+                entry->next = NULL;
+                ma_resource_manager_unregister_data(registry->resourceManager, entry->name);
+                ma_atomic_uint32_fetch_sub(&entry->refCount, 1);
+            }
         }
 
-        playbackIdPtr = &playbackId;
+        ma_mutex_unlock(&registry->lock);
     }
 
-    config.pPlaybackDeviceID = playbackIdPtr;
-#else
-    (void)playbackDeviceId;
-    (void)contextHandle;
-#endif
-    if (resourceManagerHandle != NULL) {
-        config.pResourceManager = &resourceManagerHandle->manager;
-    }
+    manet_registered_data_release(entry);
+}
 
-    if (sampleRate != 0) {
-        config.sampleRate = sampleRate;
+static ma_bool32 manet_vfs_init(manet_vfs* vfs, const manet_vfs_config* config, manet_asset_pack* pack)
+{
+    memset(vfs, 0, sizeof(*vfs));
+
+    if (config != NULL && (config->onOpen == NULL || config->onClose == NULL || config->onRead == NULL ||
+        config->onSeek == NULL || config->onTell == NULL || config->onSize == NULL)) {
+        return MA_FALSE;
     }
 
-    if (channelCount != 0) {
-        config.channels = channelCount;
+    if (config != NULL) {
+        vfs->config = *config;
     }
 
-    if (periodSizeInFrames != 0) {
-        config.periodSizeInFrames = periodSizeInFrames;
+    if (ma_default_vfs_init(&vfs->defaultVfs, NULL) != MA_SUCCESS) {
+        return MA_FALSE;
     }
 
-    if (periodSizeInMilliseconds != 0) {
-        config.periodSizeInMilliseconds = periodSizeInMilliseconds;
+    if (pack != NULL) {
+        ma_atomic_uint32_fetch_add(&pack->refCount, 1);
+        vfs->pack = pack;
     }
 
-    config.noAutoStart = noAutoStart;
-    config.noDevice = noDevice;
+    vfs->cb.onOpen = manet_vfs_on_open;
+    vfs->cb.onOpenW = manet_vfs_on_open_w;
+    vfs->cb.onClose = manet_vfs_on_close;
+    vfs->cb.onRead = manet_vfs_on_read;
+    vfs->cb.onWrite = manet_vfs_on_write;
+    vfs->cb.onSeek = manet_vfs_on_seek;
+    vfs->cb.onTell = manet_vfs_on_tell;
+    vfs->cb.onInfo = manet_vfs_on_info;
+    return MA_TRUE;
+}
 
-    return manet_engine_create_with_config(&config);
+static void manet_vfs_uninit(manet_vfs* vfs)
+{
+    manet_asset_pack_release(vfs->pack);
+    vfs->pack = NULL;
 }
 
-MANET_API manet_resource_manager* manet_resource_manager_create_with_config(const manet_resource_manager_config_simple* settings)
+static ma_result manet_vfs_open_utf8(manet_vfs* vfs, const char* path, const wchar_t* pathW, ma_uint32 openMode, ma_vfs_file* pFile)
 {
-    manet_resource_manager* handle = (manet_resource_manager*)manet_alloc(sizeof(*handle));
-    if (handle == NULL) {
-        return NULL;
+    *pFile = NULL;
+
+    manet_vfs_file* file = (manet_vfs_file*)manet_alloc(sizeof(*file));
+    if (file == NULL) {
+        return MA_OUT_OF_MEMORY;
+    }
+
+    memset(file, 0, sizeof(*file));
+
+    ma_result result;
+    if (vfs->pack != NULL && strncmp(path, MANET_ASSET_PACK_PREFIX, sizeof(MANET_ASSET_PACK_PREFIX) - 1) == 0) {
+        const manet_asset_pack_entry* entry = manet_asset_pack_find(vfs->pack, path + sizeof(MANET_ASSET_PACK_PREFIX) - 1);
+        if (entry == NULL) {
+            result = MA_DOES_NOT_EXIST;
+        } else if ((openMode & MA_OPEN_MODE_WRITE) != 0) {
+            result = MA_ACCESS_DENIED;
+        } else {
+            file->data = vfs->pack->data + entry->offset;
+            file->sizeInBytes = entry->sizeInBytes;
+            result = MA_SUCCESS;
+        }
+    } else if (vfs->config.onOpen != NULL) {
+        if ((openMode & MA_OPEN_MODE_WRITE) != 0) {
+            result = MA_ACCESS_DENIED;
+        } else {
+            file->isHostFile = MA_TRUE;
+            result = vfs->config.onOpen(vfs->config.userData, path, openMode, &file->inner);
+            if (result == MA_SUCCESS && file->inner == NULL) {
+                result = MA_DOES_NOT_EXIST;
+            }
+        }
+    } else if (pathW != NULL) {
+        result = ma_vfs_open_w(&vfs->defaultVfs, pathW, openMode, &file->inner);
+    } else {
+        result = ma_vfs_open(&vfs->defaultVfs, path, openMode, &file->inner);
     }
 
-    ma_resource_manager_config config = ma_resource_manager_config_init();
-    manet_apply_resource_manager_settings(&config, settings);
-
-    ma_result result = ma_resource_manager_init(&config, &handle->manager);
     if (result != MA_SUCCESS) {
-        manet_free(handle);
-        return NULL;
+        manet_free(file);
+        return result;
     }
 
-    return handle;
+    *pFile = (ma_vfs_file)file;
+    return MA_SUCCESS;
 }
 
-MANET_API manet_resource_manager* manet_resource_manager_create_default(void)
+static ma_result manet_vfs_on_open(ma_vfs* pVFS, const char* pFilePath, ma_uint32 openMode, ma_vfs_file* pFile)
 {
-    return manet_resource_manager_create_with_config(NULL);
+    return manet_vfs_open_utf8((manet_vfs*)pVFS, pFilePath, NULL, openMode, pFile);
 }
 
-MANET_API void manet_resource_manager_destroy(manet_resource_manager* handle)
+static ma_result manet_vfs_on_open_w(ma_vfs* pVFS, const wchar_t* pFilePath, ma_uint32 openMode, ma_vfs_file* pFile)
 {
-    if (handle == NULL) {
-        return;
+    char* path = manet_utf8_from_wide(pFilePath);
+    if (path == NULL) {
+        *pFile = NULL;
+        return MA_OUT_OF_MEMORY;
     }
 
-    ma_resource_manager_uninit(&handle->manager);
-    manet_free(handle);
+    /* The default VFS keeps the wide path so non-ASCII names still open on Windows. */
+    ma_result result = manet_vfs_open_utf8((manet_vfs*)pVFS, path, pFilePath, openMode, pFile);
+    manet_free(path);
+    return result;
 }
 
-MANET_API manet_context* manet_context_create_default(void)
+static ma_result manet_vfs_on_close(ma_vfs* pVFS, ma_vfs_file file)
 {
-    manet_context* handle = (manet_context*)manet_alloc(sizeof(*handle));
-    if (handle == NULL) {
-        return NULL;
-    }
+    manet_vfs* vfs = (manet_vfs*)pVFS;
+    manet_vfs_file* vfsFile = (manet_vfs_file*)file;
+    ma_result result = MA_SUCCESS;
 
-    ma_context_config config = ma_context_config_init();
-    ma_result result = ma_context_init(NULL, 0, &config, &handle->context);
-    if (result != MA_SUCCESS) {
-        manet_free(handle);
-        return NULL;
+    if (vfsFile->isHostFile) {
+        result = vfs->config.onClose(vfs->config.userData, vfsFile->inner);
+    } else if (vfsFile->data == NULL) {
+        result = ma_vfs_close(&vfs->defaultVfs, vfsFile->inner);
     }
 
-    return handle;
+    manet_free(vfsFile);
+    return result;
 }
 
-MANET_API manet_context* manet_context_create_with_backends(const ma_backend* backends, ma_uint32 backendCount)
+static ma_result manet_vfs_on_read(ma_vfs* pVFS, ma_vfs_file file, void* pDst, size_t sizeInBytes, size_t* pBytesRead)
 {
-    manet_context* handle = (manet_context*)manet_alloc(sizeof(*handle));
-    if (handle == NULL) {
-        return NULL;
+    manet_vfs* vfs = (manet_vfs*)pVFS;
+    manet_vfs_file* vfsFile = (manet_vfs_file*)file;
+    size_t bytesRead = 0;
+    ma_result result;
+
+    if (vfsFile->data != NULL) {
+        /* Pack entries are served straight from the mapping. */
+        ma_uint64 available = vfsFile->sizeInBytes - vfsFile->cursor;
+        bytesRead = (size_t)(available < sizeInBytes ? available : sizeInBytes);
+        memcpy(pDst, vfsFile->data + vfsFile->cursor, bytesRead);
+        vfsFile->cursor += bytesRead;
+        result = MA_SUCCESS;
+    } else if (vfsFile->isHostFile) {
+        result = vfs->config.onRead(vfs->config.userData, vfsFile->inner, pDst, sizeInBytes, &bytesRead);
+    } else {
+        result = ma_vfs_read(&vfs->defaultVfs, vfsFile->inner, pDst, sizeInBytes, &bytesRead);
     }
 
-    ma_context_config config = ma_context_config_init();
-
-    const ma_backend* backendList = NULL;
-    ma_uint32 listCount = 0;
-    if (backends != NULL && backendCount > 0) {
-        backendList = backends;
-        listCount = backendCount;
+    if (pBytesRead != NULL) {
+        *pBytesRead = bytesRead;
     }
 
-    ma_result result = ma_context_init(backendList, listCount, &config, &handle->context);
-    if (result != MA_SUCCESS) {
-        manet_free(handle);
-        return NULL;
+    if (result == MA_SUCCESS && bytesRead == 0 && sizeInBytes > 0) {
+        return MA_AT_END;
     }
 
-    return handle;
+    return result;
 }
 
-MANET_API void manet_context_destroy(manet_context* handle)
+static ma_result manet_vfs_on_write(ma_vfs* pVFS, ma_vfs_file file, const void* pSrc, size_t sizeInBytes, size_t* pBytesWritten)
 {
-    if (handle == NULL) {
-        return;
+    manet_vfs* vfs = (manet_vfs*)pVFS;
+    manet_vfs_file* vfsFile = (manet_vfs_file*)file;
+
+    if (vfsFile->data == NULL && !vfsFile->isHostFile) {
+        return ma_vfs_write(&vfs->defaultVfs, vfsFile->inner, pSrc, sizeInBytes, pBytesWritten);
     }
 
-    ma_context_uninit(&handle->context);
-    manet_free(handle);
-}
+    if (pBytesWritten != NULL) {
+        *pBytesWritten = 0;
+    }
+
+    return MA_ACCESS_DENIED;
+}
+
+static ma_result manet_vfs_on_seek(ma_vfs* pVFS, ma_vfs_file file, ma_int64 offset, ma_seek_origin origin)
+{
+    manet_vfs* vfs = (manet_vfs*)pVFS;
+    manet_vfs_file* vfsFile = (manet_vfs_file*)file;
+
+    if (vfsFile->isHostFile) {
+        return vfs->config.onSeek(vfs->config.userData, vfsFile->inner, offset, (ma_uint32)origin);
+    }
+
+    if (vfsFile->data == NULL) {
+        return ma_vfs_seek(&vfs->defaultVfs, vfsFile->inner, offset, origin);
+    }
+
+    ma_int64 base = 0;
+    if (origin == ma_seek_origin_current) {
+        base = (ma_int64)vfsFile->cursor;
+    } else if (origin == ma_seek_origin_end) {
+        base = (ma_int64)vfsFile->sizeInBytes;
+    }
+
+    ma_int64 target = base + offset;
+    if (target < 0 || (ma_uint64)target > vfsFile->sizeInBytes) {
+        return MA_BAD_SEEK;
+    }
+
+    vfsFile->cursor = (ma_uint64)target;
+    return MA_SUCCESS;
+}
+
+static ma_result manet_vfs_on_tell(ma_vfs* pVFS, ma_vfs_file file, ma_int64* pCursor)
+{
+    manet_vfs* vfs = (manet_vfs*)pVFS;
+    manet_vfs_file* vfsFile = (manet_vfs_file*)file;
+
+    *pCursor = 0;
+    if (vfsFile->isHostFile) {
+        return vfs->config.onTell(vfs->config.userData, vfsFile->inner, pCursor);
+    }
+
+    if (vfsFile->data == NULL) {
+        return ma_vfs_tell(&vfs->defaultVfs, vfsFile->inner, pCursor);
+    }
+
+    *pCursor = (ma_int64)vfsFile->cursor;
+    return MA_SUCCESS;
+}
+
+static ma_result manet_vfs_on_info(ma_vfs* pVFS, ma_vfs_file file, ma_file_info* pInfo)
+{
+    manet_vfs* vfs = (manet_vfs*)pVFS;
+    manet_vfs_file* vfsFile = (manet_vfs_file*)file;
+
+    pInfo->sizeInBytes = 0;
+    if (vfsFile->isHostFile) {
+        return vfs->config.onSize(vfs->config.userData, vfsFile->inner, &pInfo->sizeInBytes);
+    }
+
+    if (vfsFile->data == NULL) {
+        return ma_vfs_info(&vfs->defaultVfs, vfsFile->inner, pInfo);
+    }
+
+    pInfo->sizeInBytes = vfsFile->sizeInBytes;
+    return MA_SUCCESS;
+}
+
+static char* manet_utf8_from_wide(const wchar_t* text)
+{
+    /* wchar_t is UTF-16 on Windows and UTF-32 elsewhere. */
+    size_t length = 0;
+    while (text[length] != 0) {
+        length += 1;
+    }
+
+    char* utf8 = (char*)manet_alloc(length * 4 + 1);
+    if (utf8 == NULL) {
+        return NULL;
+    }
+
+    size_t out = 0;
+    for (size_t i = 0; i < length; i += 1) {
+        ma_uint32 cp = (ma_uint32)text[i];
+
+        if (sizeof(wchar_t) == 2 && cp >= 0xD800 && cp <= 0xDBFF && i + 1 < length) {
+            ma_uint32 low = (ma_uint32)text[i + 1];
+            if (low >= 0xDC00 && low <= 0xDFFF) {
+                cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                i += 1;
+            }
+        }
+
+        if (cp < 0x80) {
+            utf8[out++] = (char)cp;
+        } else if (cp < 0x800) {
+            utf8[out++] = (char)(0xC0 | (cp >> 6));
+            utf8[out++] = (char)(0x80 | (cp & 0x3F));
+        } else if (cp < 0x10000) {
+            utf8[out++] = (char)(0xE0 | (cp >> 12));
+            utf8[out++] = (char)(0x80 | ((cp >> 6) & 0x3F));
+            utf8[out++] = (char)(0x80 | (cp & 0x3F));
+        } else {
+            utf8[out++] = (char)(0xF0 | (cp >> 18));
+            utf8[out++] = (char)(0x80 | ((cp >> 12) & 0x3F));
+            utf8[out++] = (char)(0x80 | ((cp >> 6) & 0x3F));
+            utf8[out++] = (char)(0x80 | (cp & 0x3F));
+        }
+    }
+
+    utf8[out] = '\0';
+    return utf8;
+}
+
+static ma_uint32 manet_read_le32(const ma_uint8* p)
+{
+    return (ma_uint32)p[0] | ((ma_uint32)p[1] << 8) | ((ma_uint32)p[2] << 16) | ((ma_uint32)p[3] << 24);
+}
+
+static ma_uint64 manet_read_le64(const ma_uint8* p)
+{
+    return (ma_uint64)manet_read_le32(p) | ((ma_uint64)manet_read_le32(p + 4) << 32);
+}
+
+static void manet_write_le32(ma_uint8* p, ma_uint32 value)
+{
+    p[0] = (ma_uint8)value;
+    p[1] = (ma_uint8)(value >> 8);
+    p[2] = (ma_uint8)(value >> 16);
+    p[3] = (ma_uint8)(value >> 24);
+}
+
+static void manet_write_le64(ma_uint8* p, ma_uint64 value)
+{
+    manet_write_le32(p, (ma_uint32)value);
+    manet_write_le32(p + 4, (ma_uint32)(value >> 32));
+}
+
+static int manet_asset_pack_compare_names(const char* a, ma_uint32 aLength, const char* b, ma_uint32 bLength)
+{
+    int order = memcmp(a, b, aLength < bLength ? aLength : bLength);
+    if (order != 0) {
+        return order;
+    }
+
+    return (aLength > bLength) - (aLength < bLength);
+}
+
+static int manet_asset_pack_compare_entries(const void* a, const void* b)
+{
+    const manet_asset_pack_entry* left = (const manet_asset_pack_entry*)a;
+    const manet_asset_pack_entry* right = (const manet_asset_pack_entry*)b;
+    return manet_asset_pack_compare_names(left->name, left->nameLength, right->name, right->nameLength);
+}
+
+static const manet_asset_pack_entry* manet_asset_pack_find(const manet_asset_pack* pack, const char* name)
+{
+    size_t nameLength = strlen(name);
+    if (nameLength > 0xFFFFFFFFu) {
+        return NULL;
+    }
+
+    ma_uint32 lo = 0;
+    ma_uint32 hi = pack->entryCount;
+    while (lo < hi) {
+        ma_uint32 mid = lo + (hi - lo) / 2;
+        const manet_asset_pack_entry* entry = &pack->entries[mid];
+        int order = manet_asset_pack_compare_names(entry->name, entry->nameLength, name, (ma_uint32)nameLength);
+        if (order == 0) {
+            return entry;
+        }
+
+        if (order < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return NULL;
+}
+
+static ma_result manet_asset_pack_parse(manet_asset_pack* pack)
+{
+    const ma_uint8* data = pack->data;
+    ma_uint64 size = pack->sizeInBytes;
+
+    if (size < MANET_ASSET_PACK_HEADER_SIZE || memcmp(data, MANET_ASSET_PACK_MAGIC, 8) != 0) {
+        return MA_INVALID_FILE;
+    }
+
+    if (manet_read_le32(data + 8) != MANET_ASSET_PACK_VERSION) {
+        return MA_INVALID_FILE;
+    }
+
+    ma_uint32 entryCount = manet_read_le32(data + 12);
+    if ((ma_uint64)entryCount * MANET_ASSET_PACK_RECORD_SIZE > size - MANET_ASSET_PACK_HEADER_SIZE) {
+        return MA_INVALID_FILE;
+    }
+
+    if (entryCount > 0) {
+        pack->entries = (manet_asset_pack_entry*)manet_alloc(sizeof(*pack->entries) * entryCount);
+        if (pack->entries == NULL) {
+            return MA_OUT_OF_MEMORY;
+        }
+    }
+
+    for (ma_uint32 i = 0; i < entryCount; i += 1) {
+        const ma_uint8* record = data + MANET_ASSET_PACK_HEADER_SIZE + (size_t)i * MANET_ASSET_PACK_RECORD_SIZE;
+        ma_uint64 offset = manet_read_le64(record);
+        ma_uint64 sizeInBytes = manet_read_le64(record + 8);
+        ma_uint32 nameOffset = manet_read_le32(record + 16);
+        ma_uint32 nameLength = manet_read_le32(record + 20);
+
+        if (offset > size || sizeInBytes > size - offset || nameLength == 0 ||
+            nameOffset > size || nameLength > size - nameOffset) {
+            return MA_INVALID_FILE;
+        }
+
+        pack->entries[i].name = (const char*)data + nameOffset;
+        pack->entries[i].nameLength = nameLength;
+        pack->entries[i].offset = offset;
+        pack->entries[i].sizeInBytes = sizeInBytes;
+    }
+
+    pack->entryCount = entryCount;
+    if (entryCount > 1) {
+        qsort(pack->entries, entryCount, sizeof(*pack->entries), manet_asset_pack_compare_entries);
+    }
+
+    return MA_SUCCESS;
+}
+
+static manet_asset_pack* manet_asset_pack_map(const char* path, const wchar_t* pathW)
+{
+    manet_asset_pack* pack = (manet_asset_pack*)manet_alloc(sizeof(*pack));
+    if (pack == NULL) {
+        return NULL;
+    }
+
+    memset(pack, 0, sizeof(*pack));
+    ma_atomic_uint32_set(&pack->refCount, 1);
+
+    pack->data = manet_map_file(path, pathW, &pack->sizeInBytes);
+    if (pack->data == NULL || manet_asset_pack_parse(pack) != MA_SUCCESS) {
+        manet_asset_pack_release(pack);
+        return NULL;
+    }
+
+    return pack;
+}
+
+static const ma_uint8* manet_map_file(const char* path, const wchar_t* pathW, ma_uint64* pSize)
+{
+    const ma_uint8* data = NULL;
+    *pSize = 0;
+
+#if defined(_WIN32)
+    wchar_t* convertedPath = NULL;
+    if (pathW == NULL) {
+        convertedPath = manet_wide_from_utf8(path);
+        if (convertedPath == NULL) {
+            return NULL;
+        }
+
+        pathW = convertedPath;
+    }
+
+    HANDLE file = CreateFileW(pathW, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    manet_free(convertedPath);
+    if (file == INVALID_HANDLE_VALUE) {
+        return NULL;
+    }
+
+    LARGE_INTEGER fileSize;
+    HANDLE mapping = NULL;
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+        mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    }
+
+    if (mapping != NULL) {
+        data = (const ma_uint8*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (data != NULL) {
+            *pSize = (ma_uint64)fileSize.QuadPart;
+        }
+
+        CloseHandle(mapping);
+    }
+
+    CloseHandle(file);
+#else
+    char* convertedPath = NULL;
+    if (path == NULL) {
+        convertedPath = manet_utf8_from_wide(pathW);
+        if (convertedPath == NULL) {
+            return NULL;
+        }
+
+        path = convertedPath;
+    }
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    manet_free(convertedPath);
+    if (fd < 0) {
+        return NULL;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) == 0 && info.st_size > 0) {
+        void* view = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (view != MAP_FAILED) {
+            data = (const ma_uint8*)view;
+            *pSize = (ma_uint64)info.st_size;
+        }
+    }
+
+    /* The mapping stays valid after the descriptor is closed. */
+    close(fd);
+#endif
+
+    return data;
+}
+
+static void manet_unmap_file(const ma_uint8* data, ma_uint64 sizeInBytes)
+{
+    if (data == NULL) {
+        return;
+    }
+
+#if defined(_WIN32)
+    (void)sizeInBytes;
+    UnmapViewOfFile(data);
+#else
+    munmap((void*)data, (size_t)sizeInBytes);
+#endif
+}
+
+#if defined(_WIN32)
+static wchar_t* manet_wide_from_utf8(const char* text)
+{
+    int length = MultiByteToWideChar(CP_UTF8, 0, text, -1, NULL, 0);
+    if (length <= 0) {
+        return NULL;
+    }
+
+    wchar_t* wide = (wchar_t*)manet_alloc(sizeof(wchar_t) * (size_t)length);
+    if (wide != NULL) {
+        MultiByteToWideChar(CP_UTF8, 0, text, -1, wide, length);
+    }
+
+    return wide;
+}
+#endif
+
+static ma_uint64 manet_hash_bytes(const void* data, size_t sizeInBytes)
+{
+    /* FNV-1a; the content size is folded in by the caller's cache key as well. */
+    const ma_uint8* bytes = (const ma_uint8*)data;
+    ma_uint64 hash = 0xCBF29CE484222325ull;
+    for (size_t i = 0; i < sizeInBytes; i += 1) {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ull;
+    }
+
+    return hash;
+}
+
+/* Size and modification time of a file on disk. Fails for names only the VFS can resolve, which are then hashed on
+   every load. */
+static ma_bool32 manet_file_stamp(const char* path, const wchar_t* pathW, ma_uint64* pSize, ma_uint64* pTime)
+{
+#if defined(_WIN32)
+    wchar_t* convertedPath = NULL;
+    if (pathW == NULL) {
+        convertedPath = manet_wide_from_utf8(path);
+        if (convertedPath == NULL) {
+            return MA_FALSE;
+        }
+
+        pathW = convertedPath;
+    }
+
+    WIN32_FILE_ATTRIBUTE_DATA info;
+    BOOL found = GetFileAttributesExW(pathW, GetFileExInfoStandard, &info);
+    manet_free(convertedPath);
+    if (!found || (info.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0) {
+        return MA_FALSE;
+    }
+
+    *pSize = ((ma_uint64)info.nFileSizeHigh << 32) | info.nFileSizeLow;
+    *pTime = ((ma_uint64)info.ftLastWriteTime.dwHighDateTime << 32) | info.ftLastWriteTime.dwLowDateTime;
+#else
+    char* convertedPath = NULL;
+    if (path == NULL) {
+        convertedPath = manet_utf8_from_wide(pathW);
+        if (convertedPath == NULL) {
+            return MA_FALSE;
+        }
+
+        path = convertedPath;
+    }
+
+    struct stat info;
+    int statResult = stat(path, &info);
+    manet_free(convertedPath);
+    if (statResult != 0 || !S_ISREG(info.st_mode)) {
+        return MA_FALSE;
+    }
+
+    *pSize = (ma_uint64)info.st_size;
+#if defined(__APPLE__)
+    *pTime = (ma_uint64)info.st_mtimespec.tv_sec * 1000000000ull + (ma_uint64)info.st_mtimespec.tv_nsec;
+#else
+    *pTime = (ma_uint64)info.st_mtim.tv_sec * 1000000000ull + (ma_uint64)info.st_mtim.tv_nsec;
+#endif
+#endif
+
+    return MA_TRUE;
+}
+
+static ma_bool32 manet_decoded_cache_find_key(manet_data_registry* registry, const char* path, ma_uint64 sourceSize, ma_uint64 sourceTime, ma_uint64* pContentHash, ma_uint64* pContentSize)
+{
+    ma_bool32 found = MA_FALSE;
+    ma_mutex_lock(&registry->lock);
+
+    for (const manet_decoded_cache_key* key = registry->cacheKeys; key != NULL; key = key->next) {
+        if (strcmp(key->path, path) == 0) {
+            if (key->sourceSize == sourceSize && key->sourceTime == sourceTime) {
+                *pContentHash = key->contentHash;
+                *pContentSize = key->contentSize;
+                found = MA_TRUE;
+            }
+
+            break;
+        }
+    }
+
+    ma_mutex_unlock(&registry->lock);
+    return found;
+}
+
+static void manet_decoded_cache_remember_key(manet_data_registry* registry, const char* path, ma_uint64 sourceSize, ma_uint64 sourceTime, ma_uint64 contentHash, ma_uint64 contentSize)
+{
+    ma_mutex_lock(&registry->lock);
+
+    manet_decoded_cache_key* key = registry->cacheKeys;
+    while (key != NULL && strcmp(key->path, path) != 0) {
+        key = key->next;
+    }
+
+    if (key == NULL) {
+        size_t pathLength = strlen(path);
+        key = (manet_decoded_cache_key*)manet_alloc(sizeof(*key) + pathLength + 1);
+        if (key != NULL) {
+            memset(key, 0, sizeof(*key));
+            key->path = (char*)(key + 1);
+            memcpy(key->path, path, pathLength + 1);
+            key->next = registry->cacheKeys;
+            registry->cacheKeys = key;
+        }
+    }
+
+    if (key != NULL) {
+        key->sourceSize = sourceSize;
+        key->sourceTime = sourceTime;
+        key->contentHash = contentHash;
+        key->contentSize = contentSize;
+    }
+
+    ma_mutex_unlock(&registry->lock);
+}
+
+static ma_bool32 manet_decoded_cache_validate(const ma_uint8* data, ma_uint64 sizeInBytes, ma_format format, ma_uint32 channels, ma_uint32 sampleRate, ma_uint64* pFrameCount)
+{
+    if (sizeInBytes < MANET_DECODED_CACHE_HEADER_SIZE || memcmp(data, MANET_DECODED_CACHE_MAGIC, 8) != 0) {
+        return MA_FALSE;
+    }
+
+    if (manet_read_le32(data + 8) != MANET_DECODED_CACHE_VERSION || manet_read_le32(data + 12) != (ma_uint32)format ||
+        manet_read_le32(data + 16) != channels || manet_read_le32(data + 20) != sampleRate) {
+        return MA_FALSE;
+    }
+
+    ma_uint64 frameCount = manet_read_le64(data + 24);
+    ma_uint64 bytesPerFrame = ma_get_bytes_per_frame(format, channels);
+    if (frameCount == 0 || frameCount > (sizeInBytes - MANET_DECODED_CACHE_HEADER_SIZE) / bytesPerFrame) {
+        return MA_FALSE;
+    }
+
+    *pFrameCount = frameCount;
+    return MA_TRUE;
+}
+
+static ma_result manet_decoded_cache_write(const char* filePath, const void* frames, ma_uint64 frameCount, ma_format format, ma_uint32 channels, ma_uint32 sampleRate)
+{
+    ma_uint8 header[MANET_DECODED_CACHE_HEADER_SIZE];
+    memcpy(header, MANET_DECODED_CACHE_MAGIC, 8);
+    manet_write_le32(header + 8, MANET_DECODED_CACHE_VERSION);
+    manet_write_le32(header + 12, (ma_uint32)format);
+    manet_write_le32(header + 16, channels);
+    manet_write_le32(header + 20, sampleRate);
+    manet_write_le64(header + 24, frameCount);
+
+    return manet_write_file_replace(filePath, header, sizeof(header), frames, (size_t)(frameCount * ma_get_bytes_per_frame(format, channels)));
+}
+
+/* Writes header and data to a private temporary file, then renames it over filePath, so concurrent processes never
+   map a partially written file. */
+static ma_result manet_write_file_replace(const char* filePath, const void* header, size_t headerSize, const void* data, size_t dataSize)
+{
+    static ma_atomic_uint32 s_tempCounter;
+
+    size_t pathLength = strlen(filePath);
+    char* tempPath = (char*)manet_alloc(pathLength + 32);
+    if (tempPath == NULL) {
+        return MA_OUT_OF_MEMORY;
+    }
+
+#if defined(_WIN32)
+    unsigned long processId = (unsigned long)GetCurrentProcessId();
+#else
+    unsigned long processId = (unsigned long)getpid();
+#endif
+    snprintf(tempPath, pathLength + 32, "%s.%lu.%u.tmp", filePath, processId, (unsigned int)ma_atomic_uint32_fetch_add(&s_tempCounter, 1));
+
+    ma_result result = MA_IO_ERROR;
+
+#if defined(_WIN32)
+    wchar_t* tempPathW = manet_wide_from_utf8(tempPath);
+    wchar_t* filePathW = manet_wide_from_utf8(filePath);
+    FILE* file = NULL;
+    if (tempPathW != NULL && filePathW != NULL) {
+        file = _wfopen(tempPathW, L"wb");
+    }
+#else
+    FILE* file = fopen(tempPath, "wb");
+#endif
+
+    if (file != NULL) {
+        ma_bool32 written = fwrite(header, 1, headerSize, file) == headerSize && fwrite(data, 1, dataSize, file) == dataSize;
+        written = (fclose(file) == 0) && written;
+
+#if defined(_WIN32)
+        if (written && MoveFileExW(tempPathW, filePathW, MOVEFILE_REPLACE_EXISTING)) {
+            result = MA_SUCCESS;
+        } else {
+            DeleteFileW(tempPathW);
+        }
+#else
+        if (written && rename(tempPath, filePath) == 0) {
+            result = MA_SUCCESS;
+        } else {
+            remove(tempPath);
+        }
+#endif
+    }
+
+#if defined(_WIN32)
+    manet_free(tempPathW);
+    manet_free(filePathW);
+#endif
+    manet_free(tempPath);
+    return result;
+}
+
+static char* manet_decoded_cache_key_file_path(const char* directory, const char* path)
+{
+    size_t directoryLength = strlen(directory);
+    size_t filePathSize = directoryLength + 32;
+    char* filePath = (char*)manet_alloc(filePathSize);
+    if (filePath != NULL) {
+        snprintf(filePath, filePathSize, "%s/%016llx.key", directory, (unsigned long long)manet_hash_bytes(path, strlen(path)));
+    }
+
+    return filePath;
+}
+
+static ma_bool32 manet_decoded_cache_read_key_file(const char* directory, const char* path, ma_uint64 sourceSize, ma_uint64 sourceTime, ma_uint64* pContentHash, ma_uint64* pContentSize)
+{
+    char* filePath = manet_decoded_cache_key_file_path(directory, path);
+    if (filePath == NULL) {
+        return MA_FALSE;
+    }
+
+    ma_uint64 mappingSize = 0;
+    const ma_uint8* mapping = manet_map_file(filePath, NULL, &mappingSize);
+    manet_free(filePath);
+    if (mapping == NULL) {
+        return MA_FALSE;
+    }
+
+    size_t pathLength = strlen(path);
+    ma_bool32 found = mappingSize == MANET_DECODED_CACHE_KEY_HEADER_SIZE + pathLength &&
+        memcmp(mapping, MANET_DECODED_CACHE_KEY_MAGIC, 8) == 0 &&
+        manet_read_le32(mapping + 8) == MANET_DECODED_CACHE_KEY_VERSION &&
+        manet_read_le32(mapping + 12) == pathLength &&
+        manet_read_le64(mapping + 16) == sourceSize &&
+        manet_read_le64(mapping + 24) == sourceTime &&
+        memcmp(mapping + MANET_DECODED_CACHE_KEY_HEADER_SIZE, path, pathLength) == 0;
+
+    if (found) {
+        *pContentHash = manet_read_le64(mapping + 32);
+        *pContentSize = manet_read_le64(mapping + 40);
+    }
+
+    manet_unmap_file(mapping, mappingSize);
+    return found;
+}
+
+static void manet_decoded_cache_write_key_file(const char* directory, const char* path, ma_uint64 sourceSize, ma_uint64 sourceTime, ma_uint64 contentHash, ma_uint64 contentSize)
+{
+    char* filePath = manet_decoded_cache_key_file_path(directory, path);
+    if (filePath == NULL) {
+        return;
+    }
+
+    ma_uint8 header[MANET_DECODED_CACHE_KEY_HEADER_SIZE];
+    size_t pathLength = strlen(path);
+    memcpy(header, MANET_DECODED_CACHE_KEY_MAGIC, 8);
+    manet_write_le32(header + 8, MANET_DECODED_CACHE_KEY_VERSION);
+    manet_write_le32(header + 12, (ma_uint32)pathLength);
+    manet_write_le64(header + 16, sourceSize);
+    manet_write_le64(header + 24, sourceTime);
+    manet_write_le64(header + 32, contentHash);
+    manet_write_le64(header + 40, contentSize);
+
+    /* Best effort: without the key file the next process hashes the source again. */
+    manet_write_file_replace(filePath, header, sizeof(header), path, pathLength);
+    manet_free(filePath);
+}
+
+/* Resolves a Decode load through the on-disk cache and returns the registered cache entry to load from instead,
+   with a reference held for the sound. Returns NULL to fall back to a normal load. The source is only read and hashed
+   when its size or modification time changed since the last load, in this process or in an earlier one that left a
+   key file in the cache directory; without allowPopulate (async loads) the source is never read on the caller's
+   thread, so only sources with a matching key use the cache. */
+static manet_registered_data* manet_decoded_cache_acquire(manet_engine* engineHandle, const char* path, const wchar_t* pathW, ma_bool32 allowPopulate)
+{
+    ma_resource_manager* resourceManager = ma_engine_get_resource_manager(&engineHandle->engine);
+    ma_format format = resourceManager->config.decodedFormat == ma_format_s16 ? ma_format_s16 : ma_format_f32;
+    ma_uint32 channels = ma_engine_get_channels(&engineHandle->engine);
+    ma_uint32 sampleRate = ma_engine_get_sample_rate(&engineHandle->engine);
+
+    char* keyPath = (path != NULL) ? NULL : manet_utf8_from_wide(pathW);
+    const char* sourceKey = (path != NULL) ? path : keyPath;
+    ma_uint64 sourceSize = 0;
+    ma_uint64 sourceTime = 0;
+    ma_bool32 hasStamp = sourceKey != NULL && manet_file_stamp(path, pathW, &sourceSize, &sourceTime);
+
+    ma_uint64 contentHash = 0;
+    ma_uint64 contentSize = 0;
+    void* encoded = NULL;
+    size_t encodedSize = 0;
+    ma_result result;
+
+    ma_bool32 isKeyKnown = MA_FALSE;
+    if (hasStamp) {
+        isKeyKnown = manet_decoded_cache_find_key(engineHandle->registry, sourceKey, sourceSize, sourceTime, &contentHash, &contentSize);
+        if (!isKeyKnown && manet_decoded_cache_read_key_file(engineHandle->decodedCacheDirectory, sourceKey, sourceSize, sourceTime, &contentHash, &contentSize)) {
+            manet_decoded_cache_remember_key(engineHandle->registry, sourceKey, sourceSize, sourceTime, contentHash, contentSize);
+            isKeyKnown = MA_TRUE;
+        }
+    }
+
+    if (!isKeyKnown) {
+        if (!allowPopulate) {
+            manet_free(keyPath);
+            return NULL;
+        }
+
+        result = (path != NULL)
+            ? ma_vfs_open_and_read_file(resourceManager->config.pVFS, path, &encoded, &encodedSize, NULL)
+            : ma_vfs_open_and_read_file_w(resourceManager->config.pVFS, pathW, &encoded, &encodedSize, NULL);
+        if (result != MA_SUCCESS || encodedSize == 0) {
+            ma_free(encoded, NULL);
+            manet_free(keyPath);
+            return NULL;
+        }
+
+        contentHash = manet_hash_bytes(encoded, encodedSize);
+        contentSize = encodedSize;
+        if (hasStamp) {
+            manet_decoded_cache_remember_key(engineHandle->registry, sourceKey, sourceSize, sourceTime, contentHash, contentSize);
+            manet_decoded_cache_write_key_file(engineHandle->decodedCacheDirectory, sourceKey, sourceSize, sourceTime, contentHash, contentSize);
+        }
+    }
+
+    manet_free(keyPath);
+
+    char fileName[96];
+    snprintf(fileName, sizeof(fileName), "%016llx-%llx-%s-%uch-%uhz.pcm",
+        (unsigned long long)contentHash, (unsigned long long)contentSize,
+        format == ma_format_s16 ? "s16" : "f32", (unsigned int)channels, (unsigned int)sampleRate);
+
+    char name[128];
+    snprintf(name, sizeof(name), "%s%s", MANET_DECODED_CACHE_PREFIX, fileName);
+
+    /* Another sound already mapped this content. */
+    manet_registered_data* entry = manet_data_registry_acquire(engineHandle->registry, name);
+    if (entry != NULL) {
+        ma_free(encoded, NULL);
+        return entry;
+    }
+
+    size_t directoryLength = strlen(engineHandle->decodedCacheDirectory);
+    char* filePath = (char*)manet_alloc(directoryLength + sizeof(fileName) + 2);
+    if (filePath == NULL) {
+        ma_free(encoded, NULL);
+        return NULL;
+    }
+
+    snprintf(filePath, directoryLength + sizeof(fileName) + 2, "%s/%s", engineHandle->decodedCacheDirectory, fileName);
+
+    ma_uint64 mappingSize = 0;
+    ma_uint64 frameCount = 0;
+    const ma_uint8* mapping = manet_map_file(filePath, NULL, &mappingSize);
+    if (mapping != NULL && !manet_decoded_cache_validate(mapping, mappingSize, format, channels, sampleRate, &frameCount)) {
+        manet_unmap_file(mapping, mappingSize);
+        mapping = NULL;
+    }
+
+    /* A remembered key skipped the read, but the cache file is gone; decode from the source after all. */
+    if (mapping == NULL && allowPopulate && encoded == NULL) {
+        result = (path != NULL)
+            ? ma_vfs_open_and_read_file(resourceManager->config.pVFS, path, &encoded, &encodedSize, NULL)
+            : ma_vfs_open_and_read_file_w(resourceManager->config.pVFS, pathW, &encoded, &encodedSize, NULL);
+        if (result != MA_SUCCESS) {
+            ma_free(encoded, NULL);
+            encoded = NULL;
+        }
+    }
+
+    if (mapping == NULL && allowPopulate && encoded != NULL) {
+        ma_decoder_config decoderConfig = ma_decoder_config_init(format, channels, sampleRate);
+        void* frames = NULL;
+        if (ma_decode_memory(encoded, encodedSize, &decoderConfig, &frameCount, &frames) == MA_SUCCESS && frameCount > 0 &&
+            manet_decoded_cache_write(filePath, frames, frameCount, format, channels, sampleRate) == MA_SUCCESS) {
+            mapping = manet_map_file(filePath, NULL, &mappingSize);
+            if (mapping != NULL && !manet_decoded_cache_validate(mapping, mappingSize, format, channels, sampleRate, &frameCount)) {
+                manet_unmap_file(mapping, mappingSize);
+                mapping = NULL;
+            }
+        }
+
+        ma_free(frames, NULL);
+    }
+
+    ma_free(encoded, NULL);
+    manet_free(filePath);
+
+    if (mapping == NULL) {
+        return NULL;
+    }
+
+    result = manet_data_registry_add_mapped(engineHandle->registry, name, mapping, mappingSize, MANET_DECODED_CACHE_HEADER_SIZE, frameCount, format, channels, sampleRate);
+    if (result != MA_SUCCESS) {
+        manet_unmap_file(mapping, mappingSize);
+        if (result != MA_ALREADY_EXISTS) {
+            return NULL;
+        }
+    }
+
+    /* Lost a race with another thread registering the same content; its mapping is used instead. */
+    return manet_data_registry_acquire(engineHandle->registry, name);
+}
+
+static void manet_asset_pack_release(manet_asset_pack* pack)
+{
+    if (pack == NULL || ma_atomic_uint32_fetch_sub(&pack->refCount, 1) != 1) {
+        return;
+    }
+
+    manet_unmap_file(pack->data, pack->sizeInBytes);
+    manet_free(pack->entries);
+    manet_free(pack);
+}
+
+static ma_result manet_resource_cache_init(manet_resource_cache* cache, ma_resource_manager* resourceManager)
+{
+    memset(cache, 0, sizeof(*cache));
+    cache->resourceManager = resourceManager;
+
+    return ma_mutex_init(&cache->lock);
+}
+
+static void manet_resource_cache_uninit(manet_resource_cache* cache)
+{
+    ma_mutex_lock(&cache->lock);
+    while (cache->head != NULL) {
+        manet_resource_cache_remove_entry(cache, cache->head);
+    }
+    ma_mutex_unlock(&cache->lock);
+
+    manet_free(cache->index);
+    ma_mutex_uninit(&cache->lock);
+}
+
+static void manet_resource_cache_on_sound_loaded(manet_resource_cache* cache, manet_sound* soundHandle)
+{
+    ma_resource_manager_data_source* dataSource = soundHandle->sound.pResourceManagerDataSource;
+    if (dataSource == NULL || (soundHandle->initFlags & MA_SOUND_FLAG_STREAM) != 0) {
+        return;
+    }
+
+    ma_resource_manager_data_buffer* dataBuffer = &dataSource->backend.buffer;
+    ma_resource_manager_data_buffer_node* node = dataBuffer->pNode;
+    if (node == NULL) {
+        return;
+    }
+
+    soundHandle->cache = cache;
+
+    /* The new sound holds one reference; any other means the node was already resident. */
+    if (ma_atomic_load_32(&node->refCount) > 1) {
+        ma_atomic_uint64_fetch_add(&cache->hits, 1);
+    } else {
+        ma_atomic_uint64_fetch_add(&cache->misses, 1);
+    }
+
+    /* Registered data is owned by the registry, which must stay free to release it. */
+    if (!node->isDataOwnedByResourceManager) {
+        return;
+    }
+
+    ma_mutex_lock(&cache->lock);
+
+    if (cache->budgetInBytes == 0) {
+        ma_mutex_unlock(&cache->lock);
+        return;
+    }
+
+    manet_cache_entry* entry = manet_resource_cache_find(cache, node);
+    if (entry != NULL) {
+        /* Move to the front. */
+        if (entry != cache->head) {
+            entry->prev->next = entry->next;
+            if (entry->next != NULL) {
+                entry->next->prev = entry->prev;
+            } else {
+                cache->tail = entry->prev;
+            }
+
+            entry->prev = NULL;
+            entry->next = cache->head;
+            cache->head->prev = entry;
+            cache->head = entry;
+        }
+
+        manet_resource_cache_update_entry_size(cache, entry);
+    } else {
+        entry = (manet_cache_entry*)manet_alloc(sizeof(*entry));
+        if (entry != NULL) {
+            memset(entry, 0, sizeof(*entry));
+            if (ma_resource_manager_data_buffer_init_copy(cache->resourceManager, dataBuffer, &entry->buffer) != MA_SUCCESS) {
+                manet_free(entry);
+            } else if (manet_resource_cache_index_insert(cache, entry) != MA_SUCCESS) {
+                ma_resource_manager_data_buffer_uninit(&entry->buffer);
+                manet_data_buffer_wait_for_jobs(&entry->buffer);
+                manet_free(entry);
+            } else {
+                entry->isSettled = MA_TRUE;
+                entry->next = cache->head;
+                if (cache->head != NULL) {
+                    cache->head->prev = entry;
+                } else {
+                    cache->tail = entry;
+                }
+
+                cache->head = entry;
+                cache->entryCount += 1;
+                manet_resource_cache_update_entry_size(cache, entry);
+            }
+        }
+    }
+
+    ma_mutex_unlock(&cache->lock);
+
+    manet_resource_cache_trim(cache, MA_FALSE);
+}
+
+static void manet_resource_cache_trim(manet_resource_cache* cache, ma_bool32 releaseAll)
+{
+    ma_mutex_lock(&cache->lock);
+
+    if (releaseAll) {
+        while (cache->head != NULL) {
+            manet_resource_cache_remove_entry(cache, cache->head);
+        }
+
+        ma_mutex_unlock(&cache->lock);
+        return;
+    }
+
+    manet_resource_cache_update_unsettled_sizes(cache);
+
+    /* The common case on every sound destroy: under budget, nothing to walk. */
+    if (cache->budgetInBytes == 0 || cache->entryBytes <= cache->budgetInBytes) {
+        ma_mutex_unlock(&cache->lock);
+        return;
+    }
+
+    manet_cache_entry* entry = cache->tail;
+    while (entry != NULL && cache->entryBytes > cache->budgetInBytes) {
+        manet_cache_entry* prev = entry->prev;
+
+        /* Only evict nodes nothing but the cache still references; evicting the others would not free anything. */
+        if (ma_atomic_load_32(&entry->buffer.pNode->refCount) == 1) {
+            manet_resource_cache_remove_entry(cache, entry);
+            ma_atomic_uint64_fetch_add(&cache->evictions, 1);
+        }
+
+        entry = prev;
+    }
+
+    ma_mutex_unlock(&cache->lock);
+}
+
+static void manet_resource_cache_remove_entry(manet_resource_cache* cache, manet_cache_entry* entry)
+{
+    if (entry->prev != NULL) {
+        entry->prev->next = entry->next;
+    } else {
+        cache->head = entry->next;
+    }
+
+    if (entry->next != NULL) {
+        entry->next->prev = entry->prev;
+    } else {
+        cache->tail = entry->prev;
+    }
+
+    manet_resource_cache_index_remove(cache, entry);
+    cache->entryCount -= 1;
+    cache->entryBytes -= entry->sizeInBytes;
+    if (!entry->isSettled) {
+        cache->unsettledCount -= 1;
+    }
+
+    ma_resource_manager_data_buffer_uninit(&entry->buffer);
+    manet_data_buffer_wait_for_jobs(&entry->buffer);
+    manet_free(entry);
+}
+
+/* Async and paged nodes grow while they decode, so the size is refreshed each time the entry is used again and the
+   entry is marked unsettled until the node's load has finished. */
+static void manet_resource_cache_update_entry_size(manet_resource_cache* cache, manet_cache_entry* entry)
+{
+    ma_resource_manager_data_buffer_node* node = entry->buffer.pNode;
+    ma_bool32 isSettled = ma_atomic_load_i32(&node->result) != MA_BUSY;
+    ma_uint64 sizeInBytes = manet_data_buffer_node_size(node);
+
+    cache->entryBytes = cache->entryBytes - entry->sizeInBytes + sizeInBytes;
+    entry->sizeInBytes = sizeInBytes;
+
+    if (isSettled != entry->isSettled) {
+        cache->unsettledCount = isSettled ? cache->unsettledCount - 1 : cache->unsettledCount + 1;
+        entry->isSettled = isSettled;
+    }
+}
+
+static void manet_resource_cache_update_unsettled_sizes(manet_resource_cache* cache)
+{
+    for (manet_cache_entry* entry = cache->head; entry != NULL && cache->unsettledCount > 0; entry = entry->next) {
+        if (!entry->isSettled) {
+            manet_resource_cache_update_entry_size(cache, entry);
+        }
+    }
+}
+
+static manet_cache_entry* manet_resource_cache_find(manet_resource_cache* cache, ma_resource_manager_data_buffer_node* node)
+{
+    if (cache->indexCapacity == 0) {
+        return NULL;
+    }
+
+    manet_cache_entry* entry = cache->index[node->hashedName32 & (cache->indexCapacity - 1)];
+    while (entry != NULL && entry->buffer.pNode != node) {
+        entry = entry->indexNext;
+    }
+
+    return entry;
+}
+
+/* The index is a power-of-two bucket array that doubles once it holds as many entries as buckets. */
+static ma_result manet_resource_cache_index_insert(manet_resource_cache* cache, manet_cache_entry* entry)
+{
+    if (cache->entryCount >= cache->indexCapacity) {
+        ma_uint32 capacity = cache->indexCapacity == 0 ? 16 : cache->indexCapacity * 2;
+        manet_cache_entry** index = (manet_cache_entry**)manet_alloc(sizeof(*index) * capacity);
+        if (index != NULL) {
+            memset(index, 0, sizeof(*index) * capacity);
+            for (manet_cache_entry* existing = cache->head; existing != NULL; existing = existing->next) {
+                ma_uint32 bucket = existing->buffer.pNode->hashedName32 & (capacity - 1);
+                existing->indexNext = index[bucket];
+                index[bucket] = existing;
+            }
+
+            manet_free(cache->index);
+            cache->index = index;
+            cache->indexCapacity = capacity;
+        } else if (cache->indexCapacity == 0) {
+            return MA_OUT_OF_MEMORY;
+        }
+    }
+
+    ma_uint32 bucket = entry->buffer.pNode->hashedName32 & (cache->indexCapacity - 1);
+    entry->indexNext = cache->index[bucket];
+    cache->index[bucket] = entry;
+    return MA_SUCCESS;
+}
+
+static void manet_resource_cache_index_remove(manet_resource_cache* cache, manet_cache_entry* entry)
+{
+    manet_cache_entry** link = &cache->index[entry->buffer.pNode->hashedName32 & (cache->indexCapacity - 1)];
+    while (*link != entry) {
+        link = &(*link)->indexNext;
+    }
+
+    *link = entry->indexNext;
+}
+
+static void manet_resource_cache_measure_node(ma_resource_manager_data_buffer_node* node, ma_uint32* bufferCount, ma_uint64* residentBytes)
+{
+    while (node != NULL) {
+        *bufferCount += 1;
+        *residentBytes += manet_data_buffer_node_size(node);
+        manet_resource_cache_measure_node(node->pChildLo, bufferCount, residentBytes);
+        node = node->pChildHi;
+    }
+}
+
+static void manet_resource_cache_measure(manet_resource_cache* cache, ma_uint32* bufferCount, ma_uint64* residentBytes)
+{
+    ma_uint32 count = 0;
+    ma_uint64 bytes = 0;
+
+    ma_mutex_lock(&cache->resourceManager->dataBufferBSTLock);
+    manet_resource_cache_measure_node(cache->resourceManager->pRootDataBufferNode, &count, &bytes);
+    ma_mutex_unlock(&cache->resourceManager->dataBufferBSTLock);
+
+    if (bufferCount != NULL) {
+        *bufferCount = count;
+    }
+
+    if (residentBytes != NULL) {
+        *residentBytes = bytes;
+    }
+}
+
+static ma_uint64 manet_data_buffer_node_size(ma_resource_manager_data_buffer_node* node)
+{
+    const ma_resource_manager_data_supply* supply = &node->data;
+
+    switch ((ma_resource_manager_data_supply_type)ma_atomic_load_i32(&node->data.type)) {
+        case ma_resource_manager_data_supply_type_encoded:
+            return supply->backend.encoded.sizeInBytes;
+        case ma_resource_manager_data_supply_type_decoded:
+            return supply->backend.decoded.totalFrameCount * ma_get_bytes_per_frame(supply->backend.decoded.format, supply->backend.decoded.channels);
+        case ma_resource_manager_data_supply_type_decoded_paged:
+            return supply->backend.decodedPaged.decodedFrameCount * ma_get_bytes_per_frame(supply->backend.decodedPaged.data.format, supply->backend.decodedPaged.data.channels);
+        default:
+            return 0;
+    }
+}
+
+static manet_job_monitor* manet_job_monitor_start(ma_resource_manager* resourceManager, ma_uint32 workerCount, size_t stackSize)
+{
+    manet_job_monitor* monitor = (manet_job_monitor*)manet_alloc(sizeof(*monitor));
+    if (monitor == NULL) {
+        return NULL;
+    }
+
+    memset(monitor, 0, sizeof(*monitor));
+    monitor->resourceManager = resourceManager;
+    monitor->workerCount = workerCount;
+    monitor->capacity = resourceManager->config.jobQueueCapacity;
+    monitor->stats.workerCount = workerCount;
+
+    monitor->ring = (manet_queued_job*)manet_alloc(sizeof(*monitor->ring) * monitor->capacity);
+    if (monitor->ring == NULL) {
+        manet_free(monitor);
+        return NULL;
+    }
+
+    if (ma_mutex_init(&monitor->ringLock) != MA_SUCCESS) {
+        manet_free(monitor->ring);
+        manet_free(monitor);
+        return NULL;
+    }
+
+    if (ma_mutex_init(&monitor->statsLock) != MA_SUCCESS) {
+        ma_mutex_uninit(&monitor->ringLock);
+        manet_free(monitor->ring);
+        manet_free(monitor);
+        return NULL;
+    }
+
+    if (ma_semaphore_init(0, &monitor->filledSlots) != MA_SUCCESS) {
+        ma_mutex_uninit(&monitor->statsLock);
+        ma_mutex_uninit(&monitor->ringLock);
+        manet_free(monitor->ring);
+        manet_free(monitor);
+        return NULL;
+    }
+
+    if (ma_semaphore_init((int)monitor->capacity, &monitor->freeSlots) != MA_SUCCESS) {
+        ma_semaphore_uninit(&monitor->filledSlots);
+        ma_mutex_uninit(&monitor->statsLock);
+        ma_mutex_uninit(&monitor->ringLock);
+        manet_free(monitor->ring);
+        manet_free(monitor);
+        return NULL;
+    }
+
+    ma_timer_init(&monitor->timer);
+
+    /* From here on manet_job_monitor_stop can unwind whatever was started. */
+    for (ma_uint32 i = 0; i < workerCount; i += 1) {
+        if (ma_thread_create(&monitor->workers[i], ma_thread_priority_normal, stackSize, manet_job_monitor_work, monitor, &resourceManager->config.allocationCallbacks) != MA_SUCCESS) {
+            manet_job_monitor_stop(monitor);
+            return NULL;
+        }
+
+        monitor->runningWorkers += 1;
+    }
+
+    if (ma_thread_create(&monitor->dispatcher, ma_thread_priority_normal, stackSize, manet_job_monitor_dispatch, monitor, &resourceManager->config.allocationCallbacks) != MA_SUCCESS) {
+        manet_job_monitor_stop(monitor);
+        return NULL;
+    }
+
+    monitor->isDispatcherRunning = MA_TRUE;
+    return monitor;
+}
+
+/* Must run before ma_resource_manager_uninit: jobs still queued are processed first, as miniaudio's own threads do. */
+static void manet_job_monitor_stop(manet_job_monitor* monitor)
+{
+    if (monitor == NULL) {
+        return;
+    }
+
+    if (monitor->isDispatcherRunning) {
+        /* The quit job is never removed from the queue, so ma_resource_manager_uninit can still post its own. */
+        ma_resource_manager_post_job_quit(monitor->resourceManager);
+        ma_thread_wait(&monitor->dispatcher);
+    }
+
+    ma_mutex_lock(&monitor->ringLock);
+    monitor->isStopping = MA_TRUE;
+    ma_mutex_unlock(&monitor->ringLock);
+
+    for (ma_uint32 i = 0; i < monitor->runningWorkers; i += 1) {
+        ma_semaphore_release(&monitor->filledSlots);
+    }
+
+    for (ma_uint32 i = 0; i < monitor->runningWorkers; i += 1) {
+        ma_thread_wait(&monitor->workers[i]);
+    }
+
+    while (monitor->decodes != NULL) {
+        manet_decode_timing* next = monitor->decodes->next;
+        manet_free(monitor->decodes);
+        monitor->decodes = next;
+    }
+
+    ma_semaphore_uninit(&monitor->freeSlots);
+    ma_semaphore_uninit(&monitor->filledSlots);
+    ma_mutex_uninit(&monitor->statsLock);
+    ma_mutex_uninit(&monitor->ringLock);
+    manet_free(monitor->ring);
+    manet_free(monitor);
+}
+
+static ma_thread_result MA_THREADCALL manet_job_monitor_dispatch(void* userData)
+{
+    manet_job_monitor* monitor = (manet_job_monitor*)userData;
+
+    for (;;) {
+        manet_queued_job queued;
+        ma_result result = ma_resource_manager_next_job(monitor->resourceManager, &queued.job);
+        if (result != MA_SUCCESS || queued.job.toc.breakup.code == MA_JOB_TYPE_QUIT) {
+            break;
+        }
+
+        /* Timestamped when the job leaves miniaudio's queue, not when it was posted. The time it spent in that queue
+           is not visible here, and it grows while this thread blocks on freeSlots below with the ring full, so queue
+           wait is under-reported under sustained load. The block on freeSlots itself is counted for this job. */
+        queued.enqueuedAt = ma_timer_get_time_in_seconds(&monitor->timer);
+
+        ma_mutex_lock(&monitor->statsLock);
+        monitor->stats.queued[queued.job.toc.breakup.code % MANET_JOB_TYPE_SLOTS] += 1;
+        ma_mutex_unlock(&monitor->statsLock);
+
+        ma_semaphore_wait(&monitor->freeSlots);
+        ma_mutex_lock(&monitor->ringLock);
+        monitor->ring[(monitor->head + monitor->count) % monitor->capacity] = queued;
+        monitor->count += 1;
+        ma_mutex_unlock(&monitor->ringLock);
+        ma_semaphore_release(&monitor->filledSlots);
+    }
+
+    return (ma_thread_result)0;
+}
+
+static ma_thread_result MA_THREADCALL manet_job_monitor_work(void* userData)
+{
+    manet_job_monitor* monitor = (manet_job_monitor*)userData;
+
+    for (;;) {
+        manet_queued_job queued;
+
+        ma_semaphore_wait(&monitor->filledSlots);
+        ma_mutex_lock(&monitor->ringLock);
+        if (monitor->count == 0) {
+            /* Only the wake-ups posted by manet_job_monitor_stop find the ring empty. */
+            ma_mutex_unlock(&monitor->ringLock);
+            break;
+        }
+
+        queued = monitor->ring[monitor->head];
+        monitor->head = (monitor->head + 1) % monitor->capacity;
+        monitor->count -= 1;
+        ma_mutex_unlock(&monitor->ringLock);
+        ma_semaphore_release(&monitor->freeSlots);
+
+        manet_job_monitor_process(monitor, &queued);
+    }
+
+    return (ma_thread_result)0;
+}
+
+static void manet_job_monitor_process(manet_job_monitor* monitor, manet_queued_job* queued)
+{
+    ma_resource_manager* resourceManager = monitor->resourceManager;
+    ma_job* job = &queued->job;
+    ma_uint16 code = job->toc.breakup.code;
+    ma_resource_manager_data_buffer_node* decodingNode = NULL;
+    ma_bool32 isNodePinned = MA_FALSE;
+    ma_bool32 isRefill = MA_FALSE;
+    ma_bool32 isRefillMiss = MA_FALSE;
+
+    if (code == MA_JOB_TYPE_RESOURCE_MANAGER_LOAD_DATA_BUFFER_NODE) {
+        decodingNode = (ma_resource_manager_data_buffer_node*)job->data.resourceManager.loadDataBufferNode.pDataBufferNode;
+    } else if (code == MA_JOB_TYPE_RESOURCE_MANAGER_PAGE_DATA_BUFFER_NODE) {
+        decodingNode = (ma_resource_manager_data_buffer_node*)job->data.resourceManager.pageDataBufferNode.pDataBufferNode;
+    } else if (code == MA_JOB_TYPE_RESOURCE_MANAGER_PAGE_DATA_STREAM) {
+        ma_resource_manager_data_stream* stream = (ma_resource_manager_data_stream*)job->data.resourceManager.pageDataStream.pDataStream;
+
+        /* Out-of-order jobs are only re-posted. A refill misses when the page the reader has moved on to is not
+           filled yet either, i.e. playback is already waiting on the decoder. */
+        if (job->order == ma_atomic_load_32(&stream->executionPointer)) {
+            isRefill = MA_TRUE;
+            isRefillMiss = !ma_atomic_load_32(&stream->isPageValid[stream->currentPageIndex]);
+        }
+    }
+
+    if (decodingNode != NULL) {
+        /* Hold a reference so the node's result can still be read once the job has run; the sound owning it may be
+           destroyed as soon as decoding completes. A node without references is only waiting to be freed. */
+        ma_resource_manager_data_buffer_bst_lock(resourceManager);
+        if (ma_atomic_load_32(&decodingNode->refCount) > 0) {
+            isNodePinned = ma_resource_manager_data_buffer_node_increment_ref(resourceManager, decodingNode, NULL) == MA_SUCCESS;
+        }
+        ma_resource_manager_data_buffer_bst_unlock(resourceManager);
+    }
+
+    double startedAt = ma_timer_get_time_in_seconds(&monitor->timer);
+    ma_job_process(job);
+    double finishedAt = ma_timer_get_time_in_seconds(&monitor->timer);
+
+    ma_result nodeResult = MA_BUSY;
+    if (isNodePinned) {
+        nodeResult = ma_resource_manager_data_buffer_node_result(decodingNode);
+    }
+
+    ma_mutex_lock(&monitor->statsLock);
+    monitor->stats.completed[code % MANET_JOB_TYPE_SLOTS] += 1;
+    manet_job_histogram_record(&monitor->stats.queueWait, startedAt - queued->enqueuedAt);
+    manet_job_histogram_record(&monitor->stats.processing, finishedAt - startedAt);
+
+    if (isRefill) {
+        monitor->stats.streamRefills += 1;
+        if (isRefillMiss) {
+            monitor->stats.streamRefillMisses += 1;
+        }
+    }
+
+    if (decodingNode != NULL) {
+        if (isNodePinned) {
+            manet_job_monitor_track_decode(monitor, decodingNode, finishedAt - startedAt, nodeResult != MA_BUSY, nodeResult == MA_SUCCESS);
+        } else {
+            manet_job_monitor_track_decode(monitor, decodingNode, 0, MA_TRUE, MA_FALSE);
+        }
+    }
+    ma_mutex_unlock(&monitor->statsLock);
+
+    if (isNodePinned) {
+        ma_resource_manager_data_buffer_node_unacquire(resourceManager, decodingNode, NULL, NULL);
+    }
+}
+
+/* Called with the stats lock held. Abandoned or failed decodes are dropped without being recorded. */
+static void manet_job_monitor_track_decode(manet_job_monitor* monitor, ma_resource_manager_data_buffer_node* node, double seconds, ma_bool32 isFinished, ma_bool32 succeeded)
+{
+    manet_decode_timing** link = &monitor->decodes;
+    while (*link != NULL && (*link)->node != node) {
+        link = &(*link)->next;
+    }
+
+    manet_decode_timing* timing = *link;
+    if (timing == NULL) {
+        if (isFinished) {
+            if (succeeded) {
+                manet_job_histogram_record(&monitor->stats.decode, seconds);
+            }
+            return;
+        }
+
+        timing = (manet_decode_timing*)manet_alloc(sizeof(*timing));
+        if (timing == NULL) {
+            return;
+        }
+
+        timing->node = node;
+        timing->seconds = seconds;
+        timing->next = monitor->decodes;
+        monitor->decodes = timing;
+        return;
+    }
+
+    timing->seconds += seconds;
+    if (isFinished) {
+        *link = timing->next;
+        if (succeeded) {
+            manet_job_histogram_record(&monitor->stats.decode, timing->seconds);
+        }
+        manet_free(timing);
+    }
+}
+
+static void manet_job_histogram_record(manet_job_histogram* histogram, double seconds)
+{
+    ma_uint64 microseconds = seconds > 0 ? (ma_uint64)(seconds * 1000000.0) : 0;
+    ma_uint32 bucket = 0;
+    while (bucket + 1 < MANET_JOB_HISTOGRAM_BUCKETS && (microseconds >> (bucket + 1)) != 0) {
+        bucket += 1;
+    }
+
+    histogram->count += 1;
+    histogram->totalMicroseconds += microseconds;
+    histogram->buckets[bucket] += 1;
+    if (microseconds > histogram->maxMicroseconds) {
+        histogram->maxMicroseconds = microseconds;
+    }
+}
+
+MANET_API ma_result manet_engine_start(manet_engine* handle)
+{
+    if (manet_validate_engine(handle) != MA_SUCCESS) {
+        return MA_INVALID_OPERATION;
+    }
+
+    return ma_engine_start(&handle->engine);
+}
+
+MANET_API ma_result manet_engine_stop(manet_engine* handle)
+{
+    if (manet_validate_engine(handle) != MA_SUCCESS) {
+        return MA_INVALID_OPERATION;
+    }
+
+    return ma_engine_stop(&handle->engine);
+}
+
+MANET_API ma_uint64 manet_engine_get_time_in_pcm_frames(manet_engine* handle)
+{
+    if (manet_validate_engine(handle) != MA_SUCCESS) {
+        return 0;
+    }
+
+    return ma_engine_get_time_in_pcm_frames(&handle->engine);
+}
+
+MANET_API ma_uint64 manet_engine_get_time_in_milliseconds(manet_engine* handle)
+{
+    if (manet_validate_engine(handle) != MA_SUCCESS) {
+        return 0;
+    }
+
+    return ma_engine_get_time_in_milliseconds(&handle->engine);
+}
+
+MANET_API ma_result manet_engine_set_time_in_pcm_frames(manet_engine* handle, ma_uint64 globalTime)
+{
+    if (manet_validate_engine(handle) != MA_SUCCESS) {
+        return MA_INVALID_OPERATION;
+    }
+
+    return ma_engine_set_time_in_pcm_frames(&handle->engine, globalTime);
+}
+
+MANET_API ma_result manet_engine_set_time_in_milliseconds(manet_engine* handle, ma_uint64 globalTime)
+{
+    if (manet_validate_engine(handle) != MA_SUCCESS) {
+        return MA_INVALID_OPERATION;
+    }
+
+    return ma_engine_set_time_in_milliseconds(&handle->engine, globalTime);
+}
+
+MANET_API ma_result manet_engine_set_volume(manet_engine* handle, float volume)
+{
+    if (manet_validate_engine(handle) != MA_SUCCESS) {
+        return MA_INVALID_OPERATION;
+    }
+
+    return ma_engine_set_volume(&handle->engine, volume);
+}
+
+MANET_API float manet_engine_get_volume(manet_engine* handle)
+{
+    if (manet_validate_engine(handle) != MA_SUCCESS) {
+        return 0.0f;
+    }
+
+    return ma_engine_get_volume(&handle->engine);
+}
+
+MANET_API ma_result manet_engine_set_gain_db(manet_engine* handle, float gainDB)
+{
+    if (manet_validate_engine(handle) != MA_SUCCESS) {
+        return MA_INVALID_OPERATION;
+    }
+
+    return ma_engine_set_gain_db(&handle->engine, gainDB);
+}
+
+MANET_API float manet_engine_get_gain_db(manet_engine* handle)
+{
+    if (manet_validate_engine(handle) != MA_SUCCESS) {
+        return 0.0f;
+    }
+
+    return ma_engine_get_gain_db(&handle->engine);
+}
+
+MANET_API ma_uint32 manet_engine_get_sample_rate(manet_engine* handle)
+{
+    if (manet_validate_engine(handle) != MA_SUCCESS) {
+        return 0;
+    }
+
+    return ma_engine_get_sample_rate(&handle->engine);
+}
+
+MANET_API ma_uint32 manet_engine_get_channels(manet_engine* handle)
+{
+    if (manet_validate_engine(handle) != MA_SUCCESS) {
+        return 0;
+    }
+
+    return ma_engine_get_channels(&handle->engine);
+}
+
+MANET_API ma_uint32 manet_engine_get_listener_count(manet_engine* handle)
+{
+    if (manet_validate_engine(handle) != MA_SUCCESS) {
+        return 0;
+    }
+
+    return ma_engine_get_listener_count(&handle->engine);
+}
+
+MANET_API ma_uint32 manet_engine_find_closest_listener(manet_engine* handle, float x, float y, float z)
+{
+    if (manet_validate_engine(handle) != MA_SUCCESS) {
+        return MA_LISTENER_INDEX_CLOSEST;
+    }
+
+    return ma_engine_find_closest_listener(&handle->engine, x, y, z);
+}
+
+MANET_API ma_result manet_engine_play_sound(manet_engine* handle, const char* path)
+{
+    if (manet_validate_engine(handle) != MA_SUCCESS || path == NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    return ma_engine_play_sound(&handle->engine, path, NULL);
+}
+
+MANET_API ma_result manet_engine_read_pcm_frames(manet_engine* handle, float* frames, ma_uint64 frameCount, ma_uint64* framesRead)
+{
+    if (framesRead != NULL) {
+        *framesRead = 0;
+    }
+
+    if (manet_validate_engine(handle) != MA_SUCCESS) {
+        return MA_INVALID_OPERATION;
+    }
+
+    /* Pulling from an engine that owns a device would race the device's own data callback. */
+    if (ma_engine_get_device(&handle->engine) != NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    if (frameCount == 0) {
+        return MA_SUCCESS;
+    }
+
+    if (frames == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    ma_result result = ma_engine_read_pcm_frames(&handle->engine, frames, frameCount, framesRead);
+    if (result == MA_SUCCESS && handle->meter != NULL) {
+        /* The unread tail is silenced, and silence is what a device would have played. */
+        manet_meter_process(handle->meter, frames, frameCount);
+    }
+
+    return result;
+}
+
+MANET_API ma_result manet_engine_set_listener_position(manet_engine* handle, ma_uint32 index, float x, float y, float z)
+{
+    if (manet_validate_engine(handle) != MA_SUCCESS) {
+        return MA_INVALID_OPERATION;
+    }
+
+    ma_engine_listener_set_position(&handle->engine, index, x, y, z);
+    return MA_SUCCESS;
+}
+
+MANET_API ma_result manet_engine_get_listener_position(manet_engine* handle, ma_uint32 index, float* x, float* y, float* z)
+{
+    if (manet_validate_engine(handle) != MA_SUCCESS || x == NULL || y == NULL || z == NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    ma_vec3f position = ma_engine_listener_get_position(&handle->engine, index);
+    *x = position.x;
+    *y = position.y;
+    *z = position.z;
+
+    return MA_SUCCESS;
+}
+
+MANET_API ma_result manet_engine_set_listener_direction(manet_engine* handle, ma_uint32 index, float x, float y, float z)
+{
+    if (manet_validate_engine(handle) != MA_SUCCESS) {
+        return MA_INVALID_OPERATION;
+    }
+
+    ma_engine_listener_set_direction(&handle->engine, index, x, y, z);
+    return MA_SUCCESS;
+}
+
+MANET_API ma_result manet_engine_get_listener_direction(manet_engine* handle, ma_uint32 index, float* x, float* y, float* z)
+{
+    if (manet_validate_engine(handle) != MA_SUCCESS || x == NULL || y == NULL || z == NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    ma_vec3f direction = ma_engine_listener_get_direction(&handle->engine, index);
+    *x = direction.x;
+    *y = direction.y;
+    *z = direction.z;
+
+    return MA_SUCCESS;
+}
+
+MANET_API ma_result manet_engine_set_listener_world_up(manet_engine* handle, ma_uint32 index, float x, float y, float z)
+{
+    if (manet_validate_engine(handle) != MA_SUCCESS) {
+        return MA_INVALID_OPERATION;
+    }
+
+    ma_engine_listener_set_world_up(&handle->engine, index, x, y, z);
+    return MA_SUCCESS;
+}
+
+MANET_API ma_result manet_engine_get_listener_world_up(manet_engine* handle, ma_uint32 index, float* x, float* y, float* z)
+{
+    if (manet_validate_engine(handle) != MA_SUCCESS || x == NULL || y == NULL || z == NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    ma_vec3f up = ma_engine_listener_get_world_up(&handle->engine, index);
+    *x = up.x;
+    *y = up.y;
+    *z = up.z;
+
+    return MA_SUCCESS;
+}
+
+MANET_API ma_result manet_engine_set_listener_velocity(manet_engine* handle, ma_uint32 index, float x, float y, float z)
+{
+    if (manet_validate_engine(handle) != MA_SUCCESS) {
+        return MA_INVALID_OPERATION;
+    }
+
+    ma_engine_listener_set_velocity(&handle->engine, index, x, y, z);
+    return MA_SUCCESS;
+}
+
+MANET_API ma_result manet_engine_get_listener_velocity(manet_engine* handle, ma_uint32 index, float* x, float* y, float* z)
+{
+    if (manet_validate_engine(handle) != MA_SUCCESS || x == NULL || y == NULL || z == NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    ma_vec3f velocity = ma_engine_listener_get_velocity(&handle->engine, index);
+    *x = velocity.x;
+    *y = velocity.y;
+    *z = velocity.z;
+
+    return MA_SUCCESS;
+}
+
+MANET_API ma_result manet_engine_set_listener_cone(manet_engine* handle, ma_uint32 index, float innerAngleInRadians, float outerAngleInRadians, float outerGain)
+{
+    if (manet_validate_engine(handle) != MA_SUCCESS) {
+        return MA_INVALID_OPERATION;
+    }
+
+    ma_engine_listener_set_cone(&handle->engine, index, innerAngleInRadians, outerAngleInRadians, outerGain);
+    return MA_SUCCESS;
+}
+
+MANET_API ma_result manet_engine_get_listener_cone(manet_engine* handle, ma_uint32 index, float* innerAngleInRadians, float* outerAngleInRadians, float* outerGain)
+{
+    if (manet_validate_engine(handle) != MA_SUCCESS || innerAngleInRadians == NULL || outerAngleInRadians == NULL || outerGain == NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    ma_engine_listener_get_cone(&handle->engine, index, innerAngleInRadians, outerAngleInRadians, outerGain);
+    return MA_SUCCESS;
+}
+
+MANET_API ma_result manet_engine_set_listener_enabled(manet_engine* handle, ma_uint32 index, ma_bool32 isEnabled)
+{
+    if (manet_validate_engine(handle) != MA_SUCCESS) {
+        return MA_INVALID_OPERATION;
+    }
+
+    ma_engine_listener_set_enabled(&handle->engine, index, isEnabled);
+    return MA_SUCCESS;
+}
+
+MANET_API ma_bool32 manet_engine_is_listener_enabled(manet_engine* handle, ma_uint32 index)
+{
+    if (manet_validate_engine(handle) != MA_SUCCESS) {
+        return MA_FALSE;
+    }
+
+    return ma_engine_listener_is_enabled(&handle->engine, index);
+}
+
+MANET_API manet_engine* manet_engine_create_with_options(
+    manet_context* contextHandle,
+    manet_resource_manager* resourceManagerHandle,
+    const char* playbackDeviceId,
+    ma_uint32 sampleRate,
+    ma_uint32 channelCount,
+    ma_uint32 periodSizeInFrames,
+    ma_uint32 periodSizeInMilliseconds,
+    ma_bool32 noAutoStart,
+    ma_bool32 noDevice,
+    ma_bool32 enableMetering)
+{
+    ma_engine_config config = ma_engine_config_init();
+
+#if !defined(MA_NO_DEVICE_IO)
+    if (contextHandle != NULL) {
+        config.pContext = &contextHandle->context;
+    }
+
+    ma_device_id playbackId;
+    ma_device_id* playbackIdPtr = NULL;
+    MA_ZERO_OBJECT(&playbackId);
+
+    if (playbackDeviceId != NULL && playbackDeviceId[0] != '\0') {
+        if (manet_device_id_from_hex(playbackDeviceId, &playbackId) == MA_FALSE) {
+            return NULL;
+        }
+
+        playbackIdPtr = &playbackId;
+    }
+
+    config.pPlaybackDeviceID = playbackIdPtr;
+#else
+    (void)playbackDeviceId;
+    (void)contextHandle;
+#endif
+    if (resourceManagerHandle != NULL) {
+        config.pResourceManager = &resourceManagerHandle->manager;
+    }
+
+    if (sampleRate != 0) {
+        config.sampleRate = sampleRate;
+    }
+
+    if (channelCount != 0) {
+        config.channels = channelCount;
+    }
+
+    if (periodSizeInFrames != 0) {
+        config.periodSizeInFrames = periodSizeInFrames;
+    }
+
+    if (periodSizeInMilliseconds != 0) {
+        config.periodSizeInMilliseconds = periodSizeInMilliseconds;
+    }
+
+    config.noAutoStart = noAutoStart;
+    config.noDevice = noDevice;
+
+    return manet_engine_create_with_config(&config, resourceManagerHandle, enableMetering);
+}
+
+MANET_API manet_resource_manager* manet_resource_manager_create_with_config(const manet_resource_manager_config_simple* settings)
+{
+    manet_resource_manager* handle = (manet_resource_manager*)manet_alloc(sizeof(*handle));
+    if (handle == NULL) {
+        return NULL;
+    }
+
+    memset(handle, 0, sizeof(*handle));
+
+    ma_resource_manager_config config = ma_resource_manager_config_init();
+    manet_apply_resource_manager_settings(&config, settings);
+
+    /* With job statistics the bridge runs the job threads itself, which needs a blocking queue and at least one
+       worker; a configuration that leaves no job threads is rejected rather than silently running unmonitored. */
+    ma_uint32 monitoredWorkers = 0;
+    if (settings != NULL && settings->collectJobStatistics) {
+        if ((config.flags & (MA_RESOURCE_MANAGER_FLAG_NON_BLOCKING | MA_RESOURCE_MANAGER_FLAG_NO_THREADING)) != 0 ||
+            config.jobThreadCount == 0 || config.jobThreadCount > MA_RESOURCE_MANAGER_MAX_JOB_THREAD_COUNT) {
+            manet_free(handle);
+            return NULL;
+        }
+
+        monitoredWorkers = config.jobThreadCount;
+        config.jobThreadCount = 0;
+    }
+
+    if (settings != NULL && (settings->vfs != NULL || settings->assetPack != NULL)) {
+        if (!manet_vfs_init(&handle->vfs, settings->vfs, settings->assetPack)) {
+            manet_free(handle);
+            return NULL;
+        }
+
+        config.pVFS = &handle->vfs;
+    }
+
+    if (settings != NULL && settings->decodedCacheDirectory != NULL && settings->decodedCacheDirectory[0] != '\0') {
+        size_t length = strlen(settings->decodedCacheDirectory);
+        handle->decodedCacheDirectory = (char*)manet_alloc(length + 1);
+        if (handle->decodedCacheDirectory == NULL) {
+            manet_vfs_uninit(&handle->vfs);
+            manet_free(handle);
+            return NULL;
+        }
+
+        memcpy(handle->decodedCacheDirectory, settings->decodedCacheDirectory, length + 1);
+    }
+
+    ma_result result = ma_resource_manager_init(&config, &handle->manager);
+    if (result != MA_SUCCESS) {
+        manet_free(handle->decodedCacheDirectory);
+        manet_vfs_uninit(&handle->vfs);
+        manet_free(handle);
+        return NULL;
+    }
+
+    result = manet_data_registry_init(&handle->registry, &handle->manager);
+    if (result != MA_SUCCESS) {
+        ma_resource_manager_uninit(&handle->manager);
+        manet_free(handle->decodedCacheDirectory);
+        manet_vfs_uninit(&handle->vfs);
+        manet_free(handle);
+        return NULL;
+    }
+
+    result = manet_resource_cache_init(&handle->cache, &handle->manager);
+    if (result != MA_SUCCESS) {
+        manet_data_registry_uninit(&handle->registry);
+        ma_resource_manager_uninit(&handle->manager);
+        manet_free(handle->decodedCacheDirectory);
+        manet_vfs_uninit(&handle->vfs);
+        manet_free(handle);
+        return NULL;
+    }
+
+    if (monitoredWorkers > 0) {
+        handle->jobMonitor = manet_job_monitor_start(&handle->manager, monitoredWorkers, config.jobThreadStackSize);
+        if (handle->jobMonitor == NULL) {
+            manet_resource_cache_uninit(&handle->cache);
+            manet_data_registry_uninit(&handle->registry);
+            ma_resource_manager_uninit(&handle->manager);
+            manet_free(handle->decodedCacheDirectory);
+            manet_vfs_uninit(&handle->vfs);
+            manet_free(handle);
+            return NULL;
+        }
+    }
+
+    return handle;
+}
+
+MANET_API manet_resource_manager* manet_resource_manager_create_default(void)
+{
+    return manet_resource_manager_create_with_config(NULL);
+}
+
+MANET_API void manet_resource_manager_destroy(manet_resource_manager* handle)
+{
+    if (handle == NULL) {
+        return;
+    }
+
+    manet_resource_cache_uninit(&handle->cache);
+    manet_data_registry_uninit(&handle->registry);
+    manet_job_monitor_stop(handle->jobMonitor);
+    ma_resource_manager_uninit(&handle->manager);
+    manet_free(handle->decodedCacheDirectory);
+    manet_vfs_uninit(&handle->vfs);
+    manet_free(handle);
+}
+
+MANET_API manet_asset_pack* manet_asset_pack_open(const char* path)
+{
+    if (path == NULL) {
+        return NULL;
+    }
+
+    return manet_asset_pack_map(path, NULL);
+}
+
+MANET_API manet_asset_pack* manet_asset_pack_open_w(const wchar_t* path)
+{
+    if (path == NULL) {
+        return NULL;
+    }
+
+    return manet_asset_pack_map(NULL, path);
+}
+
+MANET_API void manet_asset_pack_close(manet_asset_pack* handle)
+{
+    manet_asset_pack_release(handle);
+}
+
+MANET_API ma_uint32 manet_asset_pack_get_entry_count(manet_asset_pack* handle)
+{
+    return handle != NULL ? handle->entryCount : 0;
+}
+
+MANET_API ma_bool32 manet_asset_pack_contains(manet_asset_pack* handle, const char* name)
+{
+    if (handle == NULL || name == NULL) {
+        return MA_FALSE;
+    }
+
+    return manet_asset_pack_find(handle, name) != NULL;
+}
+
+MANET_API ma_result manet_resource_manager_set_memory_budget(manet_resource_manager* handle, ma_uint64 budgetInBytes)
+{
+    if (handle == NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    ma_mutex_lock(&handle->cache.lock);
+    handle->cache.budgetInBytes = budgetInBytes;
+    ma_mutex_unlock(&handle->cache.lock);
+
+    /* Without a budget nothing is retained, so drop whatever the cache still holds. */
+    manet_resource_cache_trim(&handle->cache, budgetInBytes == 0);
+    return MA_SUCCESS;
+}
+
+MANET_API ma_result manet_resource_manager_get_stats(manet_resource_manager* handle, manet_resource_manager_stats* stats)
+{
+    if (stats != NULL) {
+        memset(stats, 0, sizeof(*stats));
+    }
+
+    if (handle == NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    if (stats == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    manet_resource_cache* cache = &handle->cache;
+    manet_resource_cache_measure(cache, &stats->loadedBuffers, &stats->residentBytes);
+
+    ma_mutex_lock(&cache->lock);
+    stats->budgetInBytes = cache->budgetInBytes;
+    for (manet_cache_entry* entry = cache->head; entry != NULL; entry = entry->next) {
+        if (ma_atomic_load_32(&entry->buffer.pNode->refCount) == 1) {
+            stats->cachedBuffers += 1;
+            stats->cachedBytes += manet_data_buffer_node_size(entry->buffer.pNode);
+        }
+    }
+    ma_mutex_unlock(&cache->lock);
+
+    stats->cacheHits = ma_atomic_uint64_get(&cache->hits);
+    stats->cacheMisses = ma_atomic_uint64_get(&cache->misses);
+    stats->evictions = ma_atomic_uint64_get(&cache->evictions);
+
+    /* The job queue always keeps one sentinel slot allocated. */
+    ma_uint32 allocatedJobs = ma_atomic_load_32(&handle->manager.jobQueue.allocator.count);
+    stats->pendingJobs = allocatedJobs > 0 ? allocatedJobs - 1 : 0;
+    return MA_SUCCESS;
+}
+
+MANET_API ma_result manet_resource_manager_reset_stats(manet_resource_manager* handle)
+{
+    if (handle == NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    ma_atomic_uint64_set(&handle->cache.hits, 0);
+    ma_atomic_uint64_set(&handle->cache.misses, 0);
+    ma_atomic_uint64_set(&handle->cache.evictions, 0);
+    return MA_SUCCESS;
+}
+
+MANET_API ma_result manet_resource_manager_get_job_stats(manet_resource_manager* handle, manet_resource_manager_job_stats* stats)
+{
+    if (stats != NULL) {
+        memset(stats, 0, sizeof(*stats));
+    }
+
+    if (handle == NULL || handle->jobMonitor == NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    if (stats == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    manet_job_monitor* monitor = handle->jobMonitor;
+    ma_mutex_lock(&monitor->statsLock);
+    *stats = monitor->stats;
+    ma_mutex_unlock(&monitor->statsLock);
+
+    ma_mutex_lock(&monitor->ringLock);
+    stats->pendingJobs = monitor->count;
+    ma_mutex_unlock(&monitor->ringLock);
+    return MA_SUCCESS;
+}
+
+MANET_API ma_result manet_resource_manager_reset_job_stats(manet_resource_manager* handle)
+{
+    if (handle == NULL || handle->jobMonitor == NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    manet_job_monitor* monitor = handle->jobMonitor;
+    ma_mutex_lock(&monitor->statsLock);
+    memset(&monitor->stats, 0, sizeof(monitor->stats));
+    monitor->stats.workerCount = monitor->workerCount;
+    ma_mutex_unlock(&monitor->statsLock);
+    return MA_SUCCESS;
+}
+
+MANET_API ma_result manet_resource_manager_register_decoded_data(manet_resource_manager* handle, const char* name, const float* frames, ma_uint64 frameCount, ma_uint32 channels, ma_uint32 sampleRate)
+{
+    if (handle == NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    return manet_data_registry_add_decoded(&handle->registry, name, frames, frameCount, channels, sampleRate);
+}
+
+MANET_API ma_result manet_resource_manager_register_encoded_data(manet_resource_manager* handle, const char* name, const void* data, ma_uint64 sizeInBytes)
+{
+    if (handle == NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    return manet_data_registry_add_encoded(&handle->registry, name, data, sizeInBytes, MA_FALSE);
+}
+
+MANET_API ma_result manet_resource_manager_unregister_data(manet_resource_manager* handle, const char* name)
+{
+    if (handle == NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    return manet_data_registry_remove(&handle->registry, name);
+}
+
+MANET_API ma_bool32 manet_resource_manager_is_data_registered(manet_resource_manager* handle, const char* name)
+{
+    if (handle == NULL) {
+        return MA_FALSE;
+    }
+
+    return manet_data_registry_contains(&handle->registry, name);
+}
+
+MANET_API manet_context* manet_context_create_default(void)
+{
+    manet_context* handle = (manet_context*)manet_alloc(sizeof(*handle));
+    if (handle == NULL) {
+        return NULL;
+    }
+
+    ma_context_config config = ma_context_config_init();
+    ma_result result = ma_context_init(NULL, 0, &config, &handle->context);
+    if (result != MA_SUCCESS) {
+        manet_free(handle);
+        return NULL;
+    }
+
+    return handle;
+}
+
+MANET_API manet_context* manet_context_create_with_backends(const ma_backend* backends, ma_uint32 backendCount)
+{
+    manet_context* handle = (manet_context*)manet_alloc(sizeof(*handle));
+    if (handle == NULL) {
+        return NULL;
+    }
+
+    ma_context_config config = ma_context_config_init();
+
+    const ma_backend* backendList = NULL;
+    ma_uint32 listCount = 0;
+    if (backends != NULL && backendCount > 0) {
+        backendList = backends;
+        listCount = backendCount;
+    }
+
+    ma_result result = ma_context_init(backendList, listCount, &config, &handle->context);
+    if (result != MA_SUCCESS) {
+        manet_free(handle);
+        return NULL;
+    }
+
+    return handle;
+}
+
+MANET_API void manet_context_destroy(manet_context* handle)
+{
+    if (handle == NULL) {
+        return;
+    }
+
+    ma_context_uninit(&handle->context);
+    manet_free(handle);
+}
+
+MANET_API ma_result manet_context_get_devices(
+    manet_context* handle,
+    ma_device_type deviceType,
+    manet_device_descriptor* descriptors,
+    ma_uint32 descriptorCapacity,
+    ma_uint32* outDeviceCount)
+{
+    if (manet_validate_context(handle) != MA_SUCCESS) {
+        if (outDeviceCount != NULL) {
+            *outDeviceCount = 0;
+        }
+
+        return MA_INVALID_OPERATION;
+    }
+
+    ma_device_info* playbackInfos = NULL;
+    ma_device_info* captureInfos = NULL;
+    ma_uint32 playbackCount = 0;
+    ma_uint32 captureCount = 0;
+    ma_result result = ma_context_get_devices(&handle->context, &playbackInfos, &playbackCount, &captureInfos, &captureCount);
+    if (result != MA_SUCCESS) {
+        if (outDeviceCount != NULL) {
+            *outDeviceCount = 0;
+        }
+
+        return result;
+    }
+
+    ma_device_info* sourceInfos = playbackInfos;
+    ma_uint32 sourceCount = playbackCount;
+    if (deviceType == ma_device_type_capture) {
+        sourceInfos = captureInfos;
+        sourceCount = captureCount;
+    }
+
+    if (outDeviceCount != NULL) {
+        *outDeviceCount = sourceCount;
+    }
+
+    if (descriptors == NULL || descriptorCapacity == 0 || sourceInfos == NULL) {
+        return MA_SUCCESS;
+    }
+
+    ma_uint32 copyCount = manet_min_u32(descriptorCapacity, sourceCount);
+    for (ma_uint32 i = 0; i < copyCount; ++i) {
+        manet_write_device_descriptor(&descriptors[i], &sourceInfos[i], deviceType);
+    }
+
+    return MA_SUCCESS;
+}
+
+MANET_API manet_sound* manet_sound_create_from_file(manet_engine* engineHandle, const char* path, ma_uint32 flags)
+{
+    return manet_sound_create_from_path(engineHandle, path, NULL, flags, NULL, NULL);
+}
+
+MANET_API manet_sound* manet_sound_create_from_file_async(manet_engine* engineHandle, const char* path, ma_uint32 flags, manet_sound_load_proc callback, void* userData)
+{
+    if (callback == NULL) {
+        return NULL;
+    }
+
+    return manet_sound_create_from_path(engineHandle, path, NULL, flags, callback, userData);
+}
+
+#if defined(_WIN32)
+MANET_API manet_sound* manet_sound_create_from_file_w(manet_engine* engineHandle, const wchar_t* path, ma_uint32 flags)
+{
+    return manet_sound_create_from_path(engineHandle, NULL, path, flags, NULL, NULL);
+}
+
+MANET_API manet_sound* manet_sound_create_from_file_async_w(manet_engine* engineHandle, const wchar_t* path, ma_uint32 flags, manet_sound_load_proc callback, void* userData)
+{
+    if (callback == NULL) {
+        return NULL;
+    }
+
+    return manet_sound_create_from_path(engineHandle, NULL, path, flags, callback, userData);
+}
+#endif
+
+static manet_sound* manet_sound_create_from_path(manet_engine* engineHandle, const char* path, const wchar_t* pathW, ma_uint32 flags, manet_sound_load_proc callback, void* userData)
+{
+    if (manet_validate_engine(engineHandle) != MA_SUCCESS || (path == NULL && pathW == NULL)) {
+        return NULL;
+    }
+
+    manet_sound* soundHandle = (manet_sound*)manet_alloc(sizeof(*soundHandle));
+    if (soundHandle == NULL) {
+        return NULL;
+    }
+
+    memset(soundHandle, 0, sizeof(*soundHandle));
+
+    /* Pin registered bytes for the lifetime of the sound in case the name is unregistered while it plays.
+       Registered names are UTF-8, so a wide path is converted for the lookup and swapped for the entry's name. */
+    if (path != NULL) {
+        soundHandle->registeredData = manet_data_registry_acquire(engineHandle->registry, path);
+    } else {
+        char* convertedPath = manet_utf8_from_wide(pathW);
+        if (convertedPath != NULL) {
+            soundHandle->registeredData = manet_data_registry_acquire(engineHandle->registry, convertedPath);
+            manet_free(convertedPath);
+        }
+    }
+
+    ma_sound_config config = ma_sound_config_init_2(&engineHandle->engine);
+    config.pFilePath = path;
+    config.pFilePathW = pathW;
+    config.flags = flags;
+
+    if (soundHandle->registeredData != NULL) {
+        config.pFilePath = soundHandle->registeredData->name;
+        config.pFilePathW = NULL;
+    }
+
+    /* Fully decoded file loads can come from the disk cache instead. Async loads never read, hash or decode the
+       source on the caller's thread. */
+    if (engineHandle->decodedCacheDirectory != NULL && soundHandle->registeredData == NULL &&
+        (flags & MA_SOUND_FLAG_DECODE) != 0 && (flags & MA_SOUND_FLAG_STREAM) == 0) {
+        soundHandle->registeredData = manet_decoded_cache_acquire(engineHandle, path, pathW, (flags & MA_SOUND_FLAG_ASYNC) == 0);
+        if (soundHandle->registeredData != NULL) {
+            config.pFilePath = soundHandle->registeredData->name;
+            config.pFilePathW = NULL;
+        }
+    }
+
+    if (callback != NULL) {
+        manet_sound_load_notification* notification = &soundHandle->loadNotification;
+        notification->cb.onSignal = manet_sound_load_notification_on_signal;
+        notification->sound = soundHandle;
+        notification->callback = callback;
+        notification->userData = userData;
+        ma_atomic_uint32_set(&notification->state, MANET_SOUND_LOAD_PENDING);
+        config.initNotifications.done.pNotification = notification;
+    }
+
+    ma_result result = ma_sound_init_ex(&engineHandle->engine, &config, &soundHandle->sound);
+    if (result != MA_SUCCESS) {
+        manet_registered_data_release_from_sound(soundHandle->registeredData);
+        manet_free(soundHandle);
+        return NULL;
+    }
+
+    soundHandle->state = MANET_SOUND_STATE_STOPPED;
+    soundHandle->initFlags = flags;
+
+    if (engineHandle->cache != NULL) {
+        manet_resource_cache_on_sound_loaded(engineHandle->cache, soundHandle);
+    }
+
+    if (callback != NULL) {
+        manet_sound_load_notification* notification = &soundHandle->loadNotification;
+        if (ma_atomic_uint32_compare_and_swap(&notification->state, MANET_SOUND_LOAD_PENDING, MANET_SOUND_LOAD_ARMED) == MANET_SOUND_LOAD_SIGNALED) {
+            manet_sound_load_notification_deliver(notification);
+        }
+    }
+
+    return soundHandle;
+}
+
+/* miniaudio signals a data buffer's load notifications before the job that raised them advances the buffer's
+   execution pointer. Freeing the buffer from the load callback would leave that increment to land in whatever reuses
+   the memory, and a later job ordered against it would be reposted forever. Buffers still loading are not waited on;
+   their uninit orders its own free job behind the load. */
+static void manet_data_buffer_wait_for_jobs(ma_resource_manager_data_buffer* dataBuffer)
+{
+    if (ma_resource_manager_data_buffer_result(dataBuffer) == MA_BUSY) {
+        return;
+    }
+
+    while (ma_atomic_load_32(&dataBuffer->executionPointer) != ma_atomic_load_32(&dataBuffer->executionCounter)) {
+        ma_yield();
+    }
+}
+
+static void manet_sound_load_notification_on_signal(ma_async_notification* pNotification)
+{
+    manet_sound_load_notification* notification = (manet_sound_load_notification*)pNotification;
+
+    if (ma_atomic_uint32_compare_and_swap(&notification->state, MANET_SOUND_LOAD_PENDING, MANET_SOUND_LOAD_SIGNALED) == MANET_SOUND_LOAD_PENDING) {
+        return;
+    }
+
+    manet_sound_load_notification_deliver(notification);
+}
+
+static void manet_sound_load_notification_deliver(manet_sound_load_notification* notification)
+{
+    ma_result result = MA_SUCCESS;
+
+    ma_resource_manager_data_source* dataSource = notification->sound->sound.pResourceManagerDataSource;
+    if (dataSource != NULL) {
+        result = ma_resource_manager_data_source_result(dataSource);
+        if (result == MA_BUSY) {
+            /* Streams signal "done" once their first pages are decoded while the rest keeps loading. */
+            result = MA_SUCCESS;
+        }
+    }
+
+    notification->callback(notification->userData, result);
+}
+
+static void manet_copy_string(char* dst, size_t dstSize, const char* src)
+{
+    if (dst == NULL || dstSize == 0) {
+        return;
+    }
+
+    if (src == NULL) {
+        dst[0] = '\0';
+        return;
+    }
+
+    strncpy(dst, src, dstSize - 1);
+    dst[dstSize - 1] = '\0';
+}
+
+static void manet_device_id_to_hex(const ma_device_id* id, char* buffer, size_t bufferSize)
+{
+    static const char HEX_DIGITS[] = "0123456789abcdef";
+
+    if (buffer == NULL || bufferSize == 0) {
+        return;
+    }
+
+    if (id == NULL || bufferSize < MANET_DEVICE_ID_HEX_BUFFER_SIZE) {
+        buffer[0] = '\0';
+        return;
+    }
+
+    const ma_uint8* bytes = (const ma_uint8*)id;
+    for (size_t i = 0; i < sizeof(*id); ++i) {
+        buffer[i * 2] = HEX_DIGITS[(bytes[i] >> 4) & 0x0F];
+        buffer[i * 2 + 1] = HEX_DIGITS[bytes[i] & 0x0F];
+    }
+
+    buffer[MANET_DEVICE_ID_HEX_LENGTH] = '\0';
+}
+
+static int manet_hex_value(char digit)
+{
+    if (digit >= '0' && digit <= '9') {
+        return digit - '0';
+    }
+
+    if (digit >= 'a' && digit <= 'f') {
+        return 10 + (digit - 'a');
+    }
+
+    if (digit >= 'A' && digit <= 'F') {
+        return 10 + (digit - 'A');
+    }
+
+    return -1;
+}
+
+static ma_bool32 manet_device_id_from_hex(const char* hex, ma_device_id* id)
+{
+    if (hex == NULL || id == NULL) {
+        return MA_FALSE;
+    }
+
+    size_t length = strlen(hex);
+    if (length != MANET_DEVICE_ID_HEX_LENGTH) {
+        return MA_FALSE;
+    }
+
+    ma_uint8* bytes = (ma_uint8*)id;
+    for (size_t i = 0; i < sizeof(*id); ++i) {
+        int high = manet_hex_value(hex[i * 2]);
+        int low = manet_hex_value(hex[i * 2 + 1]);
+        if (high < 0 || low < 0) {
+            return MA_FALSE;
+        }
+
+        bytes[i] = (ma_uint8)((high << 4) | low);
+    }
+
+    return MA_TRUE;
+}
+
+static void manet_write_device_descriptor(manet_device_descriptor* dst, const ma_device_info* src, ma_device_type type)
+{
+    if (dst == NULL || src == NULL) {
+        return;
+    }
+
+    dst->type = type;
+    dst->isDefault = src->isDefault;
+    manet_copy_string(dst->name, sizeof(dst->name), src->name);
+    manet_device_id_to_hex(&src->id, dst->id, sizeof(dst->id));
+}
+
+static ma_uint32 manet_min_u32(ma_uint32 a, ma_uint32 b)
+{
+    return (a < b) ? a : b;
+}
+
+static void manet_apply_resource_manager_settings(
+    ma_resource_manager_config* config,
+    const manet_resource_manager_config_simple* settings)
+{
+    if (config == NULL || settings == NULL) {
+        return;
+    }
+
+    if (settings->flags != 0) {
+        config->flags = settings->flags;
+    }
+
+    if (settings->decodedFormat != 0) {
+        config->decodedFormat = (ma_format)settings->decodedFormat;
+    }
+
+    if (settings->decodedChannels != 0) {
+        config->decodedChannels = settings->decodedChannels;
+    }
+
+    if (settings->decodedSampleRate != 0) {
+        config->decodedSampleRate = settings->decodedSampleRate;
+    }
+
+    if (settings->jobThreadCount != 0) {
+        config->jobThreadCount = settings->jobThreadCount;
+    }
+}
+
+static manet_engine* manet_engine_create_with_config(const ma_engine_config* inputConfig, manet_resource_manager* sharedManager, ma_bool32 enableMetering)
+{
+    ma_engine_config config;
+    if (inputConfig != NULL) {
+        config = *inputConfig;
+    } else {
+        config = ma_engine_config_init();
+    }
+
+    manet_engine* handle = (manet_engine*)manet_alloc(sizeof(*handle));
+    if (handle == NULL) {
+        return NULL;
+    }
+
+    memset(handle, 0, sizeof(*handle));
+
+    /* The meter is sized from the engine's final format, so the device is held back until it exists. */
+    ma_bool32 startAfterInit = MA_FALSE;
+    if (enableMetering) {
+        config.dataCallback = manet_engine_metered_data_callback;
+        startAfterInit = !config.noAutoStart && !config.noDevice;
+        config.noAutoStart = MA_TRUE;
+    }
+
+    ma_result result = ma_engine_init(&config, &handle->engine);
+    if (result != MA_SUCCESS) {
+#if defined(_DEBUG)
+        fprintf(stderr, "[manet] ma_engine_init failed: %d (%s)\n", result, ma_result_description(result));
+#endif
+        manet_free(handle);
+        return NULL;
+    }
+
+    if (enableMetering) {
+        handle->meter = manet_meter_create(ma_engine_get_channels(&handle->engine), ma_engine_get_sample_rate(&handle->engine));
+        if (handle->meter == NULL) {
+            ma_engine_uninit(&handle->engine);
+            manet_free(handle);
+            return NULL;
+        }
+    }
+
+    if (sharedManager != NULL) {
+        handle->registry = &sharedManager->registry;
+        handle->cache = &sharedManager->cache;
+        handle->decodedCacheDirectory = sharedManager->decodedCacheDirectory;
+    } else {
+        result = manet_data_registry_init(&handle->ownRegistry, ma_engine_get_resource_manager(&handle->engine));
+        if (result != MA_SUCCESS) {
+            ma_engine_uninit(&handle->engine);
+            manet_meter_destroy(handle->meter);
+            manet_free(handle);
+            return NULL;
+        }
+
+        handle->registry = &handle->ownRegistry;
+    }
+
+    if (startAfterInit && ma_engine_start(&handle->engine) != MA_SUCCESS) {
+        manet_engine_destroy(handle);
+        return NULL;
+    }
+
+    return handle;
+}
+
+/* BS.1770 K-weighting: a high shelf modelling the head followed by the RLB high-pass, derived for any sample rate. */
+static void manet_meter_init_filters(manet_meter* meter, ma_uint32 sampleRate)
+{
+    const double shelfFrequency = 1681.974450955533;
+    const double shelfGainDb = 3.999843853973347;
+    const double shelfQ = 0.7071752369554196;
+    const double highPassFrequency = 38.13547087602444;
+    const double highPassQ = 0.5003270373238773;
+
+    double angle = MA_PI_D * shelfFrequency / sampleRate;
+    double k = ma_sind(angle) / ma_cosd(angle);
+    double vh = ma_powd(10.0, shelfGainDb / 20.0);
+    double vb = ma_powd(vh, 0.4996667741545416);
+    double a0 = 1.0 + k / shelfQ + k * k;
+    meter->shelf.b0 = (vh + vb * k / shelfQ + k * k) / a0;
+    meter->shelf.b1 = 2.0 * (k * k - vh) / a0;
+    meter->shelf.b2 = (vh - vb * k / shelfQ + k * k) / a0;
+    meter->shelf.a1 = 2.0 * (k * k - 1.0) / a0;
+    meter->shelf.a2 = (1.0 - k / shelfQ + k * k) / a0;
+
+    angle = MA_PI_D * highPassFrequency / sampleRate;
+    k = ma_sind(angle) / ma_cosd(angle);
+    a0 = 1.0 + k / highPassQ + k * k;
+    meter->highPass.b0 = 1.0;
+    meter->highPass.b1 = -2.0;
+    meter->highPass.b2 = 1.0;
+    meter->highPass.a1 = 2.0 * (k * k - 1.0) / a0;
+    meter->highPass.a2 = (1.0 - k / highPassQ + k * k) / a0;
+}
+
+static manet_meter* manet_meter_create(ma_uint32 channels, ma_uint32 sampleRate)
+{
+    if (channels == 0 || channels > MA_MAX_CHANNELS || sampleRate < MANET_METER_BLOCKS_PER_SECOND) {
+        return NULL;
+    }
+
+    manet_meter* meter = (manet_meter*)manet_alloc(sizeof(*meter));
+    if (meter == NULL) {
+        return NULL;
+    }
+
+    memset(meter, 0, sizeof(*meter));
+    meter->channelStates = (manet_meter_channel*)manet_alloc(sizeof(manet_meter_channel) * channels);
+    if (meter->channelStates == NULL) {
+        manet_free(meter);
+        return NULL;
+    }
+
+    memset(meter->channelStates, 0, sizeof(manet_meter_channel) * channels);
+    meter->channels = channels;
+    meter->blockFrames = sampleRate / MANET_METER_BLOCKS_PER_SECOND;
+    meter->snapshot.channels = channels;
+    manet_meter_init_filters(meter, sampleRate);
+
+    /* Surround channels count 1.41x and LFE is left out, per BS.1770. */
+    ma_channel channelMap[MA_MAX_CHANNELS];
+    ma_channel_map_init_standard(ma_standard_channel_map_default, channelMap, MA_MAX_CHANNELS, channels);
+    for (ma_uint32 channel = 0; channel < channels; channel += 1) {
+        switch (channelMap[channel]) {
+        case MA_CHANNEL_LFE:
+            meter->channelStates[channel].weight = 0.0;
+            break;
+        case MA_CHANNEL_SIDE_LEFT:
+        case MA_CHANNEL_SIDE_RIGHT:
+        case MA_CHANNEL_BACK_LEFT:
+        case MA_CHANNEL_BACK_RIGHT:
+            meter->channelStates[channel].weight = 1.41;
+            break;
+        default:
+            meter->channelStates[channel].weight = 1.0;
+            break;
+        }
+    }
+
+    return meter;
+}
+
+static void manet_meter_destroy(manet_meter* meter)
+{
+    if (meter == NULL) {
+        return;
+    }
+
+    manet_free(meter->channelStates);
+    manet_free(meter);
+}
+
+static double manet_meter_biquad_process(const manet_meter_biquad* filter, double* state, double x)
+{
+    double y = filter->b0 * x + state[0];
+    state[0] = filter->b1 * x - filter->a1 * y + state[1];
+    state[1] = filter->b2 * x - filter->a2 * y;
+    return y;
+}
+
+static double manet_meter_window_power(const manet_meter* meter, ma_uint32 blockCount)
+{
+    /* Blocks before the first one count as silence, so the windows ramp up from the start of the stream. */
+    double sum = 0.0;
+    for (ma_uint32 i = 0; i < blockCount; i += 1) {
+        sum += meter->blockPower[(meter->blockIndex + MANET_METER_SHORT_TERM_BLOCKS - 1u - i) % MANET_METER_SHORT_TERM_BLOCKS];
+    }
+
+    return sum / blockCount;
+}
+
+static void manet_meter_publish(manet_meter* meter)
+{
+    ma_uint32 sequence = ma_atomic_load_explicit_32(&meter->sequence, ma_atomic_memory_order_relaxed);
+    ma_atomic_store_explicit_32(&meter->sequence, sequence + 1u, ma_atomic_memory_order_relaxed);
+    ma_atomic_thread_fence(ma_atomic_memory_order_release);
+
+    const double momentaryFrames = (double)meter->blockFrames * MANET_METER_MOMENTARY_BLOCKS;
+    meter->snapshot.framesProcessed = meter->framesProcessed;
+    meter->snapshot.momentaryPower = (float)manet_meter_window_power(meter, MANET_METER_MOMENTARY_BLOCKS);
+    meter->snapshot.shortTermPower = (float)manet_meter_window_power(meter, MANET_METER_SHORT_TERM_BLOCKS);
+    for (ma_uint32 channel = 0; channel < meter->channels; channel += 1) {
+        const manet_meter_channel* state = &meter->channelStates[channel];
+        float peak = 0.0f;
+        double squares = 0.0;
+        for (ma_uint32 i = 0; i < MANET_METER_MOMENTARY_BLOCKS; i += 1) {
+            peak = state->peakHistory[i] > peak ? state->peakHistory[i] : peak;
+            squares += state->squareHistory[i];
+        }
+
+        meter->snapshot.peak[channel] = peak;
+        meter->snapshot.rms[channel] = (float)ma_sqrtd(squares / momentaryFrames);
+    }
+
+    ma_atomic_store_explicit_32(&meter->sequence, sequence + 2u, ma_atomic_memory_order_release);
+}
+
+static void manet_meter_finish_block(manet_meter* meter)
+{
+    const ma_uint32 history = meter->blockIndex % MANET_METER_MOMENTARY_BLOCKS;
+    double power = 0.0;
+    for (ma_uint32 channel = 0; channel < meter->channels; channel += 1) {
+        manet_meter_channel* state = &meter->channelStates[channel];
+        power += state->weight * state->blockWeighted;
+        state->squareHistory[history] = state->blockSquares;
+        state->peakHistory[history] = state->blockPeak;
+        state->blockWeighted = 0.0;
+        state->blockSquares = 0.0;
+        state->blockPeak = 0.0f;
+
+        /* Keep the filter tails out of the denormal range during silence. */
+        for (ma_uint32 i = 0; i < 2; i += 1) {
+            if (state->shelfState[i] > -1e-30 && state->shelfState[i] < 1e-30) {
+                state->shelfState[i] = 0.0;
+            }
+
+            if (state->highPassState[i] > -1e-30 && state->highPassState[i] < 1e-30) {
+                state->highPassState[i] = 0.0;
+            }
+        }
+    }
+
+    meter->blockPower[meter->blockIndex % MANET_METER_SHORT_TERM_BLOCKS] = power / meter->blockFrames;
+    meter->blockIndex = (meter->blockIndex + 1u) % (MANET_METER_MOMENTARY_BLOCKS * MANET_METER_SHORT_TERM_BLOCKS);
+    meter->framesInBlock = 0;
+    manet_meter_publish(meter);
+}
+
+static void manet_meter_process(manet_meter* meter, const float* frames, ma_uint64 frameCount)
+{
+    const ma_uint32 channels = meter->channels;
+    for (ma_uint64 frame = 0; frame < frameCount; frame += 1) {
+        const float* samples = frames + frame * channels;
+        for (ma_uint32 channel = 0; channel < channels; channel += 1) {
+            manet_meter_channel* state = &meter->channelStates[channel];
+            const float sample = samples[channel];
+            const float magnitude = sample < 0.0f ? -sample : sample;
+            if (magnitude > state->blockPeak) {
+                state->blockPeak = magnitude;
+            }
+
+            state->blockSquares += (double)sample * sample;
+            double weighted = manet_meter_biquad_process(&meter->shelf, state->shelfState, sample);
+            weighted = manet_meter_biquad_process(&meter->highPass, state->highPassState, weighted);
+            state->blockWeighted += weighted * weighted;
+        }
+
+        meter->framesProcessed += 1;
+        meter->framesInBlock += 1;
+        if (meter->framesInBlock == meter->blockFrames) {
+            manet_meter_finish_block(meter);
+        }
+    }
+}
+
+/* Replaces the engine's device callback rather than using its process hook, which only sees the frames the graph
+   produced and so would freeze the meter whenever nothing is playing. The engine is the first member of the handle
+   and is what miniaudio passes as the device user data. */
+static void manet_engine_metered_data_callback(ma_device* device, void* output, const void* input, ma_uint32 frameCount)
+{
+    manet_engine* handle = (manet_engine*)device->pUserData;
+    (void)input;
+
+    ma_engine_read_pcm_frames(&handle->engine, output, frameCount, NULL);
+    manet_meter_process(handle->meter, (const float*)output, frameCount);
+}
+
+MANET_API ma_result manet_engine_get_meter_snapshot(manet_engine* handle, manet_meter_snapshot* snapshot)
+{
+    if (snapshot != NULL) {
+        memset(snapshot, 0, sizeof(*snapshot));
+    }
+
+    if (manet_validate_engine(handle) != MA_SUCCESS || handle->meter == NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    if (snapshot == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    manet_meter* meter = handle->meter;
+    for (;;) {
+        ma_uint32 before = ma_atomic_load_explicit_32(&meter->sequence, ma_atomic_memory_order_acquire);
+        if ((before & 1u) == 0) {
+            memcpy(snapshot, &meter->snapshot, sizeof(*snapshot));
+            ma_atomic_thread_fence(ma_atomic_memory_order_acquire);
+            if (ma_atomic_load_explicit_32(&meter->sequence, ma_atomic_memory_order_relaxed) == before) {
+                return MA_SUCCESS;
+            }
+        }
+
+        ma_yield();
+    }
+}
+
+MANET_API manet_sound* manet_sound_create_from_pcm_frames(manet_engine* engineHandle, const float* frames, ma_uint64 frameCount, ma_uint32 channels, ma_uint32 sampleRate, ma_uint32 flags)
+{
+    if (frames == NULL) {
+        return NULL;
+    }
+
+    return manet_sound_create_pcm_buffer(engineHandle, frames, NULL, frameCount, channels, sampleRate, flags, MA_TRUE);
+}
+
+MANET_API manet_sound* manet_sound_create_from_pcm_planes(manet_engine* engineHandle, const float* const* planes, ma_uint64 frameCount, ma_uint32 channels, ma_uint32 sampleRate, ma_uint32 flags)
+{
+    if (planes == NULL) {
+        return NULL;
+    }
+
+    for (ma_uint32 channel = 0; channel < channels; channel += 1) {
+        if (planes[channel] == NULL) {
+            return NULL;
+        }
+    }
+
+    return manet_sound_create_pcm_buffer(engineHandle, NULL, planes, frameCount, channels, sampleRate, flags, MA_TRUE);
+}
+
+MANET_API manet_sound* manet_sound_create_from_pcm_frames_ref(manet_engine* engineHandle, const float* frames, ma_uint64 frameCount, ma_uint32 channels, ma_uint32 sampleRate, ma_uint32 flags)
+{
+    if (frames == NULL) {
+        return NULL;
+    }
+
+    /* The caller keeps frames alive (and unmoved) until the sound is destroyed. */
+    return manet_sound_create_pcm_buffer(engineHandle, frames, NULL, frameCount, channels, sampleRate, flags, MA_FALSE);
+}
+
+MANET_API manet_sound* manet_sound_create_from_pcm_buffer(manet_engine* engineHandle, manet_pcm_buffer* buffer, ma_uint32 flags)
+{
+    if (buffer == NULL) {
+        return NULL;
+    }
+
+    manet_sound* soundHandle = manet_sound_create_pcm_buffer(engineHandle, buffer->data, NULL, buffer->frameCount, buffer->channels, buffer->sampleRate, flags, MA_FALSE);
+    if (soundHandle == NULL) {
+        return NULL;
+    }
+
+    manet_pcm_buffer_retain(buffer);
+    soundHandle->sharedBuffer = buffer;
+    return soundHandle;
+}
+
+MANET_API manet_sound* manet_sound_create_instance(manet_sound* sourceHandle)
+{
+    if (manet_validate_sound(sourceHandle) != MA_SUCCESS) {
+        return NULL;
+    }
+
+    /* Every sound created by this bridge belongs to a manet_engine, whose first member is the ma_engine. */
+    manet_engine* engineHandle = (manet_engine*)ma_sound_get_engine(&sourceHandle->sound);
+
+    if (sourceHandle->sharedBuffer != NULL) {
+        manet_sound* instanceHandle = manet_sound_create_from_pcm_buffer(engineHandle, sourceHandle->sharedBuffer, sourceHandle->initFlags);
+        if (instanceHandle != NULL) {
+            manet_sound_copy_output_routing(sourceHandle, instanceHandle);
+        }
+
+        return instanceHandle;
+    }
+
+    if (sourceHandle->isStreaming || sourceHandle->ownsAudioBuffer) {
+        return NULL;
+    }
+
+    manet_sound* soundHandle = (manet_sound*)manet_alloc(sizeof(*soundHandle));
+    if (soundHandle == NULL) {
+        return NULL;
+    }
+
+    memset(soundHandle, 0, sizeof(*soundHandle));
+
+    /* Shares the resource manager's data buffer; fails for streams and sounds not loaded through the resource manager. */
+    ma_result result = ma_sound_init_copy(&engineHandle->engine, &sourceHandle->sound, sourceHandle->initFlags, NULL, &soundHandle->sound);
+    if (result != MA_SUCCESS) {
+        manet_free(soundHandle);
+        return NULL;
+    }
+
+    if (sourceHandle->registeredData != NULL) {
+        ma_atomic_uint32_fetch_add(&sourceHandle->registeredData->refCount, 1);
+        soundHandle->registeredData = sourceHandle->registeredData;
+    }
+
+    soundHandle->initFlags = sourceHandle->initFlags;
+    soundHandle->state = MANET_SOUND_STATE_STOPPED;
+    manet_sound_copy_output_routing(sourceHandle, soundHandle);
+
+    if (engineHandle->cache != NULL) {
+        manet_resource_cache_on_sound_loaded(engineHandle->cache, soundHandle);
+    }
+
+    return soundHandle;
+}
+
+/* Instances are created attached to the endpoint; route them wherever the source currently outputs instead, so an
+   instance of a sound in a group plays through that group. */
+static void manet_sound_copy_output_routing(manet_sound* sourceHandle, manet_sound* soundHandle)
+{
+    ma_node_output_bus* outputBus = &sourceHandle->sound.engineNode.baseNode.pOutputBuses[0];
+
+    ma_spinlock_lock(&outputBus->lock);
+    ma_node* target = (ma_node*)ma_atomic_load_ptr(&outputBus->pInputNode);
+    ma_uint32 targetInputBus = outputBus->inputNodeInputBusIndex;
+    ma_spinlock_unlock(&outputBus->lock);
+
+    if (target == NULL) {
+        ma_node_detach_output_bus(&soundHandle->sound, 0);
+    } else {
+        ma_node_attach_output_bus(&soundHandle->sound, 0, target, targetInputBus);
+    }
+}
+
+static manet_sound* manet_sound_create_pcm_buffer(manet_engine* engineHandle, const float* frames, const float* const* planes, ma_uint64 frameCount, ma_uint32 channels, ma_uint32 sampleRate, ma_uint32 flags, ma_bool32 copyFrames)
+{
+    if (manet_validate_engine(engineHandle) != MA_SUCCESS || channels == 0 || sampleRate == 0) {
+        return NULL;
+    }
+
+    manet_sound* soundHandle = (manet_sound*)manet_alloc(sizeof(*soundHandle));
+    if (soundHandle == NULL) {
+        return NULL;
+    }
+
+    memset(soundHandle, 0, sizeof(*soundHandle));
+
+    ma_audio_buffer_config bufferConfig = ma_audio_buffer_config_init(ma_format_f32, channels, frameCount, frames, NULL);
+    bufferConfig.sampleRate = sampleRate;
+    ma_result result = copyFrames ? ma_audio_buffer_init_copy(&bufferConfig, &soundHandle->audioBuffer) : ma_audio_buffer_init(&bufferConfig, &soundHandle->audioBuffer);
+    if (result != MA_SUCCESS) {
+        manet_free(soundHandle);
+        return NULL;
+    }
+
+    if (planes != NULL) {
+        /* The buffer was allocated (and silenced) without source data; interleave the planes into it directly. */
+        manet_interleave_f32_planes((float*)soundHandle->audioBuffer.ref.pData, planes, 0, frameCount, channels);
+    }
+
+    soundHandle->ownsAudioBuffer = MA_TRUE;
+
+    result = ma_sound_init_from_data_source(&engineHandle->engine, (ma_data_source*)&soundHandle->audioBuffer, flags, NULL, &soundHandle->sound);
+    if (result != MA_SUCCESS) {
+        ma_audio_buffer_uninit(&soundHandle->audioBuffer);
+        manet_free(soundHandle);
+        return NULL;
+    }
+
+    if ((flags & MA_SOUND_FLAG_LOOPING) != 0) {
+        ma_data_source_set_looping((ma_data_source*)&soundHandle->audioBuffer, MA_TRUE);
+    }
+
+    soundHandle->state = MANET_SOUND_STATE_STOPPED;
+    soundHandle->initFlags = flags;
+    return soundHandle;
+}
+
+MANET_API manet_sound* manet_sound_create_streaming_ex(manet_engine* engineHandle, ma_uint32 channels, ma_uint32 sampleRate, ma_uint32 capacityInFrames, ma_uint32 flags, ma_format inputFormat)
+{
+    if (manet_validate_engine(engineHandle) != MA_SUCCESS || channels == 0 || sampleRate == 0 || capacityInFrames == 0) {
+        return NULL;
+    }
+
+    manet_pcm_stream* stream = manet_pcm_stream_create(channels, sampleRate, capacityInFrames, inputFormat);
+    if (stream == NULL) {
+        return NULL;
+    }
+
+    manet_sound* soundHandle = (manet_sound*)manet_alloc(sizeof(*soundHandle));
+    if (soundHandle == NULL) {
+        manet_pcm_stream_destroy(stream);
+        return NULL;
+    }
+
+    memset(soundHandle, 0, sizeof(*soundHandle));
+
+    ma_result result = ma_sound_init_from_data_source(&engineHandle->engine, (ma_data_source*)&stream->ds, flags, NULL, &soundHandle->sound);
+    if (result != MA_SUCCESS) {
+        manet_pcm_stream_destroy(stream);
+        manet_free(soundHandle);
+        return NULL;
+    }
+
+    if ((flags & MA_SOUND_FLAG_LOOPING) != 0) {
+        ma_data_source_set_looping((ma_data_source*)&stream->ds, MA_TRUE);
+    }
+
+    soundHandle->state = MANET_SOUND_STATE_STOPPED;
+    soundHandle->stream = stream;
+    soundHandle->isStreaming = MA_TRUE;
+    soundHandle->ownsAudioBuffer = MA_FALSE;
+    return soundHandle;
+}
+
+MANET_API manet_sound* manet_sound_create_streaming(manet_engine* engineHandle, ma_uint32 channels, ma_uint32 sampleRate, ma_uint32 capacityInFrames, ma_uint32 flags)
+{
+    return manet_sound_create_streaming_ex(engineHandle, channels, sampleRate, capacityInFrames, flags, ma_format_f32);
+}
+
+MANET_API ma_result manet_sound_stream_append_pcm_frames(manet_sound* handle, const float* frames, ma_uint64 frameCount, ma_uint64* framesWritten)
+{
+    if (framesWritten != NULL) {
+        *framesWritten = 0;
+    }
+
+    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
+        return MA_INVALID_OPERATION;
+    }
+
+    return manet_pcm_stream_append_pcm_frames(handle->stream, frames, ma_format_f32, frameCount, framesWritten);
+}
+
+MANET_API ma_result manet_sound_stream_append_pcm_planes(manet_sound* handle, const float* const* planes, ma_uint64 frameCount, ma_uint64* framesWritten)
+{
+    if (framesWritten != NULL) {
+        *framesWritten = 0;
+    }
+
+    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
+        return MA_INVALID_OPERATION;
+    }
+
+    return manet_pcm_stream_append_pcm_planes(handle->stream, planes, frameCount, framesWritten);
+}
+
+MANET_API ma_result manet_sound_stream_append_raw_pcm_frames(manet_sound* handle, const void* frames, ma_uint64 frameCount, ma_uint64* framesWritten)
+{
+    if (framesWritten != NULL) {
+        *framesWritten = 0;
+    }
+
+    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
+        return MA_INVALID_OPERATION;
+    }
+
+    return manet_pcm_stream_append_pcm_frames(handle->stream, frames, handle->stream->inputFormat, frameCount, framesWritten);
+}
+
+MANET_API ma_format manet_sound_stream_get_input_format(manet_sound* handle)
+{
+    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
+        return ma_format_unknown;
+    }
+
+    return handle->stream->inputFormat;
+}
+
+MANET_API ma_result manet_sound_stream_acquire_write(manet_sound* handle, ma_uint32* frameCount, void** buffer)
+{
+    if (buffer != NULL) {
+        *buffer = NULL;
+    }
+
+    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
+        if (frameCount != NULL) {
+            *frameCount = 0;
+        }
+
+        return MA_INVALID_OPERATION;
+    }
+
+    return manet_pcm_stream_acquire_write(handle->stream, frameCount, buffer);
+}
+
+MANET_API ma_result manet_sound_stream_commit_write(manet_sound* handle, ma_uint32 frameCount)
+{
+    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
+        return MA_INVALID_OPERATION;
+    }
+
+    return manet_pcm_stream_commit_write(handle->stream, frameCount);
+}
+
+/* Blocks the calling thread until the audio thread raises a notification and returns the raised
+   manet_pcm_stream_notification bits. Meant for a dedicated waiter thread; returns MA_CANCELLED once
+   manet_sound_stream_close_notifications has been called. */
+MANET_API ma_result manet_sound_stream_wait_notifications(manet_sound* handle, ma_uint32* notifications)
+{
+    if (notifications != NULL) {
+        *notifications = 0;
+    }
+
+    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
+        return MA_INVALID_OPERATION;
+    }
+
+    if (notifications == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    return manet_signal_wait(&handle->stream->signal, notifications);
+}
+
+/* Releases a thread blocked in manet_sound_stream_wait_notifications for good; call before destroying the sound. */
+MANET_API ma_result manet_sound_stream_close_notifications(manet_sound* handle)
+{
+    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
+        return MA_INVALID_OPERATION;
+    }
+
+    manet_signal_close(&handle->stream->signal);
+    return MA_SUCCESS;
+}
+
+MANET_API ma_result manet_sound_stream_set_low_watermark(manet_sound* handle, ma_uint32 frames)
+{
+    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
+        return MA_INVALID_OPERATION;
+    }
+
+    if (frames > manet_pcm_stream_capacity(handle->stream)) {
+        return MA_INVALID_ARGS;
+    }
+
+    manet_pcm_stream_set_low_watermark(handle->stream, frames);
+    return MA_SUCCESS;
+}
+
+MANET_API ma_result manet_sound_stream_request_write_space(manet_sound* handle, ma_uint32 frames)
+{
+    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
+        return MA_INVALID_OPERATION;
+    }
+
+    if (frames > manet_pcm_stream_capacity(handle->stream)) {
+        return MA_INVALID_ARGS;
+    }
+
+    manet_pcm_stream_request_write_space(handle->stream, frames);
+    return MA_SUCCESS;
+}
+
+MANET_API ma_result manet_sound_stream_get_statistics(manet_sound* handle, manet_pcm_stream_stats* stats)
+{
+    if (stats != NULL) {
+        memset(stats, 0, sizeof(*stats));
+    }
+
+    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
+        return MA_INVALID_OPERATION;
+    }
+
+    if (stats == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    manet_pcm_stream_get_stats(handle->stream, stats);
+    return MA_SUCCESS;
+}
+
+MANET_API ma_result manet_sound_stream_reset_statistics(manet_sound* handle)
+{
+    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
+        return MA_INVALID_OPERATION;
+    }
+
+    manet_pcm_stream_reset_stats(handle->stream);
+    return MA_SUCCESS;
+}
+
+MANET_API ma_result manet_sound_stream_get_available_write(manet_sound* handle, ma_uint64* availableFrames)
+{
+    if (availableFrames != NULL) {
+        *availableFrames = 0;
+    }
+
+    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
+        return MA_INVALID_OPERATION;
+    }
+
+    if (availableFrames != NULL) {
+        *availableFrames = manet_pcm_stream_available_write(handle->stream);
+    }
+
+    return MA_SUCCESS;
+}
+
+MANET_API ma_result manet_sound_stream_get_queued_frames(manet_sound* handle, ma_uint64* queuedFrames)
+{
+    if (queuedFrames != NULL) {
+        *queuedFrames = 0;
+    }
+
+    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
+        return MA_INVALID_OPERATION;
+    }
+
+    if (queuedFrames != NULL) {
+        *queuedFrames = manet_pcm_stream_available_read(handle->stream);
+    }
+
+    return MA_SUCCESS;
+}
+
+MANET_API ma_uint64 manet_sound_stream_get_capacity_in_frames(manet_sound* handle)
+{
+    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
+        return 0;
+    }
+
+    return manet_pcm_stream_capacity(handle->stream);
+}
+
+MANET_API ma_result manet_sound_stream_mark_end(manet_sound* handle)
+{
+    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
+        return MA_INVALID_OPERATION;
+    }
+
+    manet_pcm_stream_mark_end(handle->stream);
+    return MA_SUCCESS;
+}
+
+MANET_API ma_result manet_sound_stream_clear_end(manet_sound* handle)
+{
+    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
+        return MA_INVALID_OPERATION;
+    }
+
+    manet_pcm_stream_clear_end(handle->stream);
+    return MA_SUCCESS;
+}
+
+MANET_API ma_bool32 manet_sound_stream_is_end(manet_sound* handle)
+{
+    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
+        return MA_FALSE;
+    }
+
+    return manet_pcm_stream_is_end_requested(handle->stream);
+}
+
+MANET_API ma_result manet_sound_stream_reset(manet_sound* handle)
+{
+    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
+        return MA_INVALID_OPERATION;
+    }
+
+    ma_result result = manet_pcm_stream_reset(handle->stream);
+    if (result != MA_SUCCESS) {
+        return result;
+    }
+
+    ma_sound_seek_to_pcm_frame(&handle->sound, 0);
+    return MA_SUCCESS;
+}
+
+MANET_API ma_uint32 manet_sound_stream_get_channels(manet_sound* handle)
+{
+    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
+        return 0;
+    }
+
+    return manet_pcm_stream_get_channels(handle->stream);
+}
+
+MANET_API ma_uint32 manet_sound_stream_get_sample_rate(manet_sound* handle)
+{
+    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
+        return 0;
+    }
+
+    return manet_pcm_stream_get_sample_rate(handle->stream);
+}
+
+MANET_API manet_pcm_buffer* manet_pcm_buffer_create(const float* frames, ma_uint64 frameCount, ma_uint32 channels, ma_uint32 sampleRate)
+{
+    if (frames == NULL || frameCount == 0 || channels == 0 || sampleRate == 0) {
+        return NULL;
+    }
+
+    ma_uint64 dataSizeInBytes = frameCount * ma_get_bytes_per_frame(ma_format_f32, channels);
+    if (dataSizeInBytes > MA_SIZE_MAX - sizeof(manet_pcm_buffer)) {
+        return NULL;
+    }
+
+    manet_pcm_buffer* buffer = (manet_pcm_buffer*)manet_alloc(sizeof(*buffer) + (size_t)dataSizeInBytes);
+    if (buffer == NULL) {
+        return NULL;
+    }
+
+    memset(buffer, 0, sizeof(*buffer));
+    buffer->channels = channels;
+    buffer->sampleRate = sampleRate;
+    buffer->frameCount = frameCount;
+    buffer->data = (float*)(buffer + 1);
+    memcpy(buffer->data, frames, (size_t)dataSizeInBytes);
+    ma_atomic_uint32_set(&buffer->refCount, 1);
+
+    return buffer;
+}
+
+static void manet_pcm_buffer_retain(manet_pcm_buffer* buffer)
+{
+    ma_atomic_uint32_fetch_add(&buffer->refCount, 1);
+}
+
+MANET_API void manet_pcm_buffer_release(manet_pcm_buffer* buffer)
+{
+    if (buffer == NULL) {
+        return;
+    }
+
+    if (ma_atomic_uint32_fetch_sub(&buffer->refCount, 1) == 1) {
+        manet_free(buffer);
+    }
+}
+
+MANET_API void manet_voice_pool_destroy(manet_voice_pool* handle)
+{
+    if (handle == NULL) {
+        return;
+    }
+
+    if (handle->voices != NULL) {
+        for (ma_uint32 i = 0; i < handle->capacity; ++i) {
+            manet_voice* voice = &handle->voices[i];
+            if (voice->isSoundInitialized) {
+                ma_sound_uninit(&voice->sound);
+            }
+
+            ma_data_source_uninit(&voice->ds);
+            manet_pcm_buffer_release(voice->clip);
+        }
+
+        manet_free(handle->voices);
+    }
+
+    ma_mutex_uninit(&handle->lock);
+    manet_free(handle);
+}
+
+MANET_API manet_voice_pool* manet_voice_pool_create(manet_engine* engineHandle, ma_uint32 capacity, ma_uint32 channels, ma_uint32 sampleRate, ma_uint32 flags, manet_voice_steal_policy policy)
+{
+    if (manet_validate_engine(engineHandle) != MA_SUCCESS || capacity == 0 || channels == 0 || sampleRate == 0) {
+        return NULL;
+    }
+
+    ma_uint64 voicesSizeInBytes = (ma_uint64)capacity * sizeof(manet_voice);
+    if (policy > MANET_VOICE_STEAL_QUIETEST || voicesSizeInBytes > MA_SIZE_MAX) {
+        return NULL;
+    }
+
+    manet_voice_pool* pool = (manet_voice_pool*)manet_alloc(sizeof(*pool));
+    if (pool == NULL) {
+        return NULL;
+    }
+
+    memset(pool, 0, sizeof(*pool));
+
+    if (ma_mutex_init(&pool->lock) != MA_SUCCESS) {
+        manet_free(pool);
+        return NULL;
+    }
+
+    pool->voices = (manet_voice*)manet_alloc((size_t)voicesSizeInBytes);
+    if (pool->voices == NULL) {
+        manet_voice_pool_destroy(pool);
+        return NULL;
+    }
+
+    memset(pool->voices, 0, (size_t)voicesSizeInBytes);
+    pool->capacity = capacity;
+    pool->channels = channels;
+    pool->sampleRate = sampleRate;
+    pool->policy = policy;
+
+    /* Voices always play a clip once; looping and streaming make no sense for a recycled slot. */
+    flags &= ~(ma_uint32)(MA_SOUND_FLAG_LOOPING | MA_SOUND_FLAG_STREAM | MA_SOUND_FLAG_ASYNC);
+
+    ma_data_source_config dsConfig = ma_data_source_config_init();
+    dsConfig.vtable = &g_manet_voice_vtable;
+
+    for (ma_uint32 i = 0; i < capacity; ++i) {
+        manet_voice* voice = &pool->voices[i];
+
+        voice->channels = channels;
+        voice->sampleRate = sampleRate;
+
+        ma_result result = ma_data_source_init(&dsConfig, &voice->ds);
+        if (result == MA_SUCCESS) {
+            result = ma_sound_init_from_data_source(&engineHandle->engine, (ma_data_source*)voice, flags, NULL, &voice->sound);
+        }
+
+        if (result != MA_SUCCESS) {
+            manet_voice_pool_destroy(pool);
+            return NULL;
+        }
+
+        voice->isSoundInitialized = MA_TRUE;
+        ma_sound_set_end_callback(&voice->sound, manet_voice_end_callback, voice);
+    }
+
+    return pool;
+}
+
+MANET_API ma_result manet_voice_pool_play(manet_voice_pool* handle, manet_pcm_buffer* clip, float volume, float pan)
+{
+    if (handle == NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    if (clip == NULL || clip->channels != handle->channels || clip->sampleRate != handle->sampleRate) {
+        return MA_INVALID_ARGS;
+    }
+
+    ma_mutex_lock(&handle->lock);
+
+    manet_voice* voice = manet_voice_pool_acquire_voice(handle);
+    if (voice == NULL) {
+        ma_mutex_unlock(&handle->lock);
+        ma_atomic_uint64_fetch_add(&handle->rejectCount, 1);
+        return MA_BUSY;
+    }
+
+    manet_pcm_buffer_retain(clip);
+
+    manet_pcm_buffer* previousClip = (manet_pcm_buffer*)ma_atomic_exchange_ptr(&voice->clip, NULL);
+    while (ma_atomic_uint32_get(&voice->readers) != 0) {
+        ma_yield();
+    }
+
+    /* No read can still be using the previous clip, so dropping our reference here is safe. */
+    manet_pcm_buffer_release(previousClip);
+
+    ma_uint32 generation = ma_atomic_uint32_fetch_add(&voice->generation, 1) + 1;
+    if (generation == 0) {
+        generation = ma_atomic_uint32_fetch_add(&voice->generation, 1) + 1;
+    }
+
+    ma_atomic_uint64_set(&voice->cursor, 0);
+    ma_atomic_store_ptr(&voice->clip, clip);
+
+    voice->startSequence = handle->nextSequence++;
+    voice->volume = volume;
+    ma_sound_set_volume(&voice->sound, volume);
+    ma_sound_set_pan(&voice->sound, pan);
+
+    ma_atomic_uint32_set(&voice->activeGeneration, generation);
+    ma_result result = ma_sound_start(&voice->sound);
+    if (result != MA_SUCCESS) {
+        ma_atomic_uint32_set(&voice->activeGeneration, 0);
+    }
+
+    ma_mutex_unlock(&handle->lock);
+
+    if (result == MA_SUCCESS) {
+        ma_atomic_uint64_fetch_add(&handle->playCount, 1);
+    }
+
+    return result;
+}
+
+MANET_API ma_result manet_voice_pool_stop_all(manet_voice_pool* handle)
+{
+    if (handle == NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    ma_mutex_lock(&handle->lock);
+    for (ma_uint32 i = 0; i < handle->capacity; ++i) {
+        manet_voice* voice = &handle->voices[i];
+        ma_sound_stop(&voice->sound);
+        ma_atomic_uint32_set(&voice->activeGeneration, 0);
+    }
+    ma_mutex_unlock(&handle->lock);
+
+    return MA_SUCCESS;
+}
+
+/* Routes every voice of the pool to the given node, e.g. a sound group. */
+MANET_API ma_result manet_voice_pool_attach_output(manet_voice_pool* handle, ma_node* target, ma_uint32 targetInputBusIndex)
+{
+    if (handle == NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    if (target == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    ma_mutex_lock(&handle->lock);
+    ma_result result = MA_SUCCESS;
+    for (ma_uint32 i = 0; i < handle->capacity && result == MA_SUCCESS; ++i) {
+        result = ma_node_attach_output_bus(&handle->voices[i].sound, 0, target, targetInputBusIndex);
+    }
+    ma_mutex_unlock(&handle->lock);
+
+    return result;
+}
+
+MANET_API ma_result manet_voice_pool_get_stats(manet_voice_pool* handle, manet_voice_pool_stats* stats)
+{
+    if (stats != NULL) {
+        memset(stats, 0, sizeof(*stats));
+    }
+
+    if (handle == NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    if (stats == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    stats->capacity = handle->capacity;
+    for (ma_uint32 i = 0; i < handle->capacity; ++i) {
+        if (ma_atomic_uint32_get(&handle->voices[i].activeGeneration) != 0) {
+            stats->activeVoices += 1;
+        }
+    }
+
+    stats->playCount = ma_atomic_uint64_get(&handle->playCount);
+    stats->stealCount = ma_atomic_uint64_get(&handle->stealCount);
+    stats->rejectCount = ma_atomic_uint64_get(&handle->rejectCount);
+    return MA_SUCCESS;
+}
+
+MANET_API manet_sound_group* manet_sound_group_create(manet_engine* engineHandle, ma_uint32 flags, manet_sound_group* parent)
+{
+    if (manet_validate_engine(engineHandle) != MA_SUCCESS) {
+        return NULL;
+    }
+
+    manet_sound_group* handle = (manet_sound_group*)manet_alloc(sizeof(*handle));
+    if (handle == NULL) {
+        return NULL;
+    }
+
+    memset(handle, 0, sizeof(*handle));
+
+    ma_result result = ma_sound_group_init(&engineHandle->engine, flags, parent != NULL ? &parent->group : NULL, &handle->group);
+    if (result != MA_SUCCESS) {
+        manet_free(handle);
+        return NULL;
+    }
+
+    return handle;
+}
+
+MANET_API void manet_sound_group_destroy(manet_sound_group* handle)
+{
+    if (handle == NULL) {
+        return;
+    }
+
+    /* Sounds still routed into the group are left detached, not re-attached to the endpoint. */
+    ma_sound_group_uninit(&handle->group);
+    manet_free(handle);
+}
+
+MANET_API ma_result manet_sound_group_start(manet_sound_group* handle)
+{
+    if (handle == NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    return ma_sound_group_start(&handle->group);
+}
+
+MANET_API ma_result manet_sound_group_stop(manet_sound_group* handle)
+{
+    if (handle == NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    return ma_sound_group_stop(&handle->group);
+}
+
+MANET_API ma_bool32 manet_sound_group_is_playing(manet_sound_group* handle)
+{
+    return handle != NULL ? ma_sound_group_is_playing(&handle->group) : MA_FALSE;
+}
+
+MANET_API ma_result manet_sound_group_set_volume(manet_sound_group* handle, float volume)
+{
+    if (handle == NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    ma_sound_group_set_volume(&handle->group, volume);
+    return MA_SUCCESS;
+}
+
+MANET_API float manet_sound_group_get_volume(manet_sound_group* handle)
+{
+    return handle != NULL ? ma_sound_group_get_volume(&handle->group) : 0.0f;
+}
+
+MANET_API ma_result manet_sound_group_set_pitch(manet_sound_group* handle, float pitch)
+{
+    if (handle == NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    ma_sound_group_set_pitch(&handle->group, pitch);
+    return MA_SUCCESS;
+}
+
+MANET_API float manet_sound_group_get_pitch(manet_sound_group* handle)
+{
+    return handle != NULL ? ma_sound_group_get_pitch(&handle->group) : 0.0f;
+}
+
+MANET_API ma_result manet_sound_group_set_pan(manet_sound_group* handle, float pan)
+{
+    if (handle == NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    ma_sound_group_set_pan(&handle->group, pan);
+    return MA_SUCCESS;
+}
+
+MANET_API float manet_sound_group_get_pan(manet_sound_group* handle)
+{
+    return handle != NULL ? ma_sound_group_get_pan(&handle->group) : 0.0f;
+}
+
+MANET_API manet_splitter* manet_splitter_create(manet_engine* engineHandle, ma_uint32 channels, ma_uint32 outputBusCount)
+{
+    if (manet_validate_engine(engineHandle) != MA_SUCCESS || channels == 0 || channels > MA_MAX_CHANNELS ||
+        outputBusCount == 0 || outputBusCount > MA_MAX_NODE_BUS_COUNT) {
+        return NULL;
+    }
+
+    manet_splitter* handle = (manet_splitter*)manet_alloc(sizeof(*handle));
+    if (handle == NULL) {
+        return NULL;
+    }
+
+    memset(handle, 0, sizeof(*handle));
+
+    ma_splitter_node_config config = ma_splitter_node_config_init(channels);
+    config.outputBusCount = outputBusCount;
+
+    ma_result result = ma_splitter_node_init(ma_engine_get_node_graph(&engineHandle->engine), &config, NULL, &handle->node);
+    if (result != MA_SUCCESS) {
+        manet_free(handle);
+        return NULL;
+    }
+
+    return handle;
+}
+
+MANET_API void manet_splitter_destroy(manet_splitter* handle)
+{
+    if (handle == NULL) {
+        return;
+    }
+
+    ma_splitter_node_uninit(&handle->node, NULL);
+    manet_free(handle);
+}
+
+static manet_effect_node* manet_effect_node_alloc(manet_engine* engineHandle, manet_effect_type type, ma_uint32 channels)
+{
+    if (manet_validate_engine(engineHandle) != MA_SUCCESS || channels == 0 || channels > MA_MAX_CHANNELS) {
+        return NULL;
+    }
+
+    manet_effect_node* handle = (manet_effect_node*)manet_alloc(sizeof(*handle));
+    if (handle == NULL) {
+        return NULL;
+    }
+
+    memset(handle, 0, sizeof(*handle));
+    handle->type = type;
+    handle->channels = channels;
+    handle->sampleRate = ma_engine_get_sample_rate(&engineHandle->engine);
+    return handle;
+}
+
+static manet_effect_node* manet_effect_node_finish_create(manet_effect_node* handle, ma_result result)
+{
+    if (result != MA_SUCCESS) {
+        manet_free(handle);
+        return NULL;
+    }
+
+    return handle;
+}
+
+/* Filter frequencies must lie strictly between 0 and Nyquist; the comparisons also reject NaN and infinity. */
+static ma_bool32 manet_effect_frequency_is_valid(double frequency, ma_uint32 sampleRate)
+{
+    return frequency > 0 && frequency < sampleRate / 2.0;
+}
+
+MANET_API manet_effect_node* manet_effect_node_create_low_pass(manet_engine* engineHandle, ma_uint32 channels, double cutoffFrequency, ma_uint32 order)
+{
+    if (order == 0 || order > MA_MAX_FILTER_ORDER) {
+        return NULL;
+    }
+
+    manet_effect_node* handle = manet_effect_node_alloc(engineHandle, MANET_EFFECT_LOW_PASS, channels);
+    if (handle == NULL) {
+        return NULL;
+    }
+
+    if (!manet_effect_frequency_is_valid(cutoffFrequency, handle->sampleRate)) {
+        manet_free(handle);
+        return NULL;
+    }
+
+    handle->order = order;
+    ma_lpf_node_config config = ma_lpf_node_config_init(channels, handle->sampleRate, cutoffFrequency, order);
+    return manet_effect_node_finish_create(handle, ma_lpf_node_init(ma_engine_get_node_graph(&engineHandle->engine), &config, NULL, &handle->node.lowPass));
+}
+
+MANET_API manet_effect_node* manet_effect_node_create_high_pass(manet_engine* engineHandle, ma_uint32 channels, double cutoffFrequency, ma_uint32 order)
+{
+    if (order == 0 || order > MA_MAX_FILTER_ORDER) {
+        return NULL;
+    }
+
+    manet_effect_node* handle = manet_effect_node_alloc(engineHandle, MANET_EFFECT_HIGH_PASS, channels);
+    if (handle == NULL) {
+        return NULL;
+    }
+
+    if (!manet_effect_frequency_is_valid(cutoffFrequency, handle->sampleRate)) {
+        manet_free(handle);
+        return NULL;
+    }
+
+    handle->order = order;
+    ma_hpf_node_config config = ma_hpf_node_config_init(channels, handle->sampleRate, cutoffFrequency, order);
+    return manet_effect_node_finish_create(handle, ma_hpf_node_init(ma_engine_get_node_graph(&engineHandle->engine), &config, NULL, &handle->node.highPass));
+}
+
+MANET_API manet_effect_node* manet_effect_node_create_biquad(manet_engine* engineHandle, ma_uint32 channels, float b0, float b1, float b2, float a0, float a1, float a2)
+{
+    if (a0 == 0) {
+        return NULL;
+    }
+
+    manet_effect_node* handle = manet_effect_node_alloc(engineHandle, MANET_EFFECT_BIQUAD, channels);
+    if (handle == NULL) {
+        return NULL;
+    }
+
+    ma_biquad_node_config config = ma_biquad_node_config_init(channels, b0, b1, b2, a0, a1, a2);
+    return manet_effect_node_finish_create(handle, ma_biquad_node_init(ma_engine_get_node_graph(&engineHandle->engine), &config, NULL, &handle->node.biquad));
+}
+
+MANET_API manet_effect_node* manet_effect_node_create_peaking_eq(manet_engine* engineHandle, ma_uint32 channels, double gainDb, double q, double frequency)
+{
+    if (!(q > 0 && q <= DBL_MAX) || !(gainDb >= -DBL_MAX && gainDb <= DBL_MAX)) {
+        return NULL;
+    }
+
+    manet_effect_node* handle = manet_effect_node_alloc(engineHandle, MANET_EFFECT_PEAKING_EQ, channels);
+    if (handle == NULL) {
+        return NULL;
+    }
+
+    if (!manet_effect_frequency_is_valid(frequency, handle->sampleRate)) {
+        manet_free(handle);
+        return NULL;
+    }
+
+    ma_peak_node_config config = ma_peak_node_config_init(channels, handle->sampleRate, gainDb, q, frequency);
+    return manet_effect_node_finish_create(handle, ma_peak_node_init(ma_engine_get_node_graph(&engineHandle->engine), &config, NULL, &handle->node.peakingEq));
+}
+
+MANET_API manet_effect_node* manet_effect_node_create_delay(manet_engine* engineHandle, ma_uint32 channels, ma_uint32 delayInFrames, float decay)
+{
+    if (delayInFrames == 0) {
+        return NULL;
+    }
+
+    manet_effect_node* handle = manet_effect_node_alloc(engineHandle, MANET_EFFECT_DELAY, channels);
+    if (handle == NULL) {
+        return NULL;
+    }
+
+    ma_delay_node_config config = ma_delay_node_config_init(channels, handle->sampleRate, delayInFrames, decay);
+    return manet_effect_node_finish_create(handle, ma_delay_node_init(ma_engine_get_node_graph(&engineHandle->engine), &config, NULL, &handle->node.delay));
+}
+
+MANET_API void manet_effect_node_destroy(manet_effect_node* handle)
+{
+    if (handle == NULL) {
+        return;
+    }
+
+    switch (handle->type) {
+        case MANET_EFFECT_LOW_PASS:
+            ma_lpf_node_uninit(&handle->node.lowPass, NULL);
+            break;
+        case MANET_EFFECT_HIGH_PASS:
+            ma_hpf_node_uninit(&handle->node.highPass, NULL);
+            break;
+        case MANET_EFFECT_BIQUAD:
+            ma_biquad_node_uninit(&handle->node.biquad, NULL);
+            break;
+        case MANET_EFFECT_PEAKING_EQ:
+            ma_peak_node_uninit(&handle->node.peakingEq, NULL);
+            break;
+        case MANET_EFFECT_DELAY:
+            ma_delay_node_uninit(&handle->node.delay, NULL);
+            break;
+    }
 
-MANET_API ma_result manet_context_get_devices(
-    manet_context* handle,
-    ma_device_type deviceType,
-    manet_device_descriptor* descriptors,
-    ma_uint32 descriptorCapacity,
-    ma_uint32* outDeviceCount)
+    manet_free(handle);
+}
+
+/* The filter order is fixed at creation; miniaudio cannot change it without reallocating the filter state. */
+MANET_API ma_result manet_effect_node_set_cutoff(manet_effect_node* handle, double cutoffFrequency)
 {
-    if (manet_validate_context(handle) != MA_SUCCESS) {
-        if (outDeviceCount != NULL) {
-            *outDeviceCount = 0;
-        }
+    if (handle == NULL || (handle->type != MANET_EFFECT_LOW_PASS && handle->type != MANET_EFFECT_HIGH_PASS)) {
+        return MA_INVALID_OPERATION;
+    }
+
+    if (!manet_effect_frequency_is_valid(cutoffFrequency, handle->sampleRate)) {
+        return MA_INVALID_ARGS;
+    }
+
+    if (handle->type == MANET_EFFECT_LOW_PASS) {
+        ma_lpf_config config = ma_lpf_config_init(ma_format_f32, handle->channels, handle->sampleRate, cutoffFrequency, handle->order);
+        return ma_lpf_node_reinit(&config, &handle->node.lowPass);
+    }
+
+    ma_hpf_config config = ma_hpf_config_init(ma_format_f32, handle->channels, handle->sampleRate, cutoffFrequency, handle->order);
+    return ma_hpf_node_reinit(&config, &handle->node.highPass);
+}
 
+MANET_API ma_result manet_effect_node_set_biquad(manet_effect_node* handle, float b0, float b1, float b2, float a0, float a1, float a2)
+{
+    if (handle == NULL || handle->type != MANET_EFFECT_BIQUAD) {
         return MA_INVALID_OPERATION;
     }
 
-    ma_device_info* playbackInfos = NULL;
-    ma_device_info* captureInfos = NULL;
-    ma_uint32 playbackCount = 0;
-    ma_uint32 captureCount = 0;
-    ma_result result = ma_context_get_devices(&handle->context, &playbackInfos, &playbackCount, &captureInfos, &captureCount);
-    if (result != MA_SUCCESS) {
-        if (outDeviceCount != NULL) {
-            *outDeviceCount = 0;
-        }
+    if (a0 == 0) {
+        return MA_INVALID_ARGS;
+    }
 
-        return result;
+    ma_biquad_config config = ma_biquad_config_init(ma_format_f32, handle->channels, b0, b1, b2, a0, a1, a2);
+    return ma_biquad_node_reinit(&config, &handle->node.biquad);
+}
+
+MANET_API ma_result manet_effect_node_set_peaking_eq(manet_effect_node* handle, double gainDb, double q, double frequency)
+{
+    if (handle == NULL || handle->type != MANET_EFFECT_PEAKING_EQ) {
+        return MA_INVALID_OPERATION;
     }
 
-    ma_device_info* sourceInfos = playbackInfos;
-    ma_uint32 sourceCount = playbackCount;
-    if (deviceType == ma_device_type_capture) {
-        sourceInfos = captureInfos;
-        sourceCount = captureCount;
+    if (!(q > 0 && q <= DBL_MAX) || !(gainDb >= -DBL_MAX && gainDb <= DBL_MAX) || !manet_effect_frequency_is_valid(frequency, handle->sampleRate)) {
+        return MA_INVALID_ARGS;
     }
 
-    if (outDeviceCount != NULL) {
-        *outDeviceCount = sourceCount;
+    ma_peak2_config config = ma_peak2_config_init(ma_format_f32, handle->channels, handle->sampleRate, gainDb, q, frequency);
+    return ma_peak_node_reinit(&config, &handle->node.peakingEq);
+}
+
+MANET_API ma_result manet_effect_node_set_delay_mix(manet_effect_node* handle, float wet, float dry, float decay)
+{
+    if (handle == NULL || handle->type != MANET_EFFECT_DELAY) {
+        return MA_INVALID_OPERATION;
     }
 
-    if (descriptors == NULL || descriptorCapacity == 0 || sourceInfos == NULL) {
-        return MA_SUCCESS;
+    ma_delay_node_set_wet(&handle->node.delay, wet);
+    ma_delay_node_set_dry(&handle->node.delay, dry);
+    ma_delay_node_set_decay(&handle->node.delay, decay);
+    return MA_SUCCESS;
+}
+
+MANET_API ma_result manet_effect_node_get_delay_mix(manet_effect_node* handle, float* wet, float* dry, float* decay)
+{
+    if (wet != NULL) {
+        *wet = 0.0f;
     }
 
-    ma_uint32 copyCount = manet_min_u32(descriptorCapacity, sourceCount);
-    for (ma_uint32 i = 0; i < copyCount; ++i) {
-        manet_write_device_descriptor(&descriptors[i], &sourceInfos[i], deviceType);
+    if (dry != NULL) {
+        *dry = 0.0f;
+    }
+
+    if (decay != NULL) {
+        *decay = 0.0f;
+    }
+
+    if (handle == NULL || handle->type != MANET_EFFECT_DELAY) {
+        return MA_INVALID_OPERATION;
+    }
+
+    if (wet == NULL || dry == NULL || decay == NULL) {
+        return MA_INVALID_ARGS;
     }
 
+    *wet = ma_delay_node_get_wet(&handle->node.delay);
+    *dry = ma_delay_node_get_dry(&handle->node.delay);
+    *decay = ma_delay_node_get_decay(&handle->node.delay);
     return MA_SUCCESS;
 }
 
-MANET_API manet_sound* manet_sound_create_from_file(manet_engine* engineHandle, const char* path, ma_uint32 flags)
+static void manet_custom_node_process(ma_node* node, const float** framesIn, ma_uint32* frameCountIn, float** framesOut, ma_uint32* frameCountOut)
+{
+    manet_custom_node* handle = (manet_custom_node*)node;
+    ma_uint32 inputBusCount = ma_node_get_input_bus_count(node);
+    ma_uint32 frameCount = *frameCountOut;
+
+    /* Without MA_NODE_FLAG_DIFFERENT_PROCESSING_RATES input and output advance together, so process what both sides allow. */
+    if (inputBusCount > 0 && *frameCountIn < frameCount) {
+        frameCount = *frameCountIn;
+    }
+
+    manet_node_process_info info;
+    info.userData = handle->userData;
+    info.inputs = inputBusCount > 0 ? (const float* const*)framesIn : NULL;
+    info.outputs = framesOut;
+    info.inputBusCount = inputBusCount;
+    info.outputBusCount = ma_node_get_output_bus_count(node);
+    info.channels = handle->channels;
+    info.frameCount = frameCount;
+
+    if (frameCount > 0) {
+        handle->process(&info);
+    }
+
+    if (inputBusCount > 0) {
+        *frameCountIn = frameCount;
+    }
+
+    *frameCountOut = frameCount;
+}
+
+MANET_API manet_custom_node* manet_custom_node_create(manet_engine* engineHandle, ma_uint32 inputBusCount, ma_uint32 outputBusCount, ma_uint32 channels, ma_uint32 flags, manet_custom_node_process_proc process, void* userData)
 {
-    if (manet_validate_engine(engineHandle) != MA_SUCCESS || path == NULL) {
+    if (manet_validate_engine(engineHandle) != MA_SUCCESS || process == NULL) {
         return NULL;
     }
 
-    manet_sound* soundHandle = (manet_sound*)manet_alloc(sizeof(*soundHandle));
-    if (soundHandle == NULL) {
+    if (inputBusCount > MA_MAX_NODE_BUS_COUNT || outputBusCount == 0 || outputBusCount > MA_MAX_NODE_BUS_COUNT) {
         return NULL;
     }
 
-    memset(soundHandle, 0, sizeof(*soundHandle));
+    if (channels == 0 || channels > MA_MAX_CHANNELS || (flags & ~(ma_uint32)MANET_CUSTOM_NODE_FLAGS) != 0) {
+        return NULL;
+    }
+
+    manet_custom_node* handle = (manet_custom_node*)manet_alloc(sizeof(*handle));
+    if (handle == NULL) {
+        return NULL;
+    }
+
+    memset(handle, 0, sizeof(*handle));
+    handle->vtable.onProcess = manet_custom_node_process;
+    handle->vtable.inputBusCount = (ma_uint8)inputBusCount;
+    handle->vtable.outputBusCount = (ma_uint8)outputBusCount;
+    handle->vtable.flags = flags;
+    handle->process = process;
+    handle->userData = userData;
+    handle->channels = channels;
+
+    ma_uint32 busChannels[MA_MAX_NODE_BUS_COUNT];
+    for (ma_uint32 i = 0; i < MA_MAX_NODE_BUS_COUNT; ++i) {
+        busChannels[i] = channels;
+    }
+
+    ma_node_config config = ma_node_config_init();
+    config.vtable = &handle->vtable;
+    config.pInputChannels = busChannels;
+    config.pOutputChannels = busChannels;
 
-    ma_result result = ma_sound_init_from_file(&engineHandle->engine, path, flags, NULL, NULL, &soundHandle->sound);
+    ma_result result = ma_node_init(ma_engine_get_node_graph(&engineHandle->engine), &config, NULL, &handle->base);
     if (result != MA_SUCCESS) {
-        manet_free(soundHandle);
+        manet_free(handle);
         return NULL;
     }
 
-    soundHandle->state = MANET_SOUND_STATE_STOPPED;
-    return soundHandle;
+    return handle;
+}
+
+/* ma_node_uninit detaches the node and waits for the audio thread to leave it, so the callback is not invoked afterwards. */
+MANET_API void manet_custom_node_destroy(manet_custom_node* handle)
+{
+    if (handle == NULL) {
+        return;
+    }
+
+    ma_node_uninit(&handle->base, NULL);
+    manet_free(handle);
+}
+
+static void manet_dynamics_detect_scalar(const float* frames, ma_uint32 frameCount, ma_uint32 channels, float* peak, float* power)
+{
+    float scale = 1.0f / (float)channels;
+    for (ma_uint32 i = 0; i < frameCount; ++i) {
+        const float* frame = frames + (size_t)i * channels;
+        float framePeak = 0;
+        float frameSum = 0;
+        for (ma_uint32 c = 0; c < channels; ++c) {
+            float magnitude = frame[c] < 0 ? -frame[c] : frame[c];
+            framePeak = magnitude > framePeak ? magnitude : framePeak;
+            frameSum += frame[c] * frame[c];
+        }
+
+        peak[i] = framePeak;
+        power[i] = frameSum * scale;
+    }
+}
+
+static void manet_dynamics_limiter_gain_scalar(const float* peak, ma_uint32 frameCount, float ceiling, float* gain)
+{
+    for (ma_uint32 i = 0; i < frameCount; ++i) {
+        gain[i] = ceiling / (peak[i] > ceiling ? peak[i] : ceiling);
+    }
+}
+
+static void manet_dynamics_compressor_gain_scalar(const float* power, ma_uint32 frameCount, float thresholdPower, float exponent, float makeup, float* gain)
+{
+    float scale = 1.0f / thresholdPower;
+    for (ma_uint32 i = 0; i < frameCount; ++i) {
+        float ratio = power[i] * scale;
+        gain[i] = ratio > 1.0f ? makeup * ma_powf(ratio, exponent) : makeup;
+    }
+}
+
+static void manet_dynamics_apply_scalar(const float* framesIn, float* framesOut, ma_uint32 frameCount, ma_uint32 channels, const float* gain)
+{
+    for (ma_uint32 i = 0; i < frameCount; ++i) {
+        for (ma_uint32 c = 0; c < channels; ++c) {
+            framesOut[(size_t)i * channels + c] = framesIn[(size_t)i * channels + c] * gain[i];
+        }
+    }
+}
+
+static const manet_dynamics_kernels manet_dynamics_kernels_scalar = {
+    MANET_DYNAMICS_KERNEL_SCALAR,
+    manet_dynamics_detect_scalar,
+    manet_dynamics_limiter_gain_scalar,
+    manet_dynamics_compressor_gain_scalar,
+    manet_dynamics_apply_scalar
+};
+
+/* The vector gain curve evaluates ratio^exponent as exp2(exponent * log2(ratio)). log2 uses the atanh series on the
+   mantissa and exp2 a degree-6 polynomial around the nearest integer; both are accurate to well below 1e-5. */
+#define MANET_LOG2_SERIES_SCALE 2.8853900817779268f
+#define MANET_EXP2_C1 0.6931471805599453f
+#define MANET_EXP2_C2 0.2402265069591007f
+#define MANET_EXP2_C3 0.0555041086648216f
+#define MANET_EXP2_C4 0.0096181291076285f
+#define MANET_EXP2_C5 0.0013333558146428f
+#define MANET_EXP2_C6 0.0001540353039338f
+
+#if defined(MANET_SIMD_SSE2)
+static MA_INLINE __m128 manet_log2_sse2(__m128 x)
+{
+    __m128i bits = _mm_castps_si128(x);
+    __m128 exponent = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127)));
+    __m128 mantissa = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F800000)));
+    __m128 one = _mm_set1_ps(1.0f);
+    __m128 y = _mm_div_ps(_mm_sub_ps(mantissa, one), _mm_add_ps(mantissa, one));
+    __m128 y2 = _mm_mul_ps(y, y);
+    __m128 series = _mm_add_ps(_mm_set1_ps(1.0f / 7.0f), _mm_mul_ps(y2, _mm_set1_ps(1.0f / 9.0f)));
+    series = _mm_add_ps(_mm_set1_ps(1.0f / 5.0f), _mm_mul_ps(y2, series));
+    series = _mm_add_ps(_mm_set1_ps(1.0f / 3.0f), _mm_mul_ps(y2, series));
+    series = _mm_add_ps(one, _mm_mul_ps(y2, series));
+    return _mm_add_ps(exponent, _mm_mul_ps(_mm_mul_ps(y, series), _mm_set1_ps(MANET_LOG2_SERIES_SCALE)));
+}
+
+static MA_INLINE __m128 manet_exp2_sse2(__m128 x)
+{
+    x = _mm_max_ps(x, _mm_set1_ps(-126.0f));
+    __m128i whole = _mm_cvtps_epi32(x);
+    __m128 f = _mm_sub_ps(x, _mm_cvtepi32_ps(whole));
+    __m128 p = _mm_add_ps(_mm_set1_ps(MANET_EXP2_C5), _mm_mul_ps(f, _mm_set1_ps(MANET_EXP2_C6)));
+    p = _mm_add_ps(_mm_set1_ps(MANET_EXP2_C4), _mm_mul_ps(f, p));
+    p = _mm_add_ps(_mm_set1_ps(MANET_EXP2_C3), _mm_mul_ps(f, p));
+    p = _mm_add_ps(_mm_set1_ps(MANET_EXP2_C2), _mm_mul_ps(f, p));
+    p = _mm_add_ps(_mm_set1_ps(MANET_EXP2_C1), _mm_mul_ps(f, p));
+    p = _mm_add_ps(_mm_set1_ps(1.0f), _mm_mul_ps(f, p));
+    return _mm_castsi128_ps(_mm_add_epi32(_mm_castps_si128(p), _mm_slli_epi32(whole, 23)));
+}
+
+static void manet_dynamics_detect_sse2(const float* frames, ma_uint32 frameCount, ma_uint32 channels, float* peak, float* power)
+{
+    __m128 signMask = _mm_set1_ps(-0.0f);
+    ma_uint32 i = 0;
+
+    if (channels == 1) {
+        for (; i + 4 <= frameCount; i += 4) {
+            __m128 x = _mm_loadu_ps(frames + i);
+            _mm_storeu_ps(peak + i, _mm_andnot_ps(signMask, x));
+            _mm_storeu_ps(power + i, _mm_mul_ps(x, x));
+        }
+    } else if (channels == 2) {
+        __m128 half = _mm_set1_ps(0.5f);
+        for (; i + 4 <= frameCount; i += 4) {
+            __m128 a = _mm_loadu_ps(frames + (size_t)i * 2);
+            __m128 b = _mm_loadu_ps(frames + (size_t)i * 2 + 4);
+            __m128 left = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+            __m128 right = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+            _mm_storeu_ps(peak + i, _mm_max_ps(_mm_andnot_ps(signMask, left), _mm_andnot_ps(signMask, right)));
+            _mm_storeu_ps(power + i, _mm_mul_ps(_mm_add_ps(_mm_mul_ps(left, left), _mm_mul_ps(right, right)), half));
+        }
+    }
+
+    manet_dynamics_detect_scalar(frames + (size_t)i * channels, frameCount - i, channels, peak + i, power + i);
+}
+
+static void manet_dynamics_limiter_gain_sse2(const float* peak, ma_uint32 frameCount, float ceiling, float* gain)
+{
+    __m128 ceilingVector = _mm_set1_ps(ceiling);
+    ma_uint32 i = 0;
+    for (; i + 4 <= frameCount; i += 4) {
+        _mm_storeu_ps(gain + i, _mm_div_ps(ceilingVector, _mm_max_ps(_mm_loadu_ps(peak + i), ceilingVector)));
+    }
+
+    manet_dynamics_limiter_gain_scalar(peak + i, frameCount - i, ceiling, gain + i);
+}
+
+static void manet_dynamics_compressor_gain_sse2(const float* power, ma_uint32 frameCount, float thresholdPower, float exponent, float makeup, float* gain)
+{
+    __m128 scale = _mm_set1_ps(1.0f / thresholdPower);
+    __m128 exponentVector = _mm_set1_ps(exponent);
+    __m128 makeupVector = _mm_set1_ps(makeup);
+    __m128 one = _mm_set1_ps(1.0f);
+    ma_uint32 i = 0;
+    for (; i + 4 <= frameCount; i += 4) {
+        __m128 ratio = _mm_max_ps(_mm_mul_ps(_mm_loadu_ps(power + i), scale), one);
+        __m128 curve = manet_exp2_sse2(_mm_mul_ps(exponentVector, manet_log2_sse2(ratio)));
+        _mm_storeu_ps(gain + i, _mm_mul_ps(curve, makeupVector));
+    }
+
+    manet_dynamics_compressor_gain_scalar(power + i, frameCount - i, thresholdPower, exponent, makeup, gain + i);
+}
+
+static void manet_dynamics_apply_sse2(const float* framesIn, float* framesOut, ma_uint32 frameCount, ma_uint32 channels, const float* gain)
+{
+    ma_uint32 i = 0;
+
+    if (channels == 1) {
+        for (; i + 4 <= frameCount; i += 4) {
+            _mm_storeu_ps(framesOut + i, _mm_mul_ps(_mm_loadu_ps(framesIn + i), _mm_loadu_ps(gain + i)));
+        }
+    } else if (channels == 2) {
+        for (; i + 4 <= frameCount; i += 4) {
+            __m128 g = _mm_loadu_ps(gain + i);
+            const float* in = framesIn + (size_t)i * 2;
+            float* out = framesOut + (size_t)i * 2;
+            _mm_storeu_ps(out, _mm_mul_ps(_mm_loadu_ps(in), _mm_unpacklo_ps(g, g)));
+            _mm_storeu_ps(out + 4, _mm_mul_ps(_mm_loadu_ps(in + 4), _mm_unpackhi_ps(g, g)));
+        }
+    }
+
+    manet_dynamics_apply_scalar(framesIn + (size_t)i * channels, framesOut + (size_t)i * channels, frameCount - i, channels, gain + i);
+}
+
+static const manet_dynamics_kernels manet_dynamics_kernels_sse2 = {
+    MANET_DYNAMICS_KERNEL_SSE2,
+    manet_dynamics_detect_sse2,
+    manet_dynamics_limiter_gain_sse2,
+    manet_dynamics_compressor_gain_sse2,
+    manet_dynamics_apply_sse2
+};
+#endif
+
+#if defined(MANET_SIMD_AVX2)
+MANET_TARGET_AVX2 static MA_INLINE __m256 manet_log2_avx2(__m256 x)
+{
+    __m256i bits = _mm256_castps_si256(x);
+    __m256 exponent = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(127)));
+    __m256 mantissa = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x007FFFFF)), _mm256_set1_epi32(0x3F800000)));
+    __m256 one = _mm256_set1_ps(1.0f);
+    __m256 y = _mm256_div_ps(_mm256_sub_ps(mantissa, one), _mm256_add_ps(mantissa, one));
+    __m256 y2 = _mm256_mul_ps(y, y);
+    __m256 series = _mm256_add_ps(_mm256_set1_ps(1.0f / 7.0f), _mm256_mul_ps(y2, _mm256_set1_ps(1.0f / 9.0f)));
+    series = _mm256_add_ps(_mm256_set1_ps(1.0f / 5.0f), _mm256_mul_ps(y2, series));
+    series = _mm256_add_ps(_mm256_set1_ps(1.0f / 3.0f), _mm256_mul_ps(y2, series));
+    series = _mm256_add_ps(one, _mm256_mul_ps(y2, series));
+    return _mm256_add_ps(exponent, _mm256_mul_ps(_mm256_mul_ps(y, series), _mm256_set1_ps(MANET_LOG2_SERIES_SCALE)));
+}
+
+MANET_TARGET_AVX2 static MA_INLINE __m256 manet_exp2_avx2(__m256 x)
+{
+    x = _mm256_max_ps(x, _mm256_set1_ps(-126.0f));
+    __m256i whole = _mm256_cvtps_epi32(x);
+    __m256 f = _mm256_sub_ps(x, _mm256_cvtepi32_ps(whole));
+    __m256 p = _mm256_add_ps(_mm256_set1_ps(MANET_EXP2_C5), _mm256_mul_ps(f, _mm256_set1_ps(MANET_EXP2_C6)));
+    p = _mm256_add_ps(_mm256_set1_ps(MANET_EXP2_C4), _mm256_mul_ps(f, p));
+    p = _mm256_add_ps(_mm256_set1_ps(MANET_EXP2_C3), _mm256_mul_ps(f, p));
+    p = _mm256_add_ps(_mm256_set1_ps(MANET_EXP2_C2), _mm256_mul_ps(f, p));
+    p = _mm256_add_ps(_mm256_set1_ps(MANET_EXP2_C1), _mm256_mul_ps(f, p));
+    p = _mm256_add_ps(_mm256_set1_ps(1.0f), _mm256_mul_ps(f, p));
+    return _mm256_castsi256_ps(_mm256_add_epi32(_mm256_castps_si256(p), _mm256_slli_epi32(whole, 23)));
+}
+
+/* 256-bit shuffles work per 128-bit lane, so deinterleaved stereo comes out as frames 0 1 4 5 2 3 6 7 and is put
+   back in order by swapping the middle 64-bit pairs. */
+MANET_TARGET_AVX2 static MA_INLINE __m256 manet_fix_lane_order_avx2(__m256 v)
+{
+    return _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(v), _MM_SHUFFLE(3, 1, 2, 0)));
+}
+
+MANET_TARGET_AVX2 static void manet_dynamics_detect_avx2(const float* frames, ma_uint32 frameCount, ma_uint32 channels, float* peak, float* power)
+{
+    __m256 signMask = _mm256_set1_ps(-0.0f);
+    ma_uint32 i = 0;
+
+    if (channels == 1) {
+        for (; i + 8 <= frameCount; i += 8) {
+            __m256 x = _mm256_loadu_ps(frames + i);
+            _mm256_storeu_ps(peak + i, _mm256_andnot_ps(signMask, x));
+            _mm256_storeu_ps(power + i, _mm256_mul_ps(x, x));
+        }
+    } else if (channels == 2) {
+        __m256 half = _mm256_set1_ps(0.5f);
+        for (; i + 8 <= frameCount; i += 8) {
+            __m256 a = _mm256_loadu_ps(frames + (size_t)i * 2);
+            __m256 b = _mm256_loadu_ps(frames + (size_t)i * 2 + 8);
+            __m256 left = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+            __m256 right = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+            __m256 framePeak = _mm256_max_ps(_mm256_andnot_ps(signMask, left), _mm256_andnot_ps(signMask, right));
+            __m256 framePower = _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(left, left), _mm256_mul_ps(right, right)), half);
+            _mm256_storeu_ps(peak + i, manet_fix_lane_order_avx2(framePeak));
+            _mm256_storeu_ps(power + i, manet_fix_lane_order_avx2(framePower));
+        }
+    }
+
+    manet_dynamics_detect_scalar(frames + (size_t)i * channels, frameCount - i, channels, peak + i, power + i);
+}
+
+MANET_TARGET_AVX2 static void manet_dynamics_limiter_gain_avx2(const float* peak, ma_uint32 frameCount, float ceiling, float* gain)
+{
+    __m256 ceilingVector = _mm256_set1_ps(ceiling);
+    ma_uint32 i = 0;
+    for (; i + 8 <= frameCount; i += 8) {
+        _mm256_storeu_ps(gain + i, _mm256_div_ps(ceilingVector, _mm256_max_ps(_mm256_loadu_ps(peak + i), ceilingVector)));
+    }
+
+    manet_dynamics_limiter_gain_scalar(peak + i, frameCount - i, ceiling, gain + i);
+}
+
+MANET_TARGET_AVX2 static void manet_dynamics_compressor_gain_avx2(const float* power, ma_uint32 frameCount, float thresholdPower, float exponent, float makeup, float* gain)
+{
+    __m256 scale = _mm256_set1_ps(1.0f / thresholdPower);
+    __m256 exponentVector = _mm256_set1_ps(exponent);
+    __m256 makeupVector = _mm256_set1_ps(makeup);
+    __m256 one = _mm256_set1_ps(1.0f);
+    ma_uint32 i = 0;
+    for (; i + 8 <= frameCount; i += 8) {
+        __m256 ratio = _mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(power + i), scale), one);
+        __m256 curve = manet_exp2_avx2(_mm256_mul_ps(exponentVector, manet_log2_avx2(ratio)));
+        _mm256_storeu_ps(gain + i, _mm256_mul_ps(curve, makeupVector));
+    }
+
+    manet_dynamics_compressor_gain_scalar(power + i, frameCount - i, thresholdPower, exponent, makeup, gain + i);
+}
+
+MANET_TARGET_AVX2 static void manet_dynamics_apply_avx2(const float* framesIn, float* framesOut, ma_uint32 frameCount, ma_uint32 channels, const float* gain)
+{
+    ma_uint32 i = 0;
+
+    if (channels == 1) {
+        for (; i + 8 <= frameCount; i += 8) {
+            _mm256_storeu_ps(framesOut + i, _mm256_mul_ps(_mm256_loadu_ps(framesIn + i), _mm256_loadu_ps(gain + i)));
+        }
+    } else if (channels == 2) {
+        for (; i + 8 <= frameCount; i += 8) {
+            __m256 g = _mm256_loadu_ps(gain + i);
+            __m256 low = _mm256_unpacklo_ps(g, g);
+            __m256 high = _mm256_unpackhi_ps(g, g);
+            const float* in = framesIn + (size_t)i * 2;
+            float* out = framesOut + (size_t)i * 2;
+            _mm256_storeu_ps(out, _mm256_mul_ps(_mm256_loadu_ps(in), _mm256_permute2f128_ps(low, high, 0x20)));
+            _mm256_storeu_ps(out + 8, _mm256_mul_ps(_mm256_loadu_ps(in + 8), _mm256_permute2f128_ps(low, high, 0x31)));
+        }
+    }
+
+    manet_dynamics_apply_scalar(framesIn + (size_t)i * channels, framesOut + (size_t)i * channels, frameCount - i, channels, gain + i);
+}
+
+static const manet_dynamics_kernels manet_dynamics_kernels_avx2 = {
+    MANET_DYNAMICS_KERNEL_AVX2,
+    manet_dynamics_detect_avx2,
+    manet_dynamics_limiter_gain_avx2,
+    manet_dynamics_compressor_gain_avx2,
+    manet_dynamics_apply_avx2
+};
+
+static ma_bool32 manet_cpu_has_avx2(void)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_cpu_supports("avx2") ? MA_TRUE : MA_FALSE;
+#else
+    return ma_has_avx2();
+#endif
+}
+#endif
+
+#if defined(MANET_SIMD_NEON)
+static MA_INLINE float32x4_t manet_log2_neon(float32x4_t x)
+{
+    uint32x4_t bits = vreinterpretq_u32_f32(x);
+    int32x4_t biased = vreinterpretq_s32_u32(vshrq_n_u32(bits, 23));
+    float32x4_t exponent = vcvtq_f32_s32(vsubq_s32(biased, vdupq_n_s32(127)));
+    float32x4_t mantissa = vreinterpretq_f32_u32(vorrq_u32(vandq_u32(bits, vdupq_n_u32(0x007FFFFF)), vdupq_n_u32(0x3F800000)));
+    float32x4_t one = vdupq_n_f32(1.0f);
+    float32x4_t y = vdivq_f32(vsubq_f32(mantissa, one), vaddq_f32(mantissa, one));
+    float32x4_t y2 = vmulq_f32(y, y);
+    float32x4_t series = vaddq_f32(vdupq_n_f32(1.0f / 7.0f), vmulq_f32(y2, vdupq_n_f32(1.0f / 9.0f)));
+    series = vaddq_f32(vdupq_n_f32(1.0f / 5.0f), vmulq_f32(y2, series));
+    series = vaddq_f32(vdupq_n_f32(1.0f / 3.0f), vmulq_f32(y2, series));
+    series = vaddq_f32(one, vmulq_f32(y2, series));
+    return vaddq_f32(exponent, vmulq_f32(vmulq_f32(y, series), vdupq_n_f32(MANET_LOG2_SERIES_SCALE)));
+}
+
+static MA_INLINE float32x4_t manet_exp2_neon(float32x4_t x)
+{
+    x = vmaxq_f32(x, vdupq_n_f32(-126.0f));
+    int32x4_t whole = vcvtnq_s32_f32(x);
+    float32x4_t f = vsubq_f32(x, vcvtq_f32_s32(whole));
+    float32x4_t p = vaddq_f32(vdupq_n_f32(MANET_EXP2_C5), vmulq_f32(f, vdupq_n_f32(MANET_EXP2_C6)));
+    p = vaddq_f32(vdupq_n_f32(MANET_EXP2_C4), vmulq_f32(f, p));
+    p = vaddq_f32(vdupq_n_f32(MANET_EXP2_C3), vmulq_f32(f, p));
+    p = vaddq_f32(vdupq_n_f32(MANET_EXP2_C2), vmulq_f32(f, p));
+    p = vaddq_f32(vdupq_n_f32(MANET_EXP2_C1), vmulq_f32(f, p));
+    p = vaddq_f32(vdupq_n_f32(1.0f), vmulq_f32(f, p));
+    return vreinterpretq_f32_s32(vaddq_s32(vreinterpretq_s32_f32(p), vshlq_n_s32(whole, 23)));
+}
+
+static void manet_dynamics_detect_neon(const float* frames, ma_uint32 frameCount, ma_uint32 channels, float* peak, float* power)
+{
+    ma_uint32 i = 0;
+
+    if (channels == 1) {
+        for (; i + 4 <= frameCount; i += 4) {
+            float32x4_t x = vld1q_f32(frames + i);
+            vst1q_f32(peak + i, vabsq_f32(x));
+            vst1q_f32(power + i, vmulq_f32(x, x));
+        }
+    } else if (channels == 2) {
+        float32x4_t half = vdupq_n_f32(0.5f);
+        for (; i + 4 <= frameCount; i += 4) {
+            float32x4x2_t stereo = vld2q_f32(frames + (size_t)i * 2);
+            float32x4_t sum = vaddq_f32(vmulq_f32(stereo.val[0], stereo.val[0]), vmulq_f32(stereo.val[1], stereo.val[1]));
+            vst1q_f32(peak + i, vmaxq_f32(vabsq_f32(stereo.val[0]), vabsq_f32(stereo.val[1])));
+            vst1q_f32(power + i, vmulq_f32(sum, half));
+        }
+    }
+
+    manet_dynamics_detect_scalar(frames + (size_t)i * channels, frameCount - i, channels, peak + i, power + i);
+}
+
+static void manet_dynamics_limiter_gain_neon(const float* peak, ma_uint32 frameCount, float ceiling, float* gain)
+{
+    float32x4_t ceilingVector = vdupq_n_f32(ceiling);
+    ma_uint32 i = 0;
+    for (; i + 4 <= frameCount; i += 4) {
+        vst1q_f32(gain + i, vdivq_f32(ceilingVector, vmaxq_f32(vld1q_f32(peak + i), ceilingVector)));
+    }
+
+    manet_dynamics_limiter_gain_scalar(peak + i, frameCount - i, ceiling, gain + i);
+}
+
+static void manet_dynamics_compressor_gain_neon(const float* power, ma_uint32 frameCount, float thresholdPower, float exponent, float makeup, float* gain)
+{
+    float32x4_t scale = vdupq_n_f32(1.0f / thresholdPower);
+    float32x4_t exponentVector = vdupq_n_f32(exponent);
+    float32x4_t makeupVector = vdupq_n_f32(makeup);
+    float32x4_t one = vdupq_n_f32(1.0f);
+    ma_uint32 i = 0;
+    for (; i + 4 <= frameCount; i += 4) {
+        float32x4_t ratio = vmaxq_f32(vmulq_f32(vld1q_f32(power + i), scale), one);
+        float32x4_t curve = manet_exp2_neon(vmulq_f32(exponentVector, manet_log2_neon(ratio)));
+        vst1q_f32(gain + i, vmulq_f32(curve, makeupVector));
+    }
+
+    manet_dynamics_compressor_gain_scalar(power + i, frameCount - i, thresholdPower, exponent, makeup, gain + i);
+}
+
+static void manet_dynamics_apply_neon(const float* framesIn, float* framesOut, ma_uint32 frameCount, ma_uint32 channels, const float* gain)
+{
+    ma_uint32 i = 0;
+
+    if (channels == 1) {
+        for (; i + 4 <= frameCount; i += 4) {
+            vst1q_f32(framesOut + i, vmulq_f32(vld1q_f32(framesIn + i), vld1q_f32(gain + i)));
+        }
+    } else if (channels == 2) {
+        for (; i + 4 <= frameCount; i += 4) {
+            float32x4_t g = vld1q_f32(gain + i);
+            float32x4x2_t stereo = vld2q_f32(framesIn + (size_t)i * 2);
+            stereo.val[0] = vmulq_f32(stereo.val[0], g);
+            stereo.val[1] = vmulq_f32(stereo.val[1], g);
+            vst2q_f32(framesOut + (size_t)i * 2, stereo);
+        }
+    }
+
+    manet_dynamics_apply_scalar(framesIn + (size_t)i * channels, framesOut + (size_t)i * channels, frameCount - i, channels, gain + i);
+}
+
+static const manet_dynamics_kernels manet_dynamics_kernels_neon = {
+    MANET_DYNAMICS_KERNEL_NEON,
+    manet_dynamics_detect_neon,
+    manet_dynamics_limiter_gain_neon,
+    manet_dynamics_compressor_gain_neon,
+    manet_dynamics_apply_neon
+};
+#endif
+
+/* Returns NULL when the requested kernel is not compiled in or not supported by this CPU. */
+static const manet_dynamics_kernels* manet_dynamics_find_kernels(manet_dynamics_kernel_type type)
+{
+    switch (type) {
+        case MANET_DYNAMICS_KERNEL_AUTO:
+#if defined(MANET_SIMD_AVX2)
+            if (manet_cpu_has_avx2()) {
+                return &manet_dynamics_kernels_avx2;
+            }
+#endif
+#if defined(MANET_SIMD_SSE2)
+            return &manet_dynamics_kernels_sse2;
+#elif defined(MANET_SIMD_NEON)
+            return &manet_dynamics_kernels_neon;
+#else
+            return &manet_dynamics_kernels_scalar;
+#endif
+        case MANET_DYNAMICS_KERNEL_SCALAR:
+            return &manet_dynamics_kernels_scalar;
+#if defined(MANET_SIMD_SSE2)
+        case MANET_DYNAMICS_KERNEL_SSE2:
+            return &manet_dynamics_kernels_sse2;
+#endif
+#if defined(MANET_SIMD_AVX2)
+        case MANET_DYNAMICS_KERNEL_AVX2:
+            return manet_cpu_has_avx2() ? &manet_dynamics_kernels_avx2 : NULL;
+#endif
+#if defined(MANET_SIMD_NEON)
+        case MANET_DYNAMICS_KERNEL_NEON:
+            return &manet_dynamics_kernels_neon;
+#endif
+        default:
+            return NULL;
+    }
+}
+
+MANET_API ma_bool32 manet_dynamics_is_kernel_supported(ma_uint32 kernel)
+{
+    return kernel != MANET_DYNAMICS_KERNEL_AUTO && manet_dynamics_find_kernels((manet_dynamics_kernel_type)kernel) != NULL;
+}
+
+static float manet_dynamics_time_coeff(float milliseconds, ma_uint32 sampleRate)
+{
+    if (milliseconds <= 0) {
+        return 0;
+    }
+
+    return (float)ma_expd(-1000.0 / ((double)milliseconds * sampleRate));
 }
 
-#if defined(_WIN32)
-MANET_API manet_sound* manet_sound_create_from_file_w(manet_engine* engineHandle, const wchar_t* path, ma_uint32 flags)
+static void manet_dynamics_note_gain(manet_dynamics_node* handle, const float* gain, ma_uint32 frameCount, float scale)
 {
-    if (manet_validate_engine(engineHandle) != MA_SUCCESS || path == NULL) {
-        return NULL;
+    float lowest = 1.0f;
+    for (ma_uint32 i = 0; i < frameCount; ++i) {
+        lowest = gain[i] < lowest ? gain[i] : lowest;
     }
 
-    manet_sound* soundHandle = (manet_sound*)manet_alloc(sizeof(*soundHandle));
-    if (soundHandle == NULL) {
-        return NULL;
+    /* CAS so a concurrent reset to 1 by manet_dynamics_node_read_min_gain is never overwritten with a stale minimum. */
+    lowest *= scale;
+    float current = ma_atomic_float_get(&handle->minGain);
+    while (lowest < current && !ma_atomic_compare_exchange_weak_f32(&handle->minGain.value, &current, lowest)) {
     }
+}
 
-    memset(soundHandle, 0, sizeof(*soundHandle));
-
-    ma_result result = ma_sound_init_from_file_w(&engineHandle->engine, path, flags, NULL, NULL, &soundHandle->sound);
-    if (result != MA_SUCCESS) {
-        manet_free(soundHandle);
-        return NULL;
+/* The lookahead ring is read and then overwritten from delayCursor onwards, wrapping at its end. */
+static void manet_dynamics_ring_read(const manet_dynamics_node* handle, float* frames, ma_uint32 frameCount)
+{
+    size_t frameSize = (size_t)handle->channels * sizeof(float);
+    ma_uint32 first = handle->lookahead - handle->delayCursor;
+    if (first > frameCount) {
+        first = frameCount;
     }
 
-    soundHandle->state = MANET_SOUND_STATE_STOPPED;
-    return soundHandle;
+    memcpy(frames, handle->delay + (size_t)handle->delayCursor * handle->channels, first * frameSize);
+    memcpy(frames + (size_t)first * handle->channels, handle->delay, (frameCount - first) * frameSize);
 }
-#endif
 
-static void manet_copy_string(char* dst, size_t dstSize, const char* src)
+static void manet_dynamics_ring_write(manet_dynamics_node* handle, const float* frames, ma_uint32 frameCount)
 {
-    if (dst == NULL || dstSize == 0) {
-        return;
-    }
-
-    if (src == NULL) {
-        dst[0] = '\0';
-        return;
+    size_t frameSize = (size_t)handle->channels * sizeof(float);
+    ma_uint32 first = handle->lookahead - handle->delayCursor;
+    if (first > frameCount) {
+        first = frameCount;
     }
 
-    strncpy(dst, src, dstSize - 1);
-    dst[dstSize - 1] = '\0';
+    memcpy(handle->delay + (size_t)handle->delayCursor * handle->channels, frames, first * frameSize);
+    memcpy(handle->delay, frames + (size_t)first * handle->channels, (frameCount - first) * frameSize);
 }
 
-static void manet_device_id_to_hex(const ma_device_id* id, char* buffer, size_t bufferSize)
+static void manet_dynamics_limit_chunk(manet_dynamics_node* handle, const float* framesIn, float* framesOut, ma_uint32 frameCount, float* peak, float* power, float* gain)
 {
-    static const char HEX_DIGITS[] = "0123456789abcdef";
+    ma_uint32 channels = handle->channels;
+    ma_uint32 lookahead = handle->lookahead;
+    ma_uint32 window = lookahead + 1;
+    float release = ma_atomic_float_get(&handle->releaseCoeff);
+
+    handle->kernels->detect(framesIn, frameCount, channels, peak, power);
+    handle->kernels->limiter_gain(peak, frameCount, ma_atomic_float_get(&handle->threshold), gain);
+
+    for (ma_uint32 i = 0; i < frameCount; ++i) {
+        float released = release * handle->envelope + (1.0f - release);
+        float target = gain[i] < released ? gain[i] : released;
+        handle->envelope = target;
+
+        /* Running minimum over the window as a monotonic deque of (value, frame index). */
+        while (handle->windowCount > 0 && handle->windowIndices[handle->windowHead] + window <= handle->frameIndex) {
+            handle->windowHead = (handle->windowHead + 1) % window;
+            handle->windowCount -= 1;
+        }
 
-    if (buffer == NULL || bufferSize == 0) {
-        return;
-    }
+        while (handle->windowCount > 0 && handle->windowValues[(handle->windowHead + handle->windowCount - 1) % window] >= target) {
+            handle->windowCount -= 1;
+        }
 
-    if (id == NULL || bufferSize < MANET_DEVICE_ID_HEX_BUFFER_SIZE) {
-        buffer[0] = '\0';
-        return;
+        ma_uint32 tail = (handle->windowHead + handle->windowCount) % window;
+        handle->windowValues[tail] = target;
+        handle->windowIndices[tail] = handle->frameIndex;
+        handle->windowCount += 1;
+
+        float minimum = handle->windowValues[handle->windowHead];
+        handle->averageSum += (double)minimum - handle->averageValues[handle->averageCursor];
+        handle->averageValues[handle->averageCursor] = minimum;
+        handle->averageCursor = (handle->averageCursor + 1) % window;
+
+        gain[i] = (float)(handle->averageSum / window);
+        handle->frameIndex += 1;
+    }
+
+    if (lookahead == 0) {
+        handle->kernels->apply(framesIn, framesOut, frameCount, channels, gain);
+    } else if (frameCount >= lookahead) {
+        size_t lookaheadSamples = (size_t)lookahead * channels;
+        manet_dynamics_ring_read(handle, framesOut, lookahead);
+        memcpy(framesOut + lookaheadSamples, framesIn, (size_t)(frameCount - lookahead) * channels * sizeof(float));
+        memcpy(handle->delay, framesIn + (size_t)(frameCount - lookahead) * channels, lookaheadSamples * sizeof(float));
+        handle->delayCursor = 0;
+        handle->kernels->apply(framesOut, framesOut, frameCount, channels, gain);
+    } else {
+        manet_dynamics_ring_read(handle, framesOut, frameCount);
+        manet_dynamics_ring_write(handle, framesIn, frameCount);
+        handle->delayCursor = (handle->delayCursor + frameCount) % lookahead;
+        handle->kernels->apply(framesOut, framesOut, frameCount, channels, gain);
     }
 
-    const ma_uint8* bytes = (const ma_uint8*)id;
-    for (size_t i = 0; i < sizeof(*id); ++i) {
-        buffer[i * 2] = HEX_DIGITS[(bytes[i] >> 4) & 0x0F];
-        buffer[i * 2 + 1] = HEX_DIGITS[bytes[i] & 0x0F];
+    manet_dynamics_note_gain(handle, gain, frameCount, 1.0f);
+}
+
+static void manet_dynamics_compress_chunk(manet_dynamics_node* handle, const float* framesIn, float* framesOut, ma_uint32 frameCount, float* peak, float* power, float* gain)
+{
+    float attack = ma_atomic_float_get(&handle->attackCoeff);
+    float release = ma_atomic_float_get(&handle->releaseCoeff);
+    float makeup = ma_atomic_float_get(&handle->makeup);
+
+    handle->kernels->detect(framesIn, frameCount, handle->channels, peak, power);
+
+    for (ma_uint32 i = 0; i < frameCount; ++i) {
+        float coeff = power[i] > handle->envelope ? attack : release;
+        handle->envelope = power[i] + coeff * (handle->envelope - power[i]);
+        power[i] = handle->envelope;
     }
 
-    buffer[MANET_DEVICE_ID_HEX_LENGTH] = '\0';
+    handle->kernels->compressor_gain(power, frameCount, ma_atomic_float_get(&handle->threshold), ma_atomic_float_get(&handle->exponent), makeup, gain);
+    handle->kernels->apply(framesIn, framesOut, frameCount, handle->channels, gain);
+    manet_dynamics_note_gain(handle, gain, frameCount, 1.0f / makeup);
 }
 
-static int manet_hex_value(char digit)
+static void manet_dynamics_node_process(ma_node* node, const float** framesIn, ma_uint32* frameCountIn, float** framesOut, ma_uint32* frameCountOut)
 {
-    if (digit >= '0' && digit <= '9') {
-        return digit - '0';
-    }
+    manet_dynamics_node* handle = (manet_dynamics_node*)node;
+    float peak[MANET_DYNAMICS_CHUNK_FRAMES];
+    float power[MANET_DYNAMICS_CHUNK_FRAMES];
+    float gain[MANET_DYNAMICS_CHUNK_FRAMES];
+    ma_uint32 frameCount = *frameCountIn < *frameCountOut ? *frameCountIn : *frameCountOut;
+
+    for (ma_uint32 done = 0; done < frameCount;) {
+        ma_uint32 chunk = frameCount - done;
+        if (chunk > MANET_DYNAMICS_CHUNK_FRAMES) {
+            chunk = MANET_DYNAMICS_CHUNK_FRAMES;
+        }
 
-    if (digit >= 'a' && digit <= 'f') {
-        return 10 + (digit - 'a');
-    }
+        const float* in = framesIn[0] + (size_t)done * handle->channels;
+        float* out = framesOut[0] + (size_t)done * handle->channels;
+        if (handle->mode == MANET_DYNAMICS_LIMITER) {
+            manet_dynamics_limit_chunk(handle, in, out, chunk, peak, power, gain);
+        } else {
+            manet_dynamics_compress_chunk(handle, in, out, chunk, peak, power, gain);
+        }
 
-    if (digit >= 'A' && digit <= 'F') {
-        return 10 + (digit - 'A');
+        done += chunk;
     }
 
-    return -1;
+    *frameCountIn = frameCount;
+    *frameCountOut = frameCount;
 }
 
-static ma_bool32 manet_device_id_from_hex(const char* hex, ma_device_id* id)
+/* Continuous processing keeps the envelopes releasing and flushes the lookahead delay while nothing is playing. */
+static ma_node_vtable manet_dynamics_node_vtable = {
+    manet_dynamics_node_process,
+    NULL,
+    1,
+    1,
+    MA_NODE_FLAG_CONTINUOUS_PROCESSING
+};
+
+static manet_dynamics_node* manet_dynamics_node_init(manet_engine* engineHandle, manet_dynamics_mode mode, ma_uint32 channels, ma_uint32 lookahead, ma_uint32 kernel)
 {
-    if (hex == NULL || id == NULL) {
-        return MA_FALSE;
+    if (manet_validate_engine(engineHandle) != MA_SUCCESS || channels == 0 || channels > MA_MAX_CHANNELS) {
+        return NULL;
     }
 
-    size_t length = strlen(hex);
-    if (length != MANET_DEVICE_ID_HEX_LENGTH) {
-        return MA_FALSE;
+    const manet_dynamics_kernels* kernels = manet_dynamics_find_kernels((manet_dynamics_kernel_type)kernel);
+    if (kernels == NULL) {
+        return NULL;
     }
 
-    ma_uint8* bytes = (ma_uint8*)id;
-    for (size_t i = 0; i < sizeof(*id); ++i) {
-        int high = manet_hex_value(hex[i * 2]);
-        int low = manet_hex_value(hex[i * 2 + 1]);
-        if (high < 0 || low < 0) {
-            return MA_FALSE;
+    manet_dynamics_node* handle = (manet_dynamics_node*)manet_alloc(sizeof(*handle));
+    if (handle == NULL) {
+        return NULL;
+    }
+
+    memset(handle, 0, sizeof(*handle));
+    handle->mode = mode;
+    handle->kernels = kernels;
+    handle->channels = channels;
+    handle->sampleRate = ma_engine_get_sample_rate(&engineHandle->engine);
+    handle->lookahead = lookahead;
+    handle->envelope = mode == MANET_DYNAMICS_LIMITER ? 1.0f : 0.0f;
+    ma_atomic_float_set(&handle->makeup, 1.0f);
+    ma_atomic_float_set(&handle->minGain, 1.0f);
+
+    if (mode == MANET_DYNAMICS_LIMITER) {
+        ma_uint32 window = lookahead + 1;
+        handle->windowValues = (float*)manet_alloc(sizeof(float) * window);
+        handle->windowIndices = (ma_uint64*)manet_alloc(sizeof(ma_uint64) * window);
+        handle->averageValues = (float*)manet_alloc(sizeof(float) * window);
+        handle->delay = lookahead > 0 ? (float*)manet_alloc(sizeof(float) * lookahead * channels) : NULL;
+        if (handle->windowValues == NULL || handle->windowIndices == NULL || handle->averageValues == NULL || (lookahead > 0 && handle->delay == NULL)) {
+            manet_free(handle->windowValues);
+            manet_free(handle->windowIndices);
+            manet_free(handle->averageValues);
+            manet_free(handle->delay);
+            manet_free(handle);
+            return NULL;
         }
 
-        bytes[i] = (ma_uint8)((high << 4) | low);
+        for (ma_uint32 i = 0; i < window; ++i) {
+            handle->averageValues[i] = 1.0f;
+        }
+
+        handle->averageSum = window;
+        if (handle->delay != NULL) {
+            memset(handle->delay, 0, sizeof(float) * lookahead * channels);
+        }
     }
 
-    return MA_TRUE;
+    return handle;
 }
 
-static void manet_write_device_descriptor(manet_device_descriptor* dst, const ma_device_info* src, ma_device_type type)
+static void manet_dynamics_node_free(manet_dynamics_node* handle)
 {
-    if (dst == NULL || src == NULL) {
-        return;
+    manet_free(handle->windowValues);
+    manet_free(handle->windowIndices);
+    manet_free(handle->averageValues);
+    manet_free(handle->delay);
+    manet_free(handle);
+}
+
+static manet_dynamics_node* manet_dynamics_node_attach(manet_engine* engineHandle, manet_dynamics_node* handle)
+{
+    ma_node_config config = ma_node_config_init();
+    config.vtable = &manet_dynamics_node_vtable;
+    config.pInputChannels = &handle->channels;
+    config.pOutputChannels = &handle->channels;
+
+    if (ma_node_init(ma_engine_get_node_graph(&engineHandle->engine), &config, NULL, &handle->base) != MA_SUCCESS) {
+        manet_dynamics_node_free(handle);
+        return NULL;
     }
 
-    dst->type = type;
-    dst->isDefault = src->isDefault;
-    manet_copy_string(dst->name, sizeof(dst->name), src->name);
-    manet_device_id_to_hex(&src->id, dst->id, sizeof(dst->id));
+    return handle;
 }
 
-static ma_uint32 manet_min_u32(ma_uint32 a, ma_uint32 b)
+static ma_bool32 manet_dynamics_is_finite(float value)
 {
-    return (a < b) ? a : b;
+    return value == value && value - value == 0;
 }
 
-static void manet_apply_resource_manager_settings(
-    ma_resource_manager_config* config,
-    const manet_resource_manager_config_simple* settings)
+static ma_bool32 manet_dynamics_is_in_range(float value, float minValue, float maxValue)
 {
-    if (config == NULL || settings == NULL) {
-        return;
-    }
+    return value >= minValue && value <= maxValue;
+}
 
-    if (settings->flags != 0) {
-        config->flags = settings->flags;
+MANET_API ma_result manet_dynamics_node_set_limiter(manet_dynamics_node* handle, float ceilingDb, float releaseMilliseconds)
+{
+    if (handle == NULL || handle->mode != MANET_DYNAMICS_LIMITER) {
+        return MA_INVALID_OPERATION;
     }
 
-    if (settings->decodedFormat != 0) {
-        config->decodedFormat = (ma_format)settings->decodedFormat;
+    if (!manet_dynamics_is_in_range(ceilingDb, MANET_DYNAMICS_MIN_LEVEL_DB, MANET_DYNAMICS_MAX_LEVEL_DB) ||
+        !manet_dynamics_is_finite(releaseMilliseconds) || releaseMilliseconds < 0) {
+        return MA_INVALID_ARGS;
     }
 
-    if (settings->decodedChannels != 0) {
-        config->decodedChannels = settings->decodedChannels;
-    }
+    ma_atomic_float_set(&handle->threshold, ma_volume_db_to_linear(ceilingDb));
+    ma_atomic_float_set(&handle->releaseCoeff, manet_dynamics_time_coeff(releaseMilliseconds, handle->sampleRate));
+    return MA_SUCCESS;
+}
 
-    if (settings->decodedSampleRate != 0) {
-        config->decodedSampleRate = settings->decodedSampleRate;
+MANET_API ma_result manet_dynamics_node_set_compressor(manet_dynamics_node* handle, float thresholdDb, float ratio, float attackMilliseconds, float releaseMilliseconds, float makeupDb)
+{
+    if (handle == NULL || handle->mode != MANET_DYNAMICS_COMPRESSOR) {
+        return MA_INVALID_OPERATION;
     }
 
-    if (settings->jobThreadCount != 0) {
-        config->jobThreadCount = settings->jobThreadCount;
+    if (!manet_dynamics_is_in_range(thresholdDb, MANET_DYNAMICS_MIN_LEVEL_DB, MANET_DYNAMICS_MAX_LEVEL_DB) ||
+        !manet_dynamics_is_in_range(makeupDb, -MANET_DYNAMICS_MAX_MAKEUP_DB, MANET_DYNAMICS_MAX_MAKEUP_DB) || !(ratio >= 1) ||
+        !manet_dynamics_is_finite(attackMilliseconds) || attackMilliseconds < 0 ||
+        !manet_dynamics_is_finite(releaseMilliseconds) || releaseMilliseconds < 0) {
+        return MA_INVALID_ARGS;
     }
+
+    /* The curve works on mean-square power, so the amplitude exponent (1/ratio - 1) is halved. */
+    float threshold = ma_volume_db_to_linear(thresholdDb);
+    ma_atomic_float_set(&handle->threshold, threshold * threshold);
+    ma_atomic_float_set(&handle->exponent, 0.5f * (1.0f / ratio - 1.0f));
+    ma_atomic_float_set(&handle->makeup, ma_volume_db_to_linear(makeupDb));
+    ma_atomic_float_set(&handle->attackCoeff, manet_dynamics_time_coeff(attackMilliseconds, handle->sampleRate));
+    ma_atomic_float_set(&handle->releaseCoeff, manet_dynamics_time_coeff(releaseMilliseconds, handle->sampleRate));
+    return MA_SUCCESS;
 }
 
-static manet_engine* manet_engine_create_with_config(const ma_engine_config* inputConfig)
+MANET_API manet_dynamics_node* manet_limiter_create(manet_engine* engineHandle, ma_uint32 channels, float ceilingDb, float releaseMilliseconds, ma_uint32 lookaheadFrames, ma_uint32 kernel)
 {
-    ma_engine_config config;
-    if (inputConfig != NULL) {
-        config = *inputConfig;
-    } else {
-        config = ma_engine_config_init();
+    if (engineHandle == NULL || lookaheadFrames > ma_engine_get_sample_rate(&engineHandle->engine)) {
+        return NULL;
     }
 
-    manet_engine* handle = (manet_engine*)manet_alloc(sizeof(*handle));
+    manet_dynamics_node* handle = manet_dynamics_node_init(engineHandle, MANET_DYNAMICS_LIMITER, channels, lookaheadFrames, kernel);
     if (handle == NULL) {
         return NULL;
     }
 
-    ma_result result = ma_engine_init(&config, &handle->engine);
-    if (result != MA_SUCCESS) {
-#if defined(_DEBUG)
-        fprintf(stderr, "[manet] ma_engine_init failed: %d (%s)\n", result, ma_result_description(result));
-#endif
-        manet_free(handle);
+    if (manet_dynamics_node_set_limiter(handle, ceilingDb, releaseMilliseconds) != MA_SUCCESS) {
+        manet_dynamics_node_free(handle);
         return NULL;
     }
 
-    return handle;
+    return manet_dynamics_node_attach(engineHandle, handle);
 }
 
-MANET_API manet_sound* manet_sound_create_from_pcm_frames(manet_engine* engineHandle, const float* frames, ma_uint64 frameCount, ma_uint32 channels, ma_uint32 sampleRate, ma_uint32 flags)
+MANET_API manet_dynamics_node* manet_compressor_create(manet_engine* engineHandle, ma_uint32 channels, float thresholdDb, float ratio, float attackMilliseconds, float releaseMilliseconds, float makeupDb, ma_uint32 kernel)
 {
-    if (manet_validate_engine(engineHandle) != MA_SUCCESS || frames == NULL || channels == 0 || sampleRate == 0) {
+    manet_dynamics_node* handle = manet_dynamics_node_init(engineHandle, MANET_DYNAMICS_COMPRESSOR, channels, 0, kernel);
+    if (handle == NULL) {
         return NULL;
     }
 
-    manet_sound* soundHandle = (manet_sound*)manet_alloc(sizeof(*soundHandle));
-    if (soundHandle == NULL) {
+    if (manet_dynamics_node_set_compressor(handle, thresholdDb, ratio, attackMilliseconds, releaseMilliseconds, makeupDb) != MA_SUCCESS) {
+        manet_dynamics_node_free(handle);
         return NULL;
     }
 
-    memset(soundHandle, 0, sizeof(*soundHandle));
+    return manet_dynamics_node_attach(engineHandle, handle);
+}
 
-    ma_audio_buffer_config bufferConfig = ma_audio_buffer_config_init(ma_format_f32, channels, frameCount, frames, NULL);
-    bufferConfig.sampleRate = sampleRate;
-    ma_result result = ma_audio_buffer_init_copy(&bufferConfig, &soundHandle->audioBuffer);
-    if (result != MA_SUCCESS) {
-        manet_free(soundHandle);
-        return NULL;
+MANET_API void manet_dynamics_node_destroy(manet_dynamics_node* handle)
+{
+    if (handle == NULL) {
+        return;
     }
 
-    soundHandle->ownsAudioBuffer = MA_TRUE;
+    ma_node_uninit(&handle->base, NULL);
+    manet_dynamics_node_free(handle);
+}
 
-    result = ma_sound_init_from_data_source(&engineHandle->engine, (ma_data_source*)&soundHandle->audioBuffer, flags, NULL, &soundHandle->sound);
-    if (result != MA_SUCCESS) {
-        ma_audio_buffer_uninit(&soundHandle->audioBuffer);
-        manet_free(soundHandle);
-        return NULL;
+MANET_API ma_uint32 manet_dynamics_node_get_kernel(manet_dynamics_node* handle)
+{
+    return handle != NULL ? (ma_uint32)handle->kernels->type : MANET_DYNAMICS_KERNEL_AUTO;
+}
+
+/* Returns the lowest gain applied since the previous call (1 when nothing was reduced) and starts a new period. */
+MANET_API ma_result manet_dynamics_node_read_min_gain(manet_dynamics_node* handle, float* minGain)
+{
+    if (minGain != NULL) {
+        *minGain = 1.0f;
     }
 
-    if ((flags & MA_SOUND_FLAG_LOOPING) != 0) {
-        ma_data_source_set_looping((ma_data_source*)&soundHandle->audioBuffer, MA_TRUE);
+    if (handle == NULL) {
+        return MA_INVALID_OPERATION;
     }
 
-    soundHandle->state = MANET_SOUND_STATE_STOPPED;
-    return soundHandle;
+    if (minGain == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    *minGain = ma_atomic_float_exchange(&handle->minGain, 1.0f);
+    return MA_SUCCESS;
 }
 
-MANET_API manet_sound* manet_sound_create_streaming(manet_engine* engineHandle, ma_uint32 channels, ma_uint32 sampleRate, ma_uint32 capacityInFrames, ma_uint32 flags)
+/* Graph nodes are handed to the host as plain ma_node pointers taken from their owning object, which must stay
+   alive while the pointer is used. */
+MANET_API ma_node* manet_engine_get_endpoint_node(manet_engine* handle)
 {
-    if (manet_validate_engine(engineHandle) != MA_SUCCESS || channels == 0 || sampleRate == 0 || capacityInFrames == 0) {
-        return NULL;
-    }
+    return handle != NULL ? ma_engine_get_endpoint(&handle->engine) : NULL;
+}
 
-    manet_pcm_stream* stream = manet_pcm_stream_create(channels, sampleRate, capacityInFrames);
-    if (stream == NULL) {
-        return NULL;
-    }
+MANET_API ma_node* manet_sound_get_node(manet_sound* handle)
+{
+    return handle != NULL ? (ma_node*)&handle->sound : NULL;
+}
 
-    manet_sound* soundHandle = (manet_sound*)manet_alloc(sizeof(*soundHandle));
-    if (soundHandle == NULL) {
-        manet_pcm_stream_destroy(stream);
-        return NULL;
-    }
+MANET_API ma_node* manet_sound_group_get_node(manet_sound_group* handle)
+{
+    return handle != NULL ? (ma_node*)&handle->group : NULL;
+}
 
-    memset(soundHandle, 0, sizeof(*soundHandle));
+MANET_API ma_node* manet_splitter_get_node(manet_splitter* handle)
+{
+    return handle != NULL ? (ma_node*)&handle->node : NULL;
+}
 
-    ma_result result = ma_sound_init_from_data_source(&engineHandle->engine, (ma_data_source*)&stream->ds, flags, NULL, &soundHandle->sound);
-    if (result != MA_SUCCESS) {
-        manet_pcm_stream_destroy(stream);
-        manet_free(soundHandle);
-        return NULL;
+MANET_API ma_node* manet_effect_node_get_node(manet_effect_node* handle)
+{
+    return handle != NULL ? (ma_node*)&handle->node : NULL;
+}
+
+MANET_API ma_node* manet_custom_node_get_node(manet_custom_node* handle)
+{
+    return handle != NULL ? (ma_node*)&handle->base : NULL;
+}
+
+MANET_API ma_node* manet_dynamics_node_get_node(manet_dynamics_node* handle)
+{
+    return handle != NULL ? (ma_node*)&handle->base : NULL;
+}
+
+MANET_API ma_result manet_node_attach_output_bus(ma_node* node, ma_uint32 outputBusIndex, ma_node* target, ma_uint32 targetInputBusIndex)
+{
+    if (node == NULL) {
+        return MA_INVALID_OPERATION;
     }
 
-    if ((flags & MA_SOUND_FLAG_LOOPING) != 0) {
-        ma_data_source_set_looping((ma_data_source*)&stream->ds, MA_TRUE);
+    if (target == NULL || target == node) {
+        return MA_INVALID_ARGS;
     }
 
-    soundHandle->state = MANET_SOUND_STATE_STOPPED;
-    soundHandle->stream = stream;
-    soundHandle->isStreaming = MA_TRUE;
-    soundHandle->ownsAudioBuffer = MA_FALSE;
-    return soundHandle;
+    return ma_node_attach_output_bus(node, outputBusIndex, target, targetInputBusIndex);
 }
 
-MANET_API ma_result manet_sound_stream_append_pcm_frames(manet_sound* handle, const float* frames, ma_uint64 frameCount, ma_uint64* framesWritten)
+MANET_API ma_result manet_node_detach_output_bus(ma_node* node, ma_uint32 outputBusIndex)
 {
-    if (framesWritten != NULL) {
-        *framesWritten = 0;
+    if (node == NULL) {
+        return MA_INVALID_OPERATION;
     }
 
-    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
+    return ma_node_detach_output_bus(node, outputBusIndex);
+}
+
+MANET_API ma_result manet_node_detach_all_output_buses(ma_node* node)
+{
+    if (node == NULL) {
         return MA_INVALID_OPERATION;
     }
 
-    return manet_pcm_stream_append_pcm_frames(handle->stream, frames, frameCount, framesWritten);
+    return ma_node_detach_all_output_buses(node);
 }
 
-MANET_API ma_result manet_sound_stream_get_available_write(manet_sound* handle, ma_uint64* availableFrames)
+MANET_API ma_result manet_node_set_output_bus_volume(ma_node* node, ma_uint32 outputBusIndex, float volume)
 {
-    if (availableFrames != NULL) {
-        *availableFrames = 0;
+    if (node == NULL) {
+        return MA_INVALID_OPERATION;
     }
 
-    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
+    return ma_node_set_output_bus_volume(node, outputBusIndex, volume);
+}
+
+MANET_API ma_result manet_node_get_output_bus_volume(ma_node* node, ma_uint32 outputBusIndex, float* volume)
+{
+    if (volume != NULL) {
+        *volume = 0.0f;
+    }
+
+    if (node == NULL) {
         return MA_INVALID_OPERATION;
     }
 
-    if (availableFrames != NULL) {
-        *availableFrames = manet_pcm_stream_available_write(handle->stream);
+    if (volume == NULL || outputBusIndex >= ma_node_get_output_bus_count(node)) {
+        return MA_INVALID_ARGS;
     }
 
-    return MA_SUCCESS;
+    *volume = ma_node_get_output_bus_volume(node, outputBusIndex);
+    return MA_SUCCESS;
+}
+
+MANET_API ma_uint32 manet_node_get_input_bus_count(ma_node* node)
+{
+    return node != NULL ? ma_node_get_input_bus_count(node) : 0;
+}
+
+MANET_API ma_uint32 manet_node_get_output_bus_count(ma_node* node)
+{
+    return node != NULL ? ma_node_get_output_bus_count(node) : 0;
 }
 
-MANET_API ma_result manet_sound_stream_get_queued_frames(manet_sound* handle, ma_uint64* queuedFrames)
+static manet_voice* manet_voice_pool_acquire_voice(manet_voice_pool* pool)
 {
-    if (queuedFrames != NULL) {
-        *queuedFrames = 0;
-    }
+    manet_voice* victim = NULL;
 
-    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
-        return MA_INVALID_OPERATION;
+    for (ma_uint32 i = 0; i < pool->capacity; ++i) {
+        manet_voice* voice = &pool->voices[i];
+        if (ma_atomic_uint32_get(&voice->activeGeneration) == 0) {
+            return voice;
+        }
+
+        if (pool->policy == MANET_VOICE_STEAL_OLDEST) {
+            if (victim == NULL || voice->startSequence < victim->startSequence) {
+                victim = voice;
+            }
+        } else if (pool->policy == MANET_VOICE_STEAL_QUIETEST) {
+            if (victim == NULL || voice->volume < victim->volume || (voice->volume == victim->volume && voice->startSequence < victim->startSequence)) {
+                victim = voice;
+            }
+        }
     }
 
-    if (queuedFrames != NULL) {
-        *queuedFrames = manet_pcm_stream_available_read(handle->stream);
+    if (victim != NULL) {
+        ma_sound_stop(&victim->sound);
+        ma_atomic_uint64_fetch_add(&pool->stealCount, 1);
     }
 
-    return MA_SUCCESS;
+    return victim;
 }
 
-MANET_API ma_uint64 manet_sound_stream_get_capacity_in_frames(manet_sound* handle)
+static void manet_voice_end_callback(void* pUserData, ma_sound* pSound)
 {
-    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
-        return 0;
-    }
+    (void)pSound;
 
-    return manet_pcm_stream_capacity(handle->stream);
+    /* Only free the voice if it is still playing the clip that ended; a steal has already moved it on otherwise. */
+    manet_voice* voice = (manet_voice*)pUserData;
+    if (voice != NULL && voice->endedGeneration != 0) {
+        ma_atomic_uint32_compare_and_swap(&voice->activeGeneration, voice->endedGeneration, 0);
+    }
 }
 
-MANET_API ma_result manet_sound_stream_mark_end(manet_sound* handle)
+static ma_result manet_voice_on_read(ma_data_source* pDataSource, void* pFramesOut, ma_uint64 frameCount, ma_uint64* pFramesRead)
 {
-    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
-        return MA_INVALID_OPERATION;
+    manet_voice* voice = (manet_voice*)pDataSource;
+    ma_uint64 framesRead = 0;
+    ma_uint32 generation = 0;
+
+    ma_atomic_uint32_fetch_add(&voice->readers, 1);
+    manet_pcm_buffer* clip = (manet_pcm_buffer*)ma_atomic_load_ptr(&voice->clip);
+    if (clip != NULL) {
+        generation = ma_atomic_uint32_get(&voice->generation);
+
+        ma_uint64 cursor = ma_atomic_uint64_get(&voice->cursor);
+        if (cursor < clip->frameCount) {
+            framesRead = clip->frameCount - cursor;
+            if (framesRead > frameCount) {
+                framesRead = frameCount;
+            }
+
+            if (pFramesOut != NULL) {
+                ma_copy_pcm_frames(pFramesOut, ma_offset_pcm_frames_const_ptr_f32(clip->data, cursor, clip->channels), framesRead, ma_format_f32, clip->channels);
+            }
+
+            ma_atomic_uint64_set(&voice->cursor, cursor + framesRead);
+        }
+    }
+    ma_atomic_uint32_fetch_sub(&voice->readers, 1);
+
+    if (pFramesRead != NULL) {
+        *pFramesRead = framesRead;
+    }
+
+    if (framesRead == 0) {
+        voice->endedGeneration = generation;
+        return MA_AT_END;
     }
 
-    manet_pcm_stream_mark_end(handle->stream);
     return MA_SUCCESS;
 }
 
-MANET_API ma_result manet_sound_stream_clear_end(manet_sound* handle)
+static ma_result manet_voice_on_seek(ma_data_source* pDataSource, ma_uint64 frameIndex)
 {
-    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
-        return MA_INVALID_OPERATION;
-    }
+    manet_voice* voice = (manet_voice*)pDataSource;
+
+    ma_atomic_uint64_set(&voice->cursor, frameIndex);
 
-    manet_pcm_stream_clear_end(handle->stream);
     return MA_SUCCESS;
 }
 
-MANET_API ma_bool32 manet_sound_stream_is_end(manet_sound* handle)
+static ma_result manet_voice_on_get_data_format(ma_data_source* pDataSource, ma_format* pFormat, ma_uint32* pChannels, ma_uint32* pSampleRate, ma_channel* pChannelMap, size_t channelMapCap)
 {
-    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
-        return MA_FALSE;
+    manet_voice* voice = (manet_voice*)pDataSource;
+
+    if (pFormat != NULL) {
+        *pFormat = ma_format_f32;
     }
 
-    return manet_pcm_stream_is_end_requested(handle->stream);
-}
+    if (pChannels != NULL) {
+        *pChannels = voice->channels;
+    }
 
-MANET_API ma_result manet_sound_stream_reset(manet_sound* handle)
-{
-    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
-        return MA_INVALID_OPERATION;
+    if (pSampleRate != NULL) {
+        *pSampleRate = voice->sampleRate;
     }
 
-    ma_result result = manet_pcm_stream_reset(handle->stream);
-    if (result != MA_SUCCESS) {
-        return result;
+    if (pChannelMap != NULL) {
+        ma_channel_map_init_standard(ma_standard_channel_map_default, pChannelMap, channelMapCap, voice->channels);
     }
 
-    ma_sound_seek_to_pcm_frame(&handle->sound, 0);
     return MA_SUCCESS;
 }
 
-MANET_API ma_uint32 manet_sound_stream_get_channels(manet_sound* handle)
+static ma_result manet_voice_on_get_cursor(ma_data_source* pDataSource, ma_uint64* pCursor)
 {
-    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
-        return 0;
-    }
+    manet_voice* voice = (manet_voice*)pDataSource;
 
-    return manet_pcm_stream_get_channels(handle->stream);
+    *pCursor = ma_atomic_uint64_get(&voice->cursor);
+
+    return MA_SUCCESS;
 }
 
-MANET_API ma_uint32 manet_sound_stream_get_sample_rate(manet_sound* handle)
+static ma_result manet_voice_on_get_length(ma_data_source* pDataSource, ma_uint64* pLength)
 {
-    if (manet_validate_streaming_sound(handle) != MA_SUCCESS) {
-        return 0;
-    }
+    manet_voice* voice = (manet_voice*)pDataSource;
 
-    return manet_pcm_stream_get_sample_rate(handle->stream);
+    ma_atomic_uint32_fetch_add(&voice->readers, 1);
+    manet_pcm_buffer* clip = (manet_pcm_buffer*)ma_atomic_load_ptr(&voice->clip);
+    *pLength = clip != NULL ? clip->frameCount : 0;
+    ma_atomic_uint32_fetch_sub(&voice->readers, 1);
+
+    return MA_SUCCESS;
 }
 
 MANET_API void manet_sound_destroy(manet_sound* handle)
@@ -1417,17 +7039,39 @@ MANET_API void manet_sound_destroy(manet_sound* handle)
         return;
     }
 
+    /* ma_sound_uninit frees the data source it loaded, so the job that completed the load must be done with it. */
+    ma_resource_manager_data_source* dataSource = handle->sound.pResourceManagerDataSource;
+    if (dataSource != NULL && (handle->initFlags & MA_SOUND_FLAG_STREAM) == 0) {
+        manet_data_buffer_wait_for_jobs(&dataSource->backend.buffer);
+    }
+
+    /* Detach the sound from the graph before releasing the PCM it reads from. */
+    ma_sound_uninit(&handle->sound);
+
     if (handle->ownsAudioBuffer) {
         ma_audio_buffer_uninit(&handle->audioBuffer);
     }
 
-    ma_sound_uninit(&handle->sound);
+    if (handle->sharedBuffer != NULL) {
+        manet_pcm_buffer_release(handle->sharedBuffer);
+        handle->sharedBuffer = NULL;
+    }
+
+    if (handle->registeredData != NULL) {
+        manet_registered_data_release_from_sound(handle->registeredData);
+        handle->registeredData = NULL;
+    }
 
     if (handle->isStreaming == MA_TRUE && handle->stream != NULL) {
         manet_pcm_stream_destroy(handle->stream);
         handle->stream = NULL;
     }
 
+    /* The data buffer this sound was holding may now be evictable. */
+    if (handle->cache != NULL) {
+        manet_resource_cache_trim(handle->cache, MA_FALSE);
+    }
+
     manet_free(handle);
 }
 
@@ -1726,13 +7370,14 @@ MANET_API ma_uint32 manet_sound_get_sample_rate(manet_sound* handle)
     return sampleRate;
 }
 
-MANET_API manet_capture_device* manet_capture_device_create(
+MANET_API manet_capture_device* manet_capture_device_create_ex(
     manet_context* contextHandle,
     const char* captureDeviceId,
     ma_uint32 sampleRate,
     ma_uint32 channelCount,
     manet_capture_device_proc callback,
-    void* userData)
+    void* userData,
+    ma_uint32 ringCapacityInFrames)
 {
 #if defined(MA_NO_DEVICE_IO)
     (void)contextHandle;
@@ -1741,9 +7386,10 @@ MANET_API manet_capture_device* manet_capture_device_create(
     (void)channelCount;
     (void)callback;
     (void)userData;
+    (void)ringCapacityInFrames;
     return NULL;
 #else
-    if (callback == NULL || channelCount == 0) {
+    if ((callback == NULL && ringCapacityInFrames == 0) || channelCount == 0) {
         return NULL;
     }
 
@@ -1790,6 +7436,25 @@ MANET_API manet_capture_device* manet_capture_device_create(
         return NULL;
     }
 
+    if (ringCapacityInFrames > 0) {
+        result = ma_pcm_rb_init(ma_format_f32, handle->device.capture.channels, ringCapacityInFrames, NULL, NULL, &handle->ringBuffer);
+        if (result != MA_SUCCESS) {
+            ma_device_uninit(&handle->device);
+            manet_free(handle);
+            return NULL;
+        }
+
+        result = manet_signal_init(&handle->readSignal);
+        if (result != MA_SUCCESS) {
+            ma_pcm_rb_uninit(&handle->ringBuffer);
+            ma_device_uninit(&handle->device);
+            manet_free(handle);
+            return NULL;
+        }
+
+        handle->hasRingBuffer = MA_TRUE;
+    }
+
     handle->callback = callback;
     handle->userData = userData;
     handle->channelCount = config.capture.channels;
@@ -1798,6 +7463,17 @@ MANET_API manet_capture_device* manet_capture_device_create(
 #endif
 }
 
+MANET_API manet_capture_device* manet_capture_device_create(
+    manet_context* contextHandle,
+    const char* captureDeviceId,
+    ma_uint32 sampleRate,
+    ma_uint32 channelCount,
+    manet_capture_device_proc callback,
+    void* userData)
+{
+    return manet_capture_device_create_ex(contextHandle, captureDeviceId, sampleRate, channelCount, callback, userData, 0);
+}
+
 MANET_API ma_result manet_capture_device_start(manet_capture_device* handle)
 {
 #if defined(MA_NO_DEVICE_IO)
@@ -1826,6 +7502,202 @@ MANET_API ma_result manet_capture_device_stop(manet_capture_device* handle)
 #endif
 }
 
+MANET_API ma_result manet_capture_device_read(manet_capture_device* handle, float* frames, ma_uint32 frameCount, ma_uint32* framesRead)
+{
+    if (framesRead != NULL) {
+        *framesRead = 0;
+    }
+
+#if defined(MA_NO_DEVICE_IO)
+    (void)handle;
+    (void)frames;
+    (void)frameCount;
+    return MA_INVALID_OPERATION;
+#else
+    if (handle == NULL || handle->hasRingBuffer == MA_FALSE) {
+        return MA_INVALID_OPERATION;
+    }
+
+    if (frameCount == 0) {
+        return MA_SUCCESS;
+    }
+
+    if (frames == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    ma_pcm_rb* rb = &handle->ringBuffer;
+    ma_uint32 totalRead = 0;
+
+    while (totalRead < frameCount) {
+        ma_uint32 mappedFrameCount = frameCount - totalRead;
+        void* mappedBuffer = NULL;
+        ma_result result = ma_pcm_rb_acquire_read(rb, &mappedFrameCount, &mappedBuffer);
+        if (result != MA_SUCCESS || mappedFrameCount == 0) {
+            break;
+        }
+
+        ma_copy_pcm_frames(ma_offset_pcm_frames_ptr(frames, totalRead, rb->format, rb->channels), mappedBuffer, mappedFrameCount, rb->format, rb->channels);
+        result = ma_pcm_rb_commit_read(rb, mappedFrameCount);
+        if (result != MA_SUCCESS) {
+            break;
+        }
+
+        totalRead += mappedFrameCount;
+    }
+
+    if (framesRead != NULL) {
+        *framesRead = totalRead;
+    }
+
+    return MA_SUCCESS;
+#endif
+}
+
+MANET_API ma_result manet_capture_device_get_available_read(manet_capture_device* handle, ma_uint32* availableFrames)
+{
+    if (availableFrames != NULL) {
+        *availableFrames = 0;
+    }
+
+#if defined(MA_NO_DEVICE_IO)
+    (void)handle;
+    return MA_INVALID_OPERATION;
+#else
+    if (handle == NULL || handle->hasRingBuffer == MA_FALSE) {
+        return MA_INVALID_OPERATION;
+    }
+
+    if (availableFrames == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    *availableFrames = ma_pcm_rb_available_read(&handle->ringBuffer);
+    return MA_SUCCESS;
+#endif
+}
+
+MANET_API ma_result manet_capture_device_get_dropped_frames(manet_capture_device* handle, ma_uint64* droppedFrames)
+{
+    if (droppedFrames != NULL) {
+        *droppedFrames = 0;
+    }
+
+#if defined(MA_NO_DEVICE_IO)
+    (void)handle;
+    return MA_INVALID_OPERATION;
+#else
+    if (handle == NULL || handle->hasRingBuffer == MA_FALSE) {
+        return MA_INVALID_OPERATION;
+    }
+
+    if (droppedFrames == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    *droppedFrames = ma_atomic_uint64_get(&handle->droppedFrames);
+    return MA_SUCCESS;
+#endif
+}
+
+/* Arms a one-shot MANET_CAPTURE_NOTIFICATION_READ for when at least frames are available; 0 disarms it. */
+MANET_API ma_result manet_capture_device_request_read(manet_capture_device* handle, ma_uint32 frames)
+{
+#if defined(MA_NO_DEVICE_IO)
+    (void)handle;
+    (void)frames;
+    return MA_INVALID_OPERATION;
+#else
+    if (handle == NULL || handle->hasRingBuffer == MA_FALSE) {
+        return MA_INVALID_OPERATION;
+    }
+
+    if (frames > ma_pcm_rb_get_subbuffer_size(&handle->ringBuffer)) {
+        return MA_INVALID_ARGS;
+    }
+
+    ma_atomic_uint32_set(&handle->readRequest, frames);
+
+    /* The device thread may have filled the ring before the request was armed. */
+    if (frames != 0 && ma_pcm_rb_available_read(&handle->ringBuffer) >= frames) {
+        if (ma_atomic_uint32_compare_and_swap(&handle->readRequest, frames, 0) == frames) {
+            manet_signal_raise(&handle->readSignal, MANET_CAPTURE_NOTIFICATION_READ);
+        }
+    }
+
+    return MA_SUCCESS;
+#endif
+}
+
+/* Blocks the calling thread until a read request is satisfied. Meant for a dedicated waiter thread; returns
+   MA_CANCELLED once manet_capture_device_close_notifications has been called. */
+MANET_API ma_result manet_capture_device_wait_notifications(manet_capture_device* handle, ma_uint32* notifications)
+{
+    if (notifications != NULL) {
+        *notifications = 0;
+    }
+
+#if defined(MA_NO_DEVICE_IO)
+    (void)handle;
+    return MA_INVALID_OPERATION;
+#else
+    if (handle == NULL || handle->hasRingBuffer == MA_FALSE) {
+        return MA_INVALID_OPERATION;
+    }
+
+    if (notifications == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    return manet_signal_wait(&handle->readSignal, notifications);
+#endif
+}
+
+/* Releases a thread blocked in manet_capture_device_wait_notifications for good; call before destroying the device. */
+MANET_API ma_result manet_capture_device_close_notifications(manet_capture_device* handle)
+{
+#if defined(MA_NO_DEVICE_IO)
+    (void)handle;
+    return MA_INVALID_OPERATION;
+#else
+    if (handle == NULL || handle->hasRingBuffer == MA_FALSE) {
+        return MA_INVALID_OPERATION;
+    }
+
+    manet_signal_close(&handle->readSignal);
+    return MA_SUCCESS;
+#endif
+}
+
+#if defined(MANET_ENABLE_TEST_HOOKS)
+/* Test hook, only exported from builds configured with MANET_ENABLE_TEST_HOOKS. Feeds frames through the
+   device-thread path; only valid while the device is stopped, since the ring has a single producer. */
+MANET_API ma_result manet_capture_device_write_frames(manet_capture_device* handle, const float* frames, ma_uint32 frameCount)
+{
+#if defined(MA_NO_DEVICE_IO)
+    (void)handle;
+    (void)frames;
+    (void)frameCount;
+    return MA_INVALID_OPERATION;
+#else
+    if (handle == NULL || ma_device_is_started(&handle->device)) {
+        return MA_INVALID_OPERATION;
+    }
+
+    if (frameCount == 0) {
+        return MA_SUCCESS;
+    }
+
+    if (frames == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    manet_capture_device_data_callback(&handle->device, NULL, frames, frameCount);
+    return MA_SUCCESS;
+#endif
+}
+#endif
+
 MANET_API void manet_capture_device_destroy(manet_capture_device* handle)
 {
 #if defined(MA_NO_DEVICE_IO)
@@ -1836,6 +7708,11 @@ MANET_API void manet_capture_device_destroy(manet_capture_device* handle)
     }
 
     ma_device_uninit(&handle->device);
+    if (handle->hasRingBuffer) {
+        manet_signal_uninit(&handle->readSignal);
+        ma_pcm_rb_uninit(&handle->ringBuffer);
+    }
+
     manet_free(handle);
 #endif
 }
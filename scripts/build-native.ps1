@@ -1,7 +1,9 @@
 param(
     [string]$Preset,
     [string]$Rid,
-    [string]$Configuration = "Release"
+    [string]$Configuration = "Release",
+    # Exports the test-only entry points used by the integration tests; not for distributed binaries.
+    [switch]$TestHooks
 )
 
 $ErrorActionPreference = "Stop"
@@ -53,7 +55,8 @@ Push-Location (Join-Path $nativeDir "native")
 
 try {
     Write-Host "Configuring '$Preset'..."
-    cmake --preset $Preset | Out-Null
+    $testHooksValue = if ($TestHooks) { "ON" } else { "OFF" }
+    cmake --preset $Preset "-DMANET_ENABLE_TEST_HOOKS=$testHooksValue" | Out-Null
 
     Write-Host "Building preset '$buildPreset'..."
     cmake --build --preset $buildPreset | Out-Null
@@ -4,12 +4,14 @@ set -euo pipefail
 PRESET=""
 RID=""
 CONFIG="Release"
+TEST_HOOKS="OFF"
 
 usage() {
   cat <<'EOF'
-Usage: scripts/build-native.sh [--preset <name>] [--rid <runtime identifier>] [--config <Configuration>]
+Usage: scripts/build-native.sh [--preset <name>] [--rid <runtime identifier>] [--config <Configuration>] [--test-hooks]
 
 Preset または RID のいずれかを必ず指定してください。
+--test-hooks を付けると、インテグレーションテスト専用のエクスポートを含めてビルドします（配布用には使わないでください）。
 EOF
 }
 
@@ -27,6 +29,10 @@ while [[ $# -gt 0 ]]; do
       CONFIG="$2"
       shift 2
       ;;
+    --test-hooks)
+      TEST_HOOKS="ON"
+      shift
+      ;;
     -h|--help)
       usage
       exit 0
@@ -90,7 +96,7 @@ pushd "$REPO_ROOT/native" > /dev/null
 BUILD_DIR="$REPO_ROOT/build/native/$PRESET"
 
 echo "Configuring preset '$PRESET'..."
-cmake --preset "$PRESET"
+cmake --preset "$PRESET" -DMANET_ENABLE_TEST_HOOKS="$TEST_HOOKS"
 
 echo "Building preset '$BUILD_PRESET'..."
 cmake --build --preset "$BUILD_PRESET"
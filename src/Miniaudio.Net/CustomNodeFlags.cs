@@ -0,0 +1,14 @@
+using System;
+
+namespace Miniaudio.Net;
+
+// Subset of ma_node flags that make sense for a host-processed node.
+[Flags]
+public enum CustomNodeFlags : uint
+{
+    None = 0,
+    // Call the process function with silent input when nothing is arriving, e.g. to let a reverb tail ring out.
+    ContinuousProcessing = 0x0000_0002,
+    // Output is discarded; for analysis nodes that only observe their input.
+    SilentOutput = 0x0000_0010,
+}
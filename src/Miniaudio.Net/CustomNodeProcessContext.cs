@@ -0,0 +1,50 @@
+using System;
+using System.Runtime.InteropServices;
+
+namespace Miniaudio.Net;
+
+// Mirrors manet_node_process_info. The process function receives a pointer to it on the audio thread; the buffers it
+// exposes are only valid for the duration of that call.
+[StructLayout(LayoutKind.Sequential)]
+public readonly unsafe struct CustomNodeProcessContext
+{
+    private readonly IntPtr _userData;
+    private readonly float** _inputs;
+    private readonly float** _outputs;
+    private readonly uint _inputBusCount;
+    private readonly uint _outputBusCount;
+    private readonly uint _channels;
+    private readonly uint _frameCount;
+
+    public IntPtr UserData => _userData;
+
+    public uint InputBusCount => _inputBusCount;
+
+    public uint OutputBusCount => _outputBusCount;
+
+    public uint Channels => _channels;
+
+    public uint FrameCount => _frameCount;
+
+    // Interleaved samples, FrameCount * Channels long. Unattached or idle inputs read as silence.
+    public ReadOnlySpan<float> GetInput(int bus)
+    {
+        if ((uint)bus >= _inputBusCount)
+        {
+            throw new ArgumentOutOfRangeException(nameof(bus));
+        }
+
+        return new ReadOnlySpan<float>(_inputs[bus], checked((int)(_frameCount * _channels)));
+    }
+
+    // Interleaved samples, FrameCount * Channels long. The buffer is not cleared beforehand, so write every sample.
+    public Span<float> GetOutput(int bus)
+    {
+        if ((uint)bus >= _outputBusCount)
+        {
+            throw new ArgumentOutOfRangeException(nameof(bus));
+        }
+
+        return new Span<float>(_outputs[bus], checked((int)(_frameCount * _channels)));
+    }
+}
@@ -0,0 +1,12 @@
+namespace Miniaudio.Net;
+
+// Instruction set used by a limiter or compressor node. Auto picks the widest one the CPU supports; a fixed choice
+// makes renders bit-identical across machines that support it.
+public enum DynamicsKernel : uint
+{
+    Auto = 0,
+    Scalar = 1,
+    Sse2 = 2,
+    Avx2 = 3,
+    Neon = 4,
+}
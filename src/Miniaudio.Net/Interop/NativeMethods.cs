@@ -1,4 +1,5 @@
 using System;
+using System.Buffers;
 using System.Runtime.InteropServices;
 using Miniaudio.Net;
 
@@ -14,6 +15,27 @@ internal static partial class NativeMethods
     [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
     internal delegate void CaptureDeviceDataCallback(IntPtr samples, uint frameCount, uint channelCount, IntPtr userData);
 
+    [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+    internal delegate void SoundLoadCallback(IntPtr userData, int result);
+
+    [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+    internal unsafe delegate int VfsOpenCallback(IntPtr userData, byte* path, uint openMode, IntPtr* file);
+
+    [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+    internal delegate int VfsCloseCallback(IntPtr userData, IntPtr file);
+
+    [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+    internal unsafe delegate int VfsReadCallback(IntPtr userData, IntPtr file, byte* destination, nuint sizeInBytes, nuint* bytesRead);
+
+    [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+    internal delegate int VfsSeekCallback(IntPtr userData, IntPtr file, long offset, uint origin);
+
+    [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+    internal unsafe delegate int VfsTellCallback(IntPtr userData, IntPtr file, long* cursor);
+
+    [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+    internal unsafe delegate int VfsSizeCallback(IntPtr userData, IntPtr file, ulong* sizeInBytes);
+
     internal static EngineHandle EngineCreate()
     {
         var handle = EngineCreateCore();
@@ -29,7 +51,8 @@ internal static partial class NativeMethods
         uint periodSizeInFrames,
         uint periodSizeInMilliseconds,
         bool noAutoStart,
-        bool noDevice)
+        bool noDevice,
+        bool enableMetering)
     {
         var contextPtr = IntPtr.Zero;
         var resourceManagerPtr = IntPtr.Zero;
@@ -63,7 +86,8 @@ internal static partial class NativeMethods
                 periodSizeInFrames,
                 periodSizeInMilliseconds,
                 noAutoStart ? 1 : 0,
-                noDevice ? 1 : 0);
+                noDevice ? 1 : 0,
+                enableMetering ? 1 : 0);
 
             return EngineHandle.FromIntPtr(handle);
         }
@@ -110,6 +134,13 @@ internal static partial class NativeMethods
         return ResourceManagerHandle.FromIntPtr(handle);
     }
 
+    internal static unsafe ResourceManagerHandle ResourceManagerCreate(ResourceManagerConfig config, VfsConfig vfs)
+    {
+        // The native side copies the callbacks, so the config only has to outlive the call.
+        config.Vfs = (IntPtr)(&vfs);
+        return ResourceManagerCreate(config);
+    }
+
     [LibraryImport(LibraryName, EntryPoint = "manet_engine_create_default")]
     private static partial IntPtr EngineCreateCore();
 
@@ -123,7 +154,8 @@ internal static partial class NativeMethods
         uint periodSizeInFrames,
         uint periodSizeInMilliseconds,
         int noAutoStart,
-        int noDevice);
+        int noDevice,
+        int enableMetering);
 
     [LibraryImport(LibraryName, EntryPoint = "manet_context_create_default")]
     private static partial IntPtr ContextCreateDefaultCore();
@@ -169,6 +201,20 @@ internal static partial class NativeMethods
     [LibraryImport(LibraryName, EntryPoint = "manet_engine_play_sound", StringMarshalling = StringMarshalling.Utf8)]
     internal static partial int EnginePlaySound(EngineHandle handle, string path);
 
+    internal static unsafe int EngineReadPcmFrames(EngineHandle handle, Span<float> frames, ulong frameCount, out ulong framesRead)
+    {
+        ulong read = 0;
+        fixed (float* pFrames = frames)
+        {
+            var result = EngineReadPcmFramesCore(handle, pFrames, frameCount, &read);
+            framesRead = read;
+            return result;
+        }
+    }
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_engine_read_pcm_frames")]
+    private static unsafe partial int EngineReadPcmFramesCore(EngineHandle handle, float* frames, ulong frameCount, ulong* framesRead);
+
     [LibraryImport(LibraryName, EntryPoint = "manet_engine_set_listener_position")]
     internal static partial int EngineSetListenerPosition(EngineHandle handle, uint index, float x, float y, float z);
 
@@ -208,6 +254,9 @@ internal static partial class NativeMethods
     [LibraryImport(LibraryName, EntryPoint = "manet_engine_get_sample_rate")]
     internal static partial uint EngineGetSampleRate(EngineHandle handle);
 
+    [LibraryImport(LibraryName, EntryPoint = "manet_engine_get_meter_snapshot")]
+    internal static partial int EngineGetMeterSnapshot(EngineHandle handle, out EngineMeterSnapshot snapshot);
+
     [LibraryImport(LibraryName, EntryPoint = "manet_engine_get_channels")]
     internal static partial uint EngineGetChannelCount(EngineHandle handle);
 
@@ -237,9 +286,111 @@ internal static partial class NativeMethods
         return SoundHandle.FromIntPtr(handle);
     }
 
+    // Registered data is keyed by the UTF-8 name, so it must never go through the wide-character entry point.
+    internal static SoundHandle SoundCreateFromRegisteredData(EngineHandle engine, string name, uint flags)
+    {
+        return SoundHandle.FromIntPtr(SoundCreateFromFileCore(engine, name, flags));
+    }
+
     [LibraryImport(LibraryName, EntryPoint = "manet_sound_create_from_file", StringMarshalling = StringMarshalling.Utf8)]
     private static partial IntPtr SoundCreateFromFileCore(EngineHandle engine, string path, uint flags);
 
+    internal static SoundHandle SoundCreateFromFileAsync(EngineHandle engine, string path, uint flags, SoundLoadCallback callback, IntPtr userData)
+    {
+        var handle = OperatingSystem.IsWindows()
+            ? SoundCreateFromFileAsyncWCore(engine, path, flags, callback, userData)
+            : SoundCreateFromFileAsyncCore(engine, path, flags, callback, userData);
+        return SoundHandle.FromIntPtr(handle);
+    }
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_create_from_file_async", StringMarshalling = StringMarshalling.Utf8)]
+    private static partial IntPtr SoundCreateFromFileAsyncCore(EngineHandle engine, string path, uint flags, SoundLoadCallback callback, IntPtr userData);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_create_from_file_async_w", StringMarshalling = StringMarshalling.Utf16)]
+    private static partial IntPtr SoundCreateFromFileAsyncWCore(EngineHandle engine, string path, uint flags, SoundLoadCallback callback, IntPtr userData);
+
+    internal static unsafe int EngineRegisterEncodedData(EngineHandle engine, string name, ReadOnlySpan<byte> data)
+    {
+        fixed (byte* pData = data)
+        {
+            return EngineRegisterEncodedDataCore(engine, name, pData, (ulong)data.Length);
+        }
+    }
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_engine_register_encoded_data", StringMarshalling = StringMarshalling.Utf8)]
+    private static unsafe partial int EngineRegisterEncodedDataCore(EngineHandle engine, string name, byte* data, ulong sizeInBytes);
+
+    internal static unsafe int EngineRegisterSharedEncodedData(EngineHandle engine, string name, ReadOnlySpan<byte> data)
+    {
+        fixed (byte* pData = data)
+        {
+            return EngineRegisterSharedEncodedDataCore(engine, name, pData, (ulong)data.Length);
+        }
+    }
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_engine_register_shared_encoded_data", StringMarshalling = StringMarshalling.Utf8)]
+    private static unsafe partial int EngineRegisterSharedEncodedDataCore(EngineHandle engine, string name, byte* data, ulong sizeInBytes);
+
+    internal static unsafe int EngineRegisterDecodedData(EngineHandle engine, string name, ReadOnlySpan<float> frames, ulong frameCount, uint channels, uint sampleRate)
+    {
+        fixed (float* pFrames = frames)
+        {
+            return EngineRegisterDecodedDataCore(engine, name, pFrames, frameCount, channels, sampleRate);
+        }
+    }
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_engine_register_decoded_data", StringMarshalling = StringMarshalling.Utf8)]
+    private static unsafe partial int EngineRegisterDecodedDataCore(EngineHandle engine, string name, float* frames, ulong frameCount, uint channels, uint sampleRate);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_engine_unregister_data", StringMarshalling = StringMarshalling.Utf8)]
+    internal static partial int EngineUnregisterData(EngineHandle engine, string name);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_engine_is_data_registered", StringMarshalling = StringMarshalling.Utf8)]
+    internal static partial int EngineIsDataRegistered(EngineHandle engine, string name);
+
+    internal static unsafe int ResourceManagerRegisterDecodedData(ResourceManagerHandle manager, string name, ReadOnlySpan<float> frames, ulong frameCount, uint channels, uint sampleRate)
+    {
+        fixed (float* pFrames = frames)
+        {
+            return ResourceManagerRegisterDecodedDataCore(manager, name, pFrames, frameCount, channels, sampleRate);
+        }
+    }
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_resource_manager_register_decoded_data", StringMarshalling = StringMarshalling.Utf8)]
+    private static unsafe partial int ResourceManagerRegisterDecodedDataCore(ResourceManagerHandle manager, string name, float* frames, ulong frameCount, uint channels, uint sampleRate);
+
+    internal static unsafe int ResourceManagerRegisterEncodedData(ResourceManagerHandle manager, string name, ReadOnlySpan<byte> data)
+    {
+        fixed (byte* pData = data)
+        {
+            return ResourceManagerRegisterEncodedDataCore(manager, name, pData, (ulong)data.Length);
+        }
+    }
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_resource_manager_register_encoded_data", StringMarshalling = StringMarshalling.Utf8)]
+    private static unsafe partial int ResourceManagerRegisterEncodedDataCore(ResourceManagerHandle manager, string name, byte* data, ulong sizeInBytes);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_resource_manager_unregister_data", StringMarshalling = StringMarshalling.Utf8)]
+    internal static partial int ResourceManagerUnregisterData(ResourceManagerHandle manager, string name);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_resource_manager_is_data_registered", StringMarshalling = StringMarshalling.Utf8)]
+    internal static partial int ResourceManagerIsDataRegistered(ResourceManagerHandle manager, string name);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_resource_manager_set_memory_budget")]
+    internal static partial int ResourceManagerSetMemoryBudget(ResourceManagerHandle manager, ulong budgetInBytes);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_resource_manager_get_stats")]
+    internal static partial int ResourceManagerGetStats(ResourceManagerHandle manager, out ResourceManagerStats stats);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_resource_manager_reset_stats")]
+    internal static partial int ResourceManagerResetStats(ResourceManagerHandle manager);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_resource_manager_get_job_stats")]
+    internal static partial int ResourceManagerGetJobStats(ResourceManagerHandle manager, out ResourceManagerJobStats stats);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_resource_manager_reset_job_stats")]
+    internal static partial int ResourceManagerResetJobStats(ResourceManagerHandle manager);
+
     [LibraryImport(LibraryName, EntryPoint = "manet_sound_create_from_file_w", StringMarshalling = StringMarshalling.Utf16)]
     private static partial IntPtr SoundCreateFromFileWCore(EngineHandle engine, string path, uint flags);
 
@@ -255,14 +406,346 @@ internal static partial class NativeMethods
     [LibraryImport(LibraryName, EntryPoint = "manet_sound_create_from_pcm_frames")]
     private static unsafe partial IntPtr SoundCreateFromPcmFramesCore(EngineHandle engine, float* frames, ulong frameCount, uint channels, uint sampleRate, uint flags);
 
-    internal static SoundHandle SoundCreateStreaming(EngineHandle engine, uint channels, uint sampleRate, uint capacityInFrames, uint flags)
+    internal static unsafe SoundHandle SoundCreateFromPcmFramesRef(EngineHandle engine, float* frames, ulong frameCount, uint channels, uint sampleRate, uint flags)
     {
-        var handle = SoundCreateStreamingCore(engine, channels, sampleRate, capacityInFrames, flags);
+        var handle = SoundCreateFromPcmFramesRefCore(engine, frames, frameCount, channels, sampleRate, flags);
         return SoundHandle.FromIntPtr(handle);
     }
 
-    [LibraryImport(LibraryName, EntryPoint = "manet_sound_create_streaming")]
-    private static partial IntPtr SoundCreateStreamingCore(EngineHandle engine, uint channels, uint sampleRate, uint capacityInFrames, uint flags);
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_create_from_pcm_frames_ref")]
+    private static unsafe partial IntPtr SoundCreateFromPcmFramesRefCore(EngineHandle engine, float* frames, ulong frameCount, uint channels, uint sampleRate, uint flags);
+
+    internal static SoundHandle SoundCreateFromPcmBuffer(EngineHandle engine, PcmBufferHandle buffer, uint flags)
+    {
+        var handle = SoundCreateFromPcmBufferCore(engine, buffer, flags);
+        return SoundHandle.FromIntPtr(handle);
+    }
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_create_from_pcm_buffer")]
+    private static partial IntPtr SoundCreateFromPcmBufferCore(EngineHandle engine, PcmBufferHandle buffer, uint flags);
+
+    internal static unsafe PcmBufferHandle PcmBufferCreate(ReadOnlySpan<float> frames, ulong frameCount, uint channels, uint sampleRate)
+    {
+        fixed (float* pFrames = frames)
+        {
+            var handle = PcmBufferCreateCore(pFrames, frameCount, channels, sampleRate);
+            return PcmBufferHandle.FromIntPtr(handle);
+        }
+    }
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_pcm_buffer_create")]
+    private static unsafe partial IntPtr PcmBufferCreateCore(float* frames, ulong frameCount, uint channels, uint sampleRate);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_pcm_buffer_release")]
+    internal static partial void PcmBufferRelease(IntPtr buffer);
+
+    internal static SoundHandle SoundCreateInstance(SoundHandle source)
+    {
+        var handle = SoundCreateInstanceCore(source);
+        return SoundHandle.FromIntPtr(handle);
+    }
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_create_instance")]
+    private static partial IntPtr SoundCreateInstanceCore(SoundHandle source);
+
+    internal static AssetPackHandle AssetPackOpen(string path)
+    {
+        var handle = OperatingSystem.IsWindows()
+            ? AssetPackOpenWCore(path)
+            : AssetPackOpenCore(path);
+        return AssetPackHandle.FromIntPtr(handle);
+    }
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_asset_pack_open", StringMarshalling = StringMarshalling.Utf8)]
+    private static partial IntPtr AssetPackOpenCore(string path);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_asset_pack_open_w", StringMarshalling = StringMarshalling.Utf16)]
+    private static partial IntPtr AssetPackOpenWCore(string path);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_asset_pack_close")]
+    internal static partial void AssetPackClose(IntPtr pack);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_asset_pack_get_entry_count")]
+    internal static partial uint AssetPackGetEntryCount(AssetPackHandle pack);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_asset_pack_contains", StringMarshalling = StringMarshalling.Utf8)]
+    internal static partial int AssetPackContains(AssetPackHandle pack, string name);
+
+    internal static VoicePoolHandle VoicePoolCreate(EngineHandle engine, uint capacity, uint channels, uint sampleRate, uint flags, VoiceStealPolicy policy)
+    {
+        var handle = VoicePoolCreateCore(engine, capacity, channels, sampleRate, flags, (int)policy);
+        return VoicePoolHandle.FromIntPtr(handle);
+    }
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_voice_pool_create")]
+    private static partial IntPtr VoicePoolCreateCore(EngineHandle engine, uint capacity, uint channels, uint sampleRate, uint flags, int policy);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_voice_pool_destroy")]
+    internal static partial void VoicePoolDestroy(IntPtr pool);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_voice_pool_play")]
+    internal static partial int VoicePoolPlay(VoicePoolHandle pool, PcmBufferHandle clip, float volume, float pan);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_voice_pool_stop_all")]
+    internal static partial int VoicePoolStopAll(VoicePoolHandle pool);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_voice_pool_get_stats")]
+    internal static partial int VoicePoolGetStats(VoicePoolHandle pool, out VoicePoolStats stats);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_voice_pool_attach_output")]
+    internal static partial int VoicePoolAttachOutput(VoicePoolHandle pool, IntPtr target, uint targetInputBus);
+
+    internal static SoundGroupHandle SoundGroupCreate(EngineHandle engine, uint flags, SoundGroupHandle? parent)
+    {
+        var parentPtr = IntPtr.Zero;
+        var parentAddRef = false;
+
+        try
+        {
+            if (parent is not null)
+            {
+                parent.DangerousAddRef(ref parentAddRef);
+                parentPtr = parent.DangerousGetHandle();
+            }
+
+            var handle = SoundGroupCreateCore(engine, flags, parentPtr);
+            return SoundGroupHandle.FromIntPtr(handle);
+        }
+        finally
+        {
+            if (parentAddRef)
+            {
+                parent!.DangerousRelease();
+            }
+        }
+    }
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_group_create")]
+    private static partial IntPtr SoundGroupCreateCore(EngineHandle engine, uint flags, IntPtr parent);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_group_destroy")]
+    internal static partial void SoundGroupDestroy(IntPtr group);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_group_start")]
+    internal static partial int SoundGroupStart(SoundGroupHandle group);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_group_stop")]
+    internal static partial int SoundGroupStop(SoundGroupHandle group);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_group_is_playing")]
+    internal static partial int SoundGroupIsPlaying(SoundGroupHandle group);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_group_set_volume")]
+    internal static partial int SoundGroupSetVolume(SoundGroupHandle group, float volume);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_group_get_volume")]
+    internal static partial float SoundGroupGetVolume(SoundGroupHandle group);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_group_set_pitch")]
+    internal static partial int SoundGroupSetPitch(SoundGroupHandle group, float pitch);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_group_get_pitch")]
+    internal static partial float SoundGroupGetPitch(SoundGroupHandle group);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_group_set_pan")]
+    internal static partial int SoundGroupSetPan(SoundGroupHandle group, float pan);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_group_get_pan")]
+    internal static partial float SoundGroupGetPan(SoundGroupHandle group);
+
+    internal static SplitterHandle SplitterCreate(EngineHandle engine, uint channels, uint outputBusCount)
+    {
+        var handle = SplitterCreateCore(engine, channels, outputBusCount);
+        return SplitterHandle.FromIntPtr(handle);
+    }
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_splitter_create")]
+    private static partial IntPtr SplitterCreateCore(EngineHandle engine, uint channels, uint outputBusCount);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_splitter_destroy")]
+    internal static partial void SplitterDestroy(IntPtr splitter);
+
+    internal static EffectNodeHandle EffectNodeCreateLowPass(EngineHandle engine, uint channels, double cutoffFrequency, uint order)
+    {
+        var handle = EffectNodeCreateLowPassCore(engine, channels, cutoffFrequency, order);
+        return EffectNodeHandle.FromIntPtr(handle);
+    }
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_effect_node_create_low_pass")]
+    private static partial IntPtr EffectNodeCreateLowPassCore(EngineHandle engine, uint channels, double cutoffFrequency, uint order);
+
+    internal static EffectNodeHandle EffectNodeCreateHighPass(EngineHandle engine, uint channels, double cutoffFrequency, uint order)
+    {
+        var handle = EffectNodeCreateHighPassCore(engine, channels, cutoffFrequency, order);
+        return EffectNodeHandle.FromIntPtr(handle);
+    }
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_effect_node_create_high_pass")]
+    private static partial IntPtr EffectNodeCreateHighPassCore(EngineHandle engine, uint channels, double cutoffFrequency, uint order);
+
+    internal static EffectNodeHandle EffectNodeCreateBiquad(EngineHandle engine, uint channels, float b0, float b1, float b2, float a0, float a1, float a2)
+    {
+        var handle = EffectNodeCreateBiquadCore(engine, channels, b0, b1, b2, a0, a1, a2);
+        return EffectNodeHandle.FromIntPtr(handle);
+    }
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_effect_node_create_biquad")]
+    private static partial IntPtr EffectNodeCreateBiquadCore(EngineHandle engine, uint channels, float b0, float b1, float b2, float a0, float a1, float a2);
+
+    internal static EffectNodeHandle EffectNodeCreatePeakingEq(EngineHandle engine, uint channels, double gainDb, double q, double frequency)
+    {
+        var handle = EffectNodeCreatePeakingEqCore(engine, channels, gainDb, q, frequency);
+        return EffectNodeHandle.FromIntPtr(handle);
+    }
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_effect_node_create_peaking_eq")]
+    private static partial IntPtr EffectNodeCreatePeakingEqCore(EngineHandle engine, uint channels, double gainDb, double q, double frequency);
+
+    internal static EffectNodeHandle EffectNodeCreateDelay(EngineHandle engine, uint channels, uint delayInFrames, float decay)
+    {
+        var handle = EffectNodeCreateDelayCore(engine, channels, delayInFrames, decay);
+        return EffectNodeHandle.FromIntPtr(handle);
+    }
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_effect_node_create_delay")]
+    private static partial IntPtr EffectNodeCreateDelayCore(EngineHandle engine, uint channels, uint delayInFrames, float decay);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_effect_node_destroy")]
+    internal static partial void EffectNodeDestroy(IntPtr node);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_effect_node_set_cutoff")]
+    internal static partial int EffectNodeSetCutoff(EffectNodeHandle node, double cutoffFrequency);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_effect_node_set_biquad")]
+    internal static partial int EffectNodeSetBiquad(EffectNodeHandle node, float b0, float b1, float b2, float a0, float a1, float a2);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_effect_node_set_peaking_eq")]
+    internal static partial int EffectNodeSetPeakingEq(EffectNodeHandle node, double gainDb, double q, double frequency);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_effect_node_set_delay_mix")]
+    internal static partial int EffectNodeSetDelayMix(EffectNodeHandle node, float wet, float dry, float decay);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_effect_node_get_delay_mix")]
+    internal static partial int EffectNodeGetDelayMix(EffectNodeHandle node, out float wet, out float dry, out float decay);
+
+    internal static unsafe CustomNodeHandle CustomNodeCreate(EngineHandle engine, uint inputBusCount, uint outputBusCount, uint channels, uint flags, delegate* unmanaged[Cdecl]<CustomNodeProcessContext*, void> process, IntPtr userData)
+    {
+        var handle = CustomNodeCreateCore(engine, inputBusCount, outputBusCount, channels, flags, process, userData);
+        return CustomNodeHandle.FromIntPtr(handle);
+    }
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_custom_node_create")]
+    private static unsafe partial IntPtr CustomNodeCreateCore(EngineHandle engine, uint inputBusCount, uint outputBusCount, uint channels, uint flags, delegate* unmanaged[Cdecl]<CustomNodeProcessContext*, void> process, IntPtr userData);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_custom_node_destroy")]
+    internal static partial void CustomNodeDestroy(IntPtr node);
+
+    internal static DynamicsNodeHandle LimiterCreate(EngineHandle engine, uint channels, float ceilingDb, float releaseMilliseconds, uint lookaheadFrames, uint kernel)
+    {
+        var handle = LimiterCreateCore(engine, channels, ceilingDb, releaseMilliseconds, lookaheadFrames, kernel);
+        return DynamicsNodeHandle.FromIntPtr(handle);
+    }
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_limiter_create")]
+    private static partial IntPtr LimiterCreateCore(EngineHandle engine, uint channels, float ceilingDb, float releaseMilliseconds, uint lookaheadFrames, uint kernel);
+
+    internal static DynamicsNodeHandle CompressorCreate(EngineHandle engine, uint channels, float thresholdDb, float ratio, float attackMilliseconds, float releaseMilliseconds, float makeupDb, uint kernel)
+    {
+        var handle = CompressorCreateCore(engine, channels, thresholdDb, ratio, attackMilliseconds, releaseMilliseconds, makeupDb, kernel);
+        return DynamicsNodeHandle.FromIntPtr(handle);
+    }
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_compressor_create")]
+    private static partial IntPtr CompressorCreateCore(EngineHandle engine, uint channels, float thresholdDb, float ratio, float attackMilliseconds, float releaseMilliseconds, float makeupDb, uint kernel);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_dynamics_node_destroy")]
+    internal static partial void DynamicsNodeDestroy(IntPtr node);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_dynamics_node_set_limiter")]
+    internal static partial int DynamicsNodeSetLimiter(DynamicsNodeHandle node, float ceilingDb, float releaseMilliseconds);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_dynamics_node_set_compressor")]
+    internal static partial int DynamicsNodeSetCompressor(DynamicsNodeHandle node, float thresholdDb, float ratio, float attackMilliseconds, float releaseMilliseconds, float makeupDb);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_dynamics_node_get_kernel")]
+    internal static partial uint DynamicsNodeGetKernel(DynamicsNodeHandle node);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_dynamics_node_read_min_gain")]
+    internal static partial int DynamicsNodeReadMinGain(DynamicsNodeHandle node, out float minGain);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_dynamics_is_kernel_supported")]
+    internal static partial int DynamicsIsKernelSupported(uint kernel);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_engine_get_endpoint_node")]
+    internal static partial IntPtr EngineGetEndpointNode(EngineHandle engine);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_get_node")]
+    internal static partial IntPtr SoundGetNode(SoundHandle sound);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_group_get_node")]
+    internal static partial IntPtr SoundGroupGetNode(SoundGroupHandle group);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_splitter_get_node")]
+    internal static partial IntPtr SplitterGetNode(SplitterHandle splitter);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_effect_node_get_node")]
+    internal static partial IntPtr EffectNodeGetNode(EffectNodeHandle node);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_custom_node_get_node")]
+    internal static partial IntPtr CustomNodeGetNode(CustomNodeHandle node);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_dynamics_node_get_node")]
+    internal static partial IntPtr DynamicsNodeGetNode(DynamicsNodeHandle node);
+
+    // Raw ma_node pointers; callers keep the owning handle referenced for the duration of the call.
+    [LibraryImport(LibraryName, EntryPoint = "manet_node_attach_output_bus")]
+    internal static partial int NodeAttachOutputBus(IntPtr node, uint outputBus, IntPtr target, uint targetInputBus);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_node_detach_output_bus")]
+    internal static partial int NodeDetachOutputBus(IntPtr node, uint outputBus);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_node_detach_all_output_buses")]
+    internal static partial int NodeDetachAllOutputBuses(IntPtr node);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_node_set_output_bus_volume")]
+    internal static partial int NodeSetOutputBusVolume(IntPtr node, uint outputBus, float volume);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_node_get_output_bus_volume")]
+    internal static partial int NodeGetOutputBusVolume(IntPtr node, uint outputBus, out float volume);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_node_get_input_bus_count")]
+    internal static partial uint NodeGetInputBusCount(IntPtr node);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_node_get_output_bus_count")]
+    internal static partial uint NodeGetOutputBusCount(IntPtr node);
+
+    internal static unsafe SoundHandle SoundCreateFromPcmPlanes(EngineHandle engine, ReadOnlySpan<ReadOnlyMemory<float>> planes, ulong frameCount, uint sampleRate, uint flags)
+    {
+        var pins = ArrayPool<MemoryHandle>.Shared.Rent(planes.Length);
+        var pointers = stackalloc float*[planes.Length];
+        try
+        {
+            PinPlanes(planes, pins, pointers);
+            var handle = SoundCreateFromPcmPlanesCore(engine, pointers, frameCount, (uint)planes.Length, sampleRate, flags);
+            return SoundHandle.FromIntPtr(handle);
+        }
+        finally
+        {
+            ReleasePlanes(pins, planes.Length);
+        }
+    }
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_create_from_pcm_planes")]
+    private static unsafe partial IntPtr SoundCreateFromPcmPlanesCore(EngineHandle engine, float** planes, ulong frameCount, uint channels, uint sampleRate, uint flags);
+
+    internal static SoundHandle SoundCreateStreaming(EngineHandle engine, uint channels, uint sampleRate, uint capacityInFrames, uint flags, uint inputFormat)
+    {
+        var handle = SoundCreateStreamingCore(engine, channels, sampleRate, capacityInFrames, flags, inputFormat);
+        return SoundHandle.FromIntPtr(handle);
+    }
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_create_streaming_ex")]
+    private static partial IntPtr SoundCreateStreamingCore(EngineHandle engine, uint channels, uint sampleRate, uint capacityInFrames, uint flags, uint inputFormat);
 
     [LibraryImport(LibraryName, EntryPoint = "manet_sound_destroy")]
     internal static partial void SoundDestroy(IntPtr handle);
@@ -281,6 +764,65 @@ internal static partial class NativeMethods
     [LibraryImport(LibraryName, EntryPoint = "manet_sound_stream_append_pcm_frames")]
     private static unsafe partial int SoundStreamAppendPcmFramesCore(SoundHandle handle, float* frames, ulong frameCount, ulong* framesWritten);
 
+    internal static unsafe int SoundStreamAppendPcmPlanes(SoundHandle handle, ReadOnlySpan<ReadOnlyMemory<float>> planes, ulong frameCount, out ulong framesWritten)
+    {
+        ulong written = 0;
+        var pins = ArrayPool<MemoryHandle>.Shared.Rent(planes.Length);
+        var pointers = stackalloc float*[planes.Length];
+        try
+        {
+            PinPlanes(planes, pins, pointers);
+            var result = SoundStreamAppendPcmPlanesCore(handle, pointers, frameCount, &written);
+            framesWritten = written;
+            return result;
+        }
+        finally
+        {
+            ReleasePlanes(pins, planes.Length);
+        }
+    }
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_stream_append_pcm_planes")]
+    private static unsafe partial int SoundStreamAppendPcmPlanesCore(SoundHandle handle, float** planes, ulong frameCount, ulong* framesWritten);
+
+    internal static unsafe int SoundStreamAppendRawPcmFrames(SoundHandle handle, ReadOnlySpan<byte> frames, ulong frameCount, out ulong framesWritten)
+    {
+        ulong written = 0;
+        fixed (byte* pFrames = frames)
+        {
+            var result = SoundStreamAppendRawPcmFramesCore(handle, pFrames, frameCount, &written);
+            framesWritten = written;
+            return result;
+        }
+    }
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_stream_append_raw_pcm_frames")]
+    private static unsafe partial int SoundStreamAppendRawPcmFramesCore(SoundHandle handle, byte* frames, ulong frameCount, ulong* framesWritten);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_stream_acquire_write")]
+    internal static partial int SoundStreamAcquireWrite(SoundHandle handle, ref uint frameCount, out IntPtr buffer);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_stream_commit_write")]
+    internal static partial int SoundStreamCommitWrite(SoundHandle handle, uint frameCount);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_stream_wait_notifications")]
+    internal static partial int SoundStreamWaitNotifications(SoundHandle handle, out uint notifications);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_stream_close_notifications")]
+    internal static partial int SoundStreamCloseNotifications(SoundHandle handle);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_stream_set_low_watermark")]
+    internal static partial int SoundStreamSetLowWatermark(SoundHandle handle, uint frames);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_stream_request_write_space")]
+    internal static partial int SoundStreamRequestWriteSpace(SoundHandle handle, uint frames);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_stream_get_statistics")]
+    internal static partial int SoundStreamGetStatistics(SoundHandle handle, out SoundStreamStats stats);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_sound_stream_reset_statistics")]
+    internal static partial int SoundStreamResetStatistics(SoundHandle handle);
+
     [LibraryImport(LibraryName, EntryPoint = "manet_sound_stream_get_available_write")]
     internal static partial int SoundStreamGetAvailableWrite(SoundHandle handle, out ulong availableFrames);
 
@@ -399,8 +941,9 @@ internal static partial class NativeMethods
         string? captureDeviceId,
         uint sampleRate,
         uint channels,
-        CaptureDeviceDataCallback callback,
-        IntPtr userData)
+        CaptureDeviceDataCallback? callback,
+        IntPtr userData,
+        uint ringCapacityInFrames)
     {
         var contextPtr = IntPtr.Zero;
         var contextAddRef = false;
@@ -419,7 +962,8 @@ internal static partial class NativeMethods
                 sampleRate,
                 channels,
                 callback,
-                userData);
+                userData,
+                ringCapacityInFrames);
 
             return CaptureDeviceHandle.FromIntPtr(handle);
         }
@@ -432,14 +976,15 @@ internal static partial class NativeMethods
         }
     }
 
-    [LibraryImport(LibraryName, EntryPoint = "manet_capture_device_create", StringMarshalling = StringMarshalling.Utf8)]
+    [LibraryImport(LibraryName, EntryPoint = "manet_capture_device_create_ex", StringMarshalling = StringMarshalling.Utf8)]
     private static partial IntPtr CaptureDeviceCreateCore(
         IntPtr context,
         string? captureDeviceId,
         uint sampleRate,
         uint channels,
-        CaptureDeviceDataCallback callback,
-        IntPtr userData);
+        CaptureDeviceDataCallback? callback,
+        IntPtr userData,
+        uint ringCapacityInFrames);
 
     [LibraryImport(LibraryName, EntryPoint = "manet_capture_device_start")]
     internal static partial int CaptureDeviceStart(CaptureDeviceHandle handle);
@@ -447,11 +992,58 @@ internal static partial class NativeMethods
     [LibraryImport(LibraryName, EntryPoint = "manet_capture_device_stop")]
     internal static partial int CaptureDeviceStop(CaptureDeviceHandle handle);
 
+    internal static unsafe int CaptureDeviceRead(CaptureDeviceHandle handle, Span<float> frames, uint frameCount, out uint framesRead)
+    {
+        uint read = 0;
+        fixed (float* pFrames = frames)
+        {
+            var result = CaptureDeviceReadCore(handle, pFrames, frameCount, &read);
+            framesRead = read;
+            return result;
+        }
+    }
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_capture_device_read")]
+    private static unsafe partial int CaptureDeviceReadCore(CaptureDeviceHandle handle, float* frames, uint frameCount, uint* framesRead);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_capture_device_get_available_read")]
+    internal static partial int CaptureDeviceGetAvailableRead(CaptureDeviceHandle handle, out uint availableFrames);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_capture_device_get_dropped_frames")]
+    internal static partial int CaptureDeviceGetDroppedFrames(CaptureDeviceHandle handle, out ulong droppedFrames);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_capture_device_request_read")]
+    internal static partial int CaptureDeviceRequestRead(CaptureDeviceHandle handle, uint frames);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_capture_device_wait_notifications")]
+    internal static partial int CaptureDeviceWaitNotifications(CaptureDeviceHandle handle, out uint notifications);
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_capture_device_close_notifications")]
+    internal static partial int CaptureDeviceCloseNotifications(CaptureDeviceHandle handle);
+
+    // Only exported by native builds configured with MANET_ENABLE_TEST_HOOKS.
+    internal static unsafe int CaptureDeviceWriteFrames(CaptureDeviceHandle handle, ReadOnlySpan<float> frames, uint frameCount)
+    {
+        fixed (float* pFrames = frames)
+        {
+            return CaptureDeviceWriteFramesCore(handle, pFrames, frameCount);
+        }
+    }
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_capture_device_write_frames")]
+    private static unsafe partial int CaptureDeviceWriteFramesCore(CaptureDeviceHandle handle, float* frames, uint frameCount);
+
     [LibraryImport(LibraryName, EntryPoint = "manet_capture_device_destroy")]
     internal static partial void CaptureDeviceDestroy(IntPtr handle);
 
-    [LibraryImport(LibraryName, EntryPoint = "manet_result_description", StringMarshalling = StringMarshalling.Utf8)]
-    internal static partial string DescribeResult(int result);
+    internal static string? DescribeResult(int result)
+    {
+        // The description points at a static string owned by miniaudio, so it must not be freed by the marshaller.
+        return Marshal.PtrToStringUTF8(DescribeResultCore(result));
+    }
+
+    [LibraryImport(LibraryName, EntryPoint = "manet_result_description")]
+    private static partial IntPtr DescribeResultCore(int result);
 
     [LibraryImport(LibraryName, EntryPoint = "manet_context_get_devices")]
     internal static unsafe partial int ContextGetDevices(
@@ -463,6 +1055,112 @@ internal static partial class NativeMethods
 
     internal const int DeviceNameBufferSize = 256;
     internal const int DeviceIdBufferSize = 513;
+    internal const int MaxChannels = 254;
+    internal const int MaxNodeBusCount = 254;
+    internal const int MaxFilterOrder = 8;
+    internal const int ResultAlreadyExists = -8;
+    internal const int ResultDoesNotExist = -7;
+    internal const int ResultBusy = -19;
+    internal const int ResultIoError = -20;
+    internal const int ResultBadSeek = -25;
+    internal const int JobTypeSlots = 16;
+    internal const int JobHistogramBucketCount = 20;
+
+    private static unsafe void PinPlanes(ReadOnlySpan<ReadOnlyMemory<float>> planes, MemoryHandle[] pins, float** pointers)
+    {
+        for (var i = 0; i < planes.Length; i++)
+        {
+            pins[i] = planes[i].Pin();
+            pointers[i] = (float*)pins[i].Pointer;
+        }
+    }
+
+    private static void ReleasePlanes(MemoryHandle[] pins, int count)
+    {
+        for (var i = 0; i < count; i++)
+        {
+            pins[i].Dispose();
+        }
+
+        Array.Clear(pins, 0, count);
+        ArrayPool<MemoryHandle>.Shared.Return(pins);
+    }
+
+    [Flags]
+    internal enum SoundStreamNotification : uint
+    {
+        LowWatermark = 1,
+        WriteSpace = 2,
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct VoicePoolStats
+    {
+        public uint Capacity;
+        public uint ActiveVoices;
+        public ulong PlayCount;
+        public ulong StealCount;
+        public ulong RejectCount;
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct ResourceManagerStats
+    {
+        public ulong ResidentBytes;
+        public ulong CachedBytes;
+        public ulong BudgetInBytes;
+        public ulong CacheHits;
+        public ulong CacheMisses;
+        public ulong Evictions;
+        public uint LoadedBuffers;
+        public uint CachedBuffers;
+        public uint PendingJobs;
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    internal unsafe struct JobHistogram
+    {
+        public ulong Count;
+        public ulong TotalMicroseconds;
+        public ulong MaxMicroseconds;
+        public fixed ulong Buckets[JobHistogramBucketCount];
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    internal unsafe struct EngineMeterSnapshot
+    {
+        public ulong FramesProcessed;
+        public uint Channels;
+        public float MomentaryPower;
+        public float ShortTermPower;
+        public fixed float Peak[MaxChannels];
+        public fixed float Rms[MaxChannels];
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    internal unsafe struct ResourceManagerJobStats
+    {
+        public fixed ulong Queued[JobTypeSlots];
+        public fixed ulong Completed[JobTypeSlots];
+        public JobHistogram QueueWait;
+        public JobHistogram Processing;
+        public JobHistogram Decode;
+        public ulong StreamRefills;
+        public ulong StreamRefillMisses;
+        public uint PendingJobs;
+        public uint WorkerCount;
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct SoundStreamStats
+    {
+        public ulong UnderrunCount;
+        public ulong SilenceFramesInserted;
+        public ulong FramesRead;
+        public ulong FramesWritten;
+        public ulong MinQueuedFrames;
+        public ulong MaxQueuedFrames;
+    }
 
     [StructLayout(LayoutKind.Sequential)]
     internal struct ResourceManagerConfig
@@ -472,6 +1170,22 @@ internal static partial class NativeMethods
         public uint DecodedChannels;
         public uint DecodedSampleRate;
         public uint JobThreadCount;
+        public IntPtr Vfs;
+        public IntPtr AssetPack;
+        public IntPtr DecodedCacheDirectory;
+        public uint CollectJobStatistics;
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct VfsConfig
+    {
+        public IntPtr OnOpen;
+        public IntPtr OnClose;
+        public IntPtr OnRead;
+        public IntPtr OnSeek;
+        public IntPtr OnTell;
+        public IntPtr OnSize;
+        public IntPtr UserData;
     }
 
     [StructLayout(LayoutKind.Sequential, CharSet = CharSet.Ansi)]
@@ -0,0 +1,73 @@
+using System;
+using System.Threading;
+
+namespace Miniaudio.Net.Interop;
+
+// Owns a background thread that blocks in a native wait, so real-time threads only ever signal a native event.
+// Wait handles and tasks are completed on this thread, never on the audio or capture thread.
+internal sealed class NativeSignalWaiter
+{
+    internal delegate int WaitCallback(out uint bits);
+
+    private readonly WaitCallback _wait;
+    private readonly Action<uint> _dispatch;
+    private readonly Thread _thread;
+
+    private NativeSignalWaiter(string name, WaitCallback wait, Action<uint> dispatch)
+    {
+        _wait = wait;
+        _dispatch = dispatch;
+        _thread = new Thread(Run)
+        {
+            IsBackground = true,
+            Name = name,
+        };
+    }
+
+    // Starts the waiter stored in field unless another caller already has. The thread runs until the native wait
+    // reports the signal closed or the handle it waits on is disposed.
+    internal static void EnsureStarted(ref NativeSignalWaiter? field, string name, WaitCallback wait, Action<uint> dispatch)
+    {
+        if (Volatile.Read(ref field) is not null)
+        {
+            return;
+        }
+
+        var created = new NativeSignalWaiter(name, wait, dispatch);
+        if (Interlocked.CompareExchange(ref field, created, null) is null)
+        {
+            created._thread.Start();
+        }
+    }
+
+    private void Run()
+    {
+        while (true)
+        {
+            int result;
+            uint bits;
+            try
+            {
+                result = _wait(out bits);
+            }
+            catch (ObjectDisposedException)
+            {
+                return;
+            }
+
+            if (result != 0)
+            {
+                return;
+            }
+
+            try
+            {
+                _dispatch(bits);
+            }
+            catch
+            {
+                // Keep the waiter alive; a failing continuation must not stop later notifications.
+            }
+        }
+    }
+}
@@ -107,3 +107,171 @@ internal sealed class CaptureDeviceHandle : SafeHandleZeroOrMinusOneIsInvalid
         return true;
     }
 }
+
+internal sealed class PcmBufferHandle : SafeHandleZeroOrMinusOneIsInvalid
+{
+    private PcmBufferHandle()
+        : base(true)
+    {
+    }
+
+    internal static PcmBufferHandle FromIntPtr(IntPtr handle)
+    {
+        var safeHandle = new PcmBufferHandle();
+        safeHandle.SetHandle(handle);
+        return safeHandle;
+    }
+
+    protected override bool ReleaseHandle()
+    {
+        NativeMethods.PcmBufferRelease(handle);
+        return true;
+    }
+}
+
+internal sealed class VoicePoolHandle : SafeHandleZeroOrMinusOneIsInvalid
+{
+    private VoicePoolHandle()
+        : base(true)
+    {
+    }
+
+    internal static VoicePoolHandle FromIntPtr(IntPtr handle)
+    {
+        var safeHandle = new VoicePoolHandle();
+        safeHandle.SetHandle(handle);
+        return safeHandle;
+    }
+
+    protected override bool ReleaseHandle()
+    {
+        NativeMethods.VoicePoolDestroy(handle);
+        return true;
+    }
+}
+
+internal sealed class AssetPackHandle : SafeHandleZeroOrMinusOneIsInvalid
+{
+    private AssetPackHandle()
+        : base(true)
+    {
+    }
+
+    internal static AssetPackHandle FromIntPtr(IntPtr handle)
+    {
+        var safeHandle = new AssetPackHandle();
+        safeHandle.SetHandle(handle);
+        return safeHandle;
+    }
+
+    protected override bool ReleaseHandle()
+    {
+        NativeMethods.AssetPackClose(handle);
+        return true;
+    }
+}
+
+internal sealed class SoundGroupHandle : SafeHandleZeroOrMinusOneIsInvalid
+{
+    private SoundGroupHandle()
+        : base(true)
+    {
+    }
+
+    internal static SoundGroupHandle FromIntPtr(IntPtr handle)
+    {
+        var safeHandle = new SoundGroupHandle();
+        safeHandle.SetHandle(handle);
+        return safeHandle;
+    }
+
+    protected override bool ReleaseHandle()
+    {
+        NativeMethods.SoundGroupDestroy(handle);
+        return true;
+    }
+}
+
+internal sealed class SplitterHandle : SafeHandleZeroOrMinusOneIsInvalid
+{
+    private SplitterHandle()
+        : base(true)
+    {
+    }
+
+    internal static SplitterHandle FromIntPtr(IntPtr handle)
+    {
+        var safeHandle = new SplitterHandle();
+        safeHandle.SetHandle(handle);
+        return safeHandle;
+    }
+
+    protected override bool ReleaseHandle()
+    {
+        NativeMethods.SplitterDestroy(handle);
+        return true;
+    }
+}
+
+internal sealed class EffectNodeHandle : SafeHandleZeroOrMinusOneIsInvalid
+{
+    private EffectNodeHandle()
+        : base(true)
+    {
+    }
+
+    internal static EffectNodeHandle FromIntPtr(IntPtr handle)
+    {
+        var safeHandle = new EffectNodeHandle();
+        safeHandle.SetHandle(handle);
+        return safeHandle;
+    }
+
+    protected override bool ReleaseHandle()
+    {
+        NativeMethods.EffectNodeDestroy(handle);
+        return true;
+    }
+}
+
+internal sealed class CustomNodeHandle : SafeHandleZeroOrMinusOneIsInvalid
+{
+    private CustomNodeHandle()
+        : base(true)
+    {
+    }
+
+    internal static CustomNodeHandle FromIntPtr(IntPtr handle)
+    {
+        var safeHandle = new CustomNodeHandle();
+        safeHandle.SetHandle(handle);
+        return safeHandle;
+    }
+
+    protected override bool ReleaseHandle()
+    {
+        NativeMethods.CustomNodeDestroy(handle);
+        return true;
+    }
+}
+
+internal sealed class DynamicsNodeHandle : SafeHandleZeroOrMinusOneIsInvalid
+{
+    private DynamicsNodeHandle()
+        : base(true)
+    {
+    }
+
+    internal static DynamicsNodeHandle FromIntPtr(IntPtr handle)
+    {
+        var safeHandle = new DynamicsNodeHandle();
+        safeHandle.SetHandle(handle);
+        return safeHandle;
+    }
+
+    protected override bool ReleaseHandle()
+    {
+        NativeMethods.DynamicsNodeDestroy(handle);
+        return true;
+    }
+}
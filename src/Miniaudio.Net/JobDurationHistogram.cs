@@ -0,0 +1,67 @@
+using System;
+
+namespace Miniaudio.Net;
+
+// Log2 buckets over microseconds: bucket 0 holds durations below 2us, bucket i holds [2^i, 2^(i+1))us and the last
+// bucket also holds everything longer.
+public sealed class JobDurationHistogram
+{
+    public const int BucketCount = 20;
+
+    private readonly ulong[] _buckets;
+
+    internal JobDurationHistogram(ulong count, ulong totalMicroseconds, ulong maxMicroseconds, ulong[] buckets)
+    {
+        Count = count;
+        Total = FromMicroseconds(totalMicroseconds);
+        Maximum = FromMicroseconds(maxMicroseconds);
+        _buckets = buckets;
+    }
+
+    public ulong Count { get; }
+
+    public TimeSpan Total { get; }
+
+    public TimeSpan Maximum { get; }
+
+    public TimeSpan Mean => Count == 0 ? TimeSpan.Zero : TimeSpan.FromTicks(Total.Ticks / (long)Count);
+
+    public ReadOnlySpan<ulong> Buckets => _buckets;
+
+    public static TimeSpan GetBucketLowerBound(int bucket)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegative(bucket);
+        ArgumentOutOfRangeException.ThrowIfGreaterThanOrEqual(bucket, BucketCount);
+        return bucket == 0 ? TimeSpan.Zero : FromMicroseconds(1UL << bucket);
+    }
+
+    // Upper edge of the bucket containing the given fraction of samples, capped at Maximum.
+    public TimeSpan EstimatePercentile(double fraction)
+    {
+        if (double.IsNaN(fraction) || fraction < 0 || fraction > 1)
+        {
+            throw new ArgumentOutOfRangeException(nameof(fraction), "Fraction must be between 0 and 1.");
+        }
+
+        if (Count == 0)
+        {
+            return TimeSpan.Zero;
+        }
+
+        var target = Math.Max(1UL, (ulong)Math.Ceiling(fraction * Count));
+        ulong seen = 0;
+        for (var bucket = 0; bucket < BucketCount - 1; bucket++)
+        {
+            seen += _buckets[bucket];
+            if (seen >= target)
+            {
+                var upper = FromMicroseconds(1UL << (bucket + 1));
+                return upper < Maximum ? upper : Maximum;
+            }
+        }
+
+        return Maximum;
+    }
+
+    private static TimeSpan FromMicroseconds(ulong microseconds) => TimeSpan.FromTicks((long)microseconds * TimeSpan.TicksPerMicrosecond);
+}
@@ -0,0 +1,63 @@
+using System;
+using Miniaudio.Net.Interop;
+
+namespace Miniaudio.Net;
+
+// Engine output levels as of the last completed 100 ms block. Peak and RMS are linear and cover the momentary window.
+public sealed class MeterSnapshot
+{
+    public const double MomentaryWindowSeconds = 0.4;
+    public const double ShortTermWindowSeconds = 3.0;
+
+    private readonly float[] _peak;
+    private readonly float[] _rms;
+
+    private MeterSnapshot(ulong framesProcessed, float momentaryPower, float shortTermPower, float[] peak, float[] rms)
+    {
+        FramesProcessed = framesProcessed;
+        MomentaryLoudness = ToLufs(momentaryPower);
+        ShortTermLoudness = ToLufs(shortTermPower);
+        _peak = peak;
+        _rms = rms;
+    }
+
+    // Output frames metered when the snapshot was published; zero until the first block completes.
+    public ulong FramesProcessed { get; }
+
+    public int Channels => _peak.Length;
+
+    // EBU R128 loudness in LUFS, negative infinity for silence. Windows count as silent before the stream started.
+    public float MomentaryLoudness { get; }
+
+    public float ShortTermLoudness { get; }
+
+    public ReadOnlySpan<float> Peak => _peak;
+
+    public ReadOnlySpan<float> Rms => _rms;
+
+    public float GetPeakDbfs(int channel) => ToDbfs(_peak[channel]);
+
+    public float GetRmsDbfs(int channel) => ToDbfs(_rms[channel]);
+
+    private static float ToLufs(float power) => -0.691f + 10f * MathF.Log10(power);
+
+    private static float ToDbfs(float level) => 20f * MathF.Log10(level);
+
+    internal static unsafe MeterSnapshot FromNative(in NativeMethods.EngineMeterSnapshot snapshot)
+    {
+        var channels = (int)Math.Min(snapshot.Channels, (uint)NativeMethods.MaxChannels);
+        var peak = new float[channels];
+        var rms = new float[channels];
+        fixed (float* source = snapshot.Peak)
+        {
+            new ReadOnlySpan<float>(source, channels).CopyTo(peak);
+        }
+
+        fixed (float* source = snapshot.Rms)
+        {
+            new ReadOnlySpan<float>(source, channels).CopyTo(rms);
+        }
+
+        return new MeterSnapshot(snapshot.FramesProcessed, snapshot.MomentaryPower, snapshot.ShortTermPower, peak, rms);
+    }
+}
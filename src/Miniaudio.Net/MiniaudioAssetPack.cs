@@ -0,0 +1,155 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Text;
+using Miniaudio.Net.Interop;
+
+namespace Miniaudio.Net;
+
+public sealed class MiniaudioAssetPack : IDisposable
+{
+    public const string PathPrefix = "pack://";
+
+    private const int HeaderSize = 16;
+    private const int RecordSize = 24;
+    private const int DataAlignment = 16;
+    private static readonly byte[] s_magic = Encoding.ASCII.GetBytes("MANETPAK");
+
+    private AssetPackHandle? _handle;
+
+    private MiniaudioAssetPack(AssetPackHandle handle, string path)
+    {
+        _handle = handle ?? throw new ArgumentNullException(nameof(handle));
+        Path = path;
+        Count = (int)NativeMethods.AssetPackGetEntryCount(handle);
+    }
+
+    public static MiniaudioAssetPack Open(string path)
+    {
+        ArgumentException.ThrowIfNullOrWhiteSpace(path);
+
+        var handle = NativeMethods.AssetPackOpen(path);
+        if (handle is null || handle.IsInvalid)
+        {
+            throw new InvalidOperationException($"Failed to open asset pack '{path}'. Verify that the file exists and was written by MiniaudioAssetPack.Build.");
+        }
+
+        return new MiniaudioAssetPack(handle, path);
+    }
+
+    // Writes a pack containing each source file under its asset name; sounds load them as "pack://<name>".
+    public static void Build(string packPath, IEnumerable<KeyValuePair<string, string>> sourceFiles)
+    {
+        ArgumentException.ThrowIfNullOrWhiteSpace(packPath);
+        ArgumentNullException.ThrowIfNull(sourceFiles);
+
+        var names = new List<byte[]>();
+        var files = new List<FileInfo>();
+        var seen = new HashSet<string>(StringComparer.Ordinal);
+        foreach (var (name, sourcePath) in sourceFiles)
+        {
+            ArgumentException.ThrowIfNullOrWhiteSpace(name, nameof(sourceFiles));
+            if (!seen.Add(name))
+            {
+                throw new ArgumentException($"Asset name '{name}' appears more than once.", nameof(sourceFiles));
+            }
+
+            var file = new FileInfo(sourcePath);
+            if (!file.Exists)
+            {
+                throw new FileNotFoundException($"Asset source '{sourcePath}' does not exist.", sourcePath);
+            }
+
+            names.Add(Encoding.UTF8.GetBytes(name));
+            files.Add(file);
+        }
+
+        var nameOffset = (long)HeaderSize + (long)RecordSize * names.Count;
+        var dataOffset = nameOffset;
+        foreach (var name in names)
+        {
+            dataOffset += name.Length;
+        }
+
+        var offsets = new long[files.Count];
+        for (var i = 0; i < files.Count; i++)
+        {
+            dataOffset = AlignUp(dataOffset);
+            offsets[i] = dataOffset;
+            dataOffset += files[i].Length;
+        }
+
+        using var stream = File.Create(packPath);
+        using var writer = new BinaryWriter(stream, Encoding.UTF8);
+
+        writer.Write(s_magic);
+        writer.Write(1u);
+        writer.Write((uint)names.Count);
+
+        for (var i = 0; i < names.Count; i++)
+        {
+            writer.Write((ulong)offsets[i]);
+            writer.Write((ulong)files[i].Length);
+            writer.Write((uint)nameOffset);
+            writer.Write((uint)names[i].Length);
+            nameOffset += names[i].Length;
+        }
+
+        foreach (var name in names)
+        {
+            writer.Write(name);
+        }
+
+        for (var i = 0; i < files.Count; i++)
+        {
+            writer.Flush();
+            stream.SetLength(offsets[i]);
+            stream.Position = offsets[i];
+
+            using var source = files[i].OpenRead();
+            source.CopyTo(stream);
+        }
+    }
+
+    public string Path { get; }
+
+    public int Count { get; }
+
+    internal AssetPackHandle DangerousHandle
+    {
+        get
+        {
+            if (_handle is null || _handle.IsClosed)
+            {
+                throw new ObjectDisposedException(nameof(MiniaudioAssetPack));
+            }
+
+            return _handle;
+        }
+    }
+
+    // Accepts names with or without the "pack://" prefix.
+    public bool Contains(string name)
+    {
+        ArgumentNullException.ThrowIfNull(name);
+
+        if (name.StartsWith(PathPrefix, StringComparison.Ordinal))
+        {
+            name = name.Substring(PathPrefix.Length);
+        }
+
+        return NativeMethods.AssetPackContains(DangerousHandle, name) != 0;
+    }
+
+    private static long AlignUp(long offset)
+    {
+        return (offset + DataAlignment - 1) & ~(long)(DataAlignment - 1);
+    }
+
+    public void Dispose()
+    {
+        _handle?.Dispose();
+        _handle = null;
+        GC.SuppressFinalize(this);
+    }
+}
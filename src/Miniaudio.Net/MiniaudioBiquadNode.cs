@@ -0,0 +1,27 @@
+using System;
+using Miniaudio.Net.Interop;
+
+namespace Miniaudio.Net;
+
+// Raw biquad with caller-supplied coefficients. miniaudio normalises by a0, which therefore must not be zero.
+public sealed class MiniaudioBiquadNode : MiniaudioEffectNode
+{
+    internal MiniaudioBiquadNode(MiniaudioEngine engine, EffectNodeHandle handle, uint channels)
+        : base(engine, handle, channels)
+    {
+    }
+
+    public void SetCoefficients(float b0, float b1, float b2, float a0, float a1, float a2)
+    {
+        ValidateCoefficients(a0);
+        NativeMethods.EffectNodeSetBiquad(Handle, b0, b1, b2, a0, a1, a2).EnsureSuccess(nameof(SetCoefficients));
+    }
+
+    internal static void ValidateCoefficients(float a0)
+    {
+        if (a0 == 0 || !float.IsFinite(a0))
+        {
+            throw new ArgumentOutOfRangeException(nameof(a0), "a0 must be a non-zero finite value.");
+        }
+    }
+}
@@ -1,5 +1,7 @@
 using System;
 using System.Runtime.InteropServices;
+using System.Threading;
+using System.Threading.Tasks;
 using Miniaudio.Net.Interop;
 
 namespace Miniaudio.Net;
@@ -10,6 +12,9 @@ public sealed class MiniaudioCaptureDevice : IDisposable
     private readonly MiniaudioContext? _context;
     private readonly MiniaudioCaptureDeviceOptions _options;
     private readonly NativeMethods.CaptureDeviceDataCallback _callback;
+    private int _readAsyncInProgress;
+    private NativeSignalWaiter? _readWaiter;
+    private TaskCompletionSource? _readWaiterSource;
     private GCHandle _selfHandle;
     private bool _selfHandleAllocated;
     private event EventHandler<MiniaudioCaptureDataEventArgs>? _pcmCaptured;
@@ -28,8 +33,9 @@ public sealed class MiniaudioCaptureDevice : IDisposable
             string.IsNullOrWhiteSpace(options.CaptureDeviceId) ? null : options.CaptureDeviceId,
             options.SampleRate,
             options.Channels,
-            _callback,
-            userData);
+            IsPullMode ? null : _callback,
+            userData,
+            options.CaptureBufferCapacityInFrames);
 
         if (handle is null || handle.IsInvalid)
         {
@@ -50,12 +56,95 @@ public sealed class MiniaudioCaptureDevice : IDisposable
 
     public MiniaudioCaptureDeviceOptions Options => _options;
 
+    public bool IsPullMode => _options.CaptureBufferCapacityInFrames > 0;
+
     public event EventHandler<MiniaudioCaptureDataEventArgs>? PcmCaptured
     {
-        add => _pcmCaptured += value;
+        add
+        {
+            ThrowIfPullMode();
+            _pcmCaptured += value;
+        }
         remove => _pcmCaptured -= value;
     }
 
+    // Invoked on the audio thread with the native capture block; the span is only valid for the duration of the call.
+    // Never raised in pull mode, where the device thread only fills the native ring.
+    public event MiniaudioCaptureSamplesHandler? SamplesCaptured;
+
+    public uint AvailableFramesToRead
+    {
+        get
+        {
+            ThrowIfNotPullMode();
+            NativeMethods.CaptureDeviceGetAvailableRead(_handle!, out var frames).EnsureSuccess(nameof(AvailableFramesToRead));
+            return frames;
+        }
+    }
+
+    public ulong DroppedFrames
+    {
+        get
+        {
+            ThrowIfNotPullMode();
+            NativeMethods.CaptureDeviceGetDroppedFrames(_handle!, out var frames).EnsureSuccess(nameof(DroppedFrames));
+            return frames;
+        }
+    }
+
+    public int TryRead(Span<float> destination)
+    {
+        ThrowIfNotPullMode();
+
+        var channels = _options.Channels;
+        if (destination.Length % channels != 0)
+        {
+            throw new ArgumentException("Destination length must be divisible by the number of channels.", nameof(destination));
+        }
+
+        var frameCount = (uint)(destination.Length / channels);
+        if (frameCount == 0)
+        {
+            return 0;
+        }
+
+        NativeMethods.CaptureDeviceRead(_handle!, destination, frameCount, out var framesRead).EnsureSuccess(nameof(TryRead));
+        return (int)framesRead;
+    }
+
+    public async ValueTask<int> ReadAsync(Memory<float> destination, CancellationToken cancellationToken = default)
+    {
+        ThrowIfNotPullMode();
+
+        var channels = _options.Channels;
+        if (destination.Length % channels != 0)
+        {
+            throw new ArgumentException("Destination length must be divisible by the number of channels.", nameof(destination));
+        }
+
+        if (Interlocked.Exchange(ref _readAsyncInProgress, 1) != 0)
+        {
+            throw new InvalidOperationException("Another ReadAsync call is already in progress on this capture device.");
+        }
+
+        try
+        {
+            // Wait for the whole block (bounded by the ring size) so callers get large batches per wakeup.
+            var frameCount = (uint)(destination.Length / channels);
+            var threshold = Math.Min(frameCount, _options.CaptureBufferCapacityInFrames);
+            while (threshold > 0 && AvailableFramesToRead < threshold)
+            {
+                await WaitForCapturedFramesAsync(threshold, cancellationToken).ConfigureAwait(false);
+            }
+
+            return TryRead(destination.Span);
+        }
+        finally
+        {
+            Volatile.Write(ref _readAsyncInProgress, 0);
+        }
+    }
+
     public void Start()
     {
         ThrowIfDisposed();
@@ -76,23 +165,92 @@ public sealed class MiniaudioCaptureDevice : IDisposable
         }
     }
 
+    private void ThrowIfPullMode()
+    {
+        if (IsPullMode)
+        {
+            throw new InvalidOperationException("PcmCaptured is unavailable when CaptureBufferCapacityInFrames is set; use TryRead or ReadAsync instead.");
+        }
+    }
+
+    private void ThrowIfNotPullMode()
+    {
+        ThrowIfDisposed();
+        if (!IsPullMode)
+        {
+            throw new InvalidOperationException("CaptureBufferCapacityInFrames must be set to read captured frames.");
+        }
+    }
+
+    // The device thread only raises a native signal once the requested frames are in the ring; the waiter thread
+    // completes the task, so nothing managed ever runs on the device thread.
+    private async Task WaitForCapturedFramesAsync(uint frames, CancellationToken cancellationToken)
+    {
+        var handle = _handle!;
+        NativeSignalWaiter.EnsureStarted(
+            ref _readWaiter,
+            "Miniaudio capture notifications",
+            (out uint bits) => NativeMethods.CaptureDeviceWaitNotifications(handle, out bits),
+            _ => Interlocked.Exchange(ref _readWaiterSource, null)?.TrySetResult());
+
+        var waiter = new TaskCompletionSource(TaskCreationOptions.RunContinuationsAsynchronously);
+        Volatile.Write(ref _readWaiterSource, waiter);
+        NativeMethods.CaptureDeviceRequestRead(handle, frames).EnsureSuccess(nameof(ReadAsync));
+
+        try
+        {
+            await waiter.Task.WaitAsync(cancellationToken).ConfigureAwait(false);
+        }
+        catch (OperationCanceledException)
+        {
+            if (Interlocked.CompareExchange(ref _readWaiterSource, null, waiter) == waiter)
+            {
+                NativeMethods.CaptureDeviceRequestRead(handle, 0).EnsureSuccess(nameof(ReadAsync));
+            }
+
+            throw;
+        }
+    }
+
+    // Runs frames through the device-thread path while the device is stopped. Requires a native build with
+    // MANET_ENABLE_TEST_HOOKS; other builds throw EntryPointNotFoundException.
+    internal void WriteCapturedFrames(ReadOnlySpan<float> interleavedFrames)
+    {
+        ThrowIfDisposed();
+        var frameCount = (uint)(interleavedFrames.Length / _options.Channels);
+        NativeMethods.CaptureDeviceWriteFrames(_handle!, interleavedFrames, frameCount).EnsureSuccess(nameof(WriteCapturedFrames));
+    }
+
     private unsafe void OnNativeData(IntPtr samples, uint frameCount, uint channelCount, IntPtr userData)
     {
+        var spanHandlers = SamplesCaptured;
         var handlers = _pcmCaptured;
-        if (handlers is null || samples == IntPtr.Zero || channelCount == 0)
+        if ((spanHandlers is null && handlers is null) || samples == IntPtr.Zero || channelCount == 0)
         {
             return;
         }
 
         var sampleCount = checked((int)(frameCount * channelCount));
-        var buffer = new float[sampleCount];
-        var source = (float*)samples.ToPointer();
-        for (var i = 0; i < sampleCount; i++)
+        var source = new ReadOnlySpan<float>(samples.ToPointer(), sampleCount);
+
+        if (spanHandlers is not null)
         {
-            buffer[i] = source[i];
+            try
+            {
+                spanHandlers.Invoke(source, channelCount);
+            }
+            catch
+            {
+                // Swallow exceptions to avoid terminating the audio thread.
+            }
         }
 
-        var args = new MiniaudioCaptureDataEventArgs(buffer, channelCount);
+        if (handlers is null)
+        {
+            return;
+        }
+
+        var args = new MiniaudioCaptureDataEventArgs(source.ToArray(), channelCount);
         try
         {
             handlers.Invoke(this, args);
@@ -110,8 +268,15 @@ public sealed class MiniaudioCaptureDevice : IDisposable
             return;
         }
 
+        // Wakes the waiter thread for good; its pending native wait holds the handle until it returns.
+        if (Volatile.Read(ref _readWaiter) is not null)
+        {
+            NativeMethods.CaptureDeviceCloseNotifications(_handle).EnsureSuccess(nameof(Dispose));
+        }
+
         _handle.Dispose();
         _handle = null;
+        Interlocked.Exchange(ref _readWaiterSource, null)?.TrySetException(new ObjectDisposedException(nameof(MiniaudioCaptureDevice)));
 
         if (_selfHandleAllocated)
         {
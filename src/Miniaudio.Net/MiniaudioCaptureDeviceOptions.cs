@@ -12,6 +12,8 @@ public sealed class MiniaudioCaptureDeviceOptions
 
     public uint Channels { get; init; } = 1;
 
+    public uint CaptureBufferCapacityInFrames { get; init; }
+
     internal void Validate()
     {
         if (SampleRate == 0)
@@ -33,6 +35,7 @@ public sealed class MiniaudioCaptureDeviceOptions
             CaptureDeviceId = CaptureDeviceId,
             SampleRate = SampleRate,
             Channels = Channels,
+            CaptureBufferCapacityInFrames = CaptureBufferCapacityInFrames,
         };
     }
 }
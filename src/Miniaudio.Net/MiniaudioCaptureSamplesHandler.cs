@@ -0,0 +1,5 @@
+using System;
+
+namespace Miniaudio.Net;
+
+public delegate void MiniaudioCaptureSamplesHandler(ReadOnlySpan<float> samples, uint channelCount);
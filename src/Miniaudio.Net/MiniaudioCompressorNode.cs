@@ -0,0 +1,79 @@
+using System;
+using Miniaudio.Net.Interop;
+
+namespace Miniaudio.Net;
+
+// Hard-knee RMS compressor. The mean-square level follows the attack/release times, and above the threshold the
+// output level rises by 1/Ratio dB per input dB before the makeup gain is applied.
+public sealed class MiniaudioCompressorNode : MiniaudioDynamicsNode
+{
+    private float _thresholdDb;
+    private float _ratio;
+    private float _attackMilliseconds;
+    private float _releaseMilliseconds;
+    private float _makeupGainDb;
+
+    internal MiniaudioCompressorNode(MiniaudioEngine engine, DynamicsNodeHandle handle, uint channels, float thresholdDb, float ratio, float attackMilliseconds, float releaseMilliseconds, float makeupGainDb)
+        : base(engine, handle, channels)
+    {
+        _thresholdDb = thresholdDb;
+        _ratio = ratio;
+        _attackMilliseconds = attackMilliseconds;
+        _releaseMilliseconds = releaseMilliseconds;
+        _makeupGainDb = makeupGainDb;
+    }
+
+    public float ThresholdDb
+    {
+        get => _thresholdDb;
+        set => SetParameters(value, _ratio, _attackMilliseconds, _releaseMilliseconds, _makeupGainDb);
+    }
+
+    public float Ratio
+    {
+        get => _ratio;
+        set => SetParameters(_thresholdDb, value, _attackMilliseconds, _releaseMilliseconds, _makeupGainDb);
+    }
+
+    public float AttackMilliseconds
+    {
+        get => _attackMilliseconds;
+        set => SetParameters(_thresholdDb, _ratio, value, _releaseMilliseconds, _makeupGainDb);
+    }
+
+    public float ReleaseMilliseconds
+    {
+        get => _releaseMilliseconds;
+        set => SetParameters(_thresholdDb, _ratio, _attackMilliseconds, value, _makeupGainDb);
+    }
+
+    public float MakeupGainDb
+    {
+        get => _makeupGainDb;
+        set => SetParameters(_thresholdDb, _ratio, _attackMilliseconds, _releaseMilliseconds, value);
+    }
+
+    public void SetParameters(float thresholdDb, float ratio, float attackMilliseconds, float releaseMilliseconds, float makeupGainDb)
+    {
+        ValidateParameters(thresholdDb, ratio, attackMilliseconds, releaseMilliseconds, makeupGainDb);
+        NativeMethods.DynamicsNodeSetCompressor(Handle, thresholdDb, ratio, attackMilliseconds, releaseMilliseconds, makeupGainDb).EnsureSuccess(nameof(SetParameters));
+        _thresholdDb = thresholdDb;
+        _ratio = ratio;
+        _attackMilliseconds = attackMilliseconds;
+        _releaseMilliseconds = releaseMilliseconds;
+        _makeupGainDb = makeupGainDb;
+    }
+
+    internal static void ValidateParameters(float thresholdDb, float ratio, float attackMilliseconds, float releaseMilliseconds, float makeupGainDb)
+    {
+        ValidateDecibels(thresholdDb, MinLevelDb, MaxLevelDb, nameof(thresholdDb));
+        ValidateDecibels(makeupGainDb, -MaxMakeupGainDb, MaxMakeupGainDb, nameof(makeupGainDb));
+        if (!(ratio >= 1))
+        {
+            throw new ArgumentOutOfRangeException(nameof(ratio), "Ratio must be at least 1.");
+        }
+
+        ValidateTime(attackMilliseconds, nameof(attackMilliseconds));
+        ValidateTime(releaseMilliseconds, nameof(releaseMilliseconds));
+    }
+}
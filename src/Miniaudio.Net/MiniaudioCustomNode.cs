@@ -0,0 +1,52 @@
+using System;
+using System.Runtime.InteropServices;
+using Miniaudio.Net.Interop;
+
+namespace Miniaudio.Net;
+
+// A graph node processed by an [UnmanagedCallersOnly] function on the audio thread. The function must not block,
+// allocate or throw; exceptions cannot cross back into native code. Disposing waits until the audio thread has left
+// the node, after which the function is never called again and UserData may be released.
+public sealed class MiniaudioCustomNode : MiniaudioNode, IDisposable
+{
+    private CustomNodeHandle? _handle;
+
+    internal MiniaudioCustomNode(MiniaudioEngine engine, CustomNodeHandle handle, uint channels, IntPtr userData)
+        : base(engine)
+    {
+        _handle = handle ?? throw new ArgumentNullException(nameof(handle));
+        Channels = channels;
+        UserData = userData;
+    }
+
+    public uint Channels { get; }
+
+    public IntPtr UserData { get; }
+
+    public void Dispose()
+    {
+        if (_handle is null)
+        {
+            return;
+        }
+
+        _handle.Dispose();
+        _handle = null;
+        GC.SuppressFinalize(this);
+    }
+
+    private protected override SafeHandle NodeOwner
+    {
+        get
+        {
+            if (_handle is null || _handle.IsClosed)
+            {
+                throw new ObjectDisposedException(nameof(MiniaudioCustomNode));
+            }
+
+            return _handle;
+        }
+    }
+
+    private protected override IntPtr GetNativeNode() => NativeMethods.CustomNodeGetNode(_handle!);
+}
@@ -0,0 +1,63 @@
+using System;
+using Miniaudio.Net.Interop;
+
+namespace Miniaudio.Net;
+
+// Feedback delay line. Dry scales the input written into the line, Wet scales what is read back DelayInFrames later and
+// Decay feeds that back in. There is no direct path; use a splitter to mix the unprocessed signal alongside it.
+public sealed class MiniaudioDelayNode : MiniaudioEffectNode
+{
+    internal MiniaudioDelayNode(MiniaudioEngine engine, EffectNodeHandle handle, uint channels, uint delayInFrames)
+        : base(engine, handle, channels)
+    {
+        DelayInFrames = delayInFrames;
+    }
+
+    public uint DelayInFrames { get; }
+
+    public float Wet
+    {
+        get => GetMix().Wet;
+        set
+        {
+            var mix = GetMix();
+            SetMix(value, mix.Dry, mix.Decay);
+        }
+    }
+
+    public float Dry
+    {
+        get => GetMix().Dry;
+        set
+        {
+            var mix = GetMix();
+            SetMix(mix.Wet, value, mix.Decay);
+        }
+    }
+
+    public float Decay
+    {
+        get => GetMix().Decay;
+        set
+        {
+            var mix = GetMix();
+            SetMix(mix.Wet, mix.Dry, value);
+        }
+    }
+
+    public void SetMix(float wet, float dry, float decay)
+    {
+        if (decay < 0 || decay >= 1)
+        {
+            throw new ArgumentOutOfRangeException(nameof(decay), "Decay must be in the range [0, 1).");
+        }
+
+        NativeMethods.EffectNodeSetDelayMix(Handle, wet, dry, decay).EnsureSuccess(nameof(SetMix));
+    }
+
+    private (float Wet, float Dry, float Decay) GetMix()
+    {
+        NativeMethods.EffectNodeGetDelayMix(Handle, out var wet, out var dry, out var decay).EnsureSuccess(nameof(GetMix));
+        return (wet, dry, decay);
+    }
+}
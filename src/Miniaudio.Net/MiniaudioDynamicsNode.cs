@@ -0,0 +1,86 @@
+using System;
+using System.Runtime.InteropServices;
+using Miniaudio.Net.Interop;
+
+namespace Miniaudio.Net;
+
+// Base for the native limiter and compressor. Both process every frame on the audio thread with SIMD kernels and
+// keep running while their input is silent so envelopes release and the lookahead delay drains.
+public abstract class MiniaudioDynamicsNode : MiniaudioNode, IDisposable
+{
+    // Matches the native ranges; beyond them the linear levels underflow or overflow float.
+    public const float MinLevelDb = -96f;
+    public const float MaxLevelDb = 0f;
+    public const float MaxMakeupGainDb = 48f;
+
+    private DynamicsNodeHandle? _handle;
+
+    private protected MiniaudioDynamicsNode(MiniaudioEngine engine, DynamicsNodeHandle handle, uint channels)
+        : base(engine)
+    {
+        _handle = handle ?? throw new ArgumentNullException(nameof(handle));
+        Channels = channels;
+        Kernel = (DynamicsKernel)NativeMethods.DynamicsNodeGetKernel(handle);
+    }
+
+    public uint Channels { get; }
+
+    public DynamicsKernel Kernel { get; }
+
+    private protected DynamicsNodeHandle Handle
+    {
+        get
+        {
+            if (_handle is null || _handle.IsClosed)
+            {
+                throw new ObjectDisposedException(GetType().Name);
+            }
+
+            return _handle;
+        }
+    }
+
+    public static bool IsKernelSupported(DynamicsKernel kernel)
+    {
+        return NativeMethods.DynamicsIsKernelSupported((uint)kernel) != 0;
+    }
+
+    // Largest gain reduction in dB (0 or positive) applied since the previous call.
+    public float ReadMaxGainReductionDb()
+    {
+        NativeMethods.DynamicsNodeReadMinGain(Handle, out var minGain).EnsureSuccess(nameof(ReadMaxGainReductionDb));
+        return minGain >= 1f ? 0f : -20f * MathF.Log10(minGain);
+    }
+
+    public void Dispose()
+    {
+        if (_handle is null)
+        {
+            return;
+        }
+
+        _handle.Dispose();
+        _handle = null;
+        GC.SuppressFinalize(this);
+    }
+
+    private protected override SafeHandle NodeOwner => Handle;
+
+    private protected override IntPtr GetNativeNode() => NativeMethods.DynamicsNodeGetNode(_handle!);
+
+    private protected static void ValidateTime(float milliseconds, string paramName)
+    {
+        if (!float.IsFinite(milliseconds) || milliseconds < 0)
+        {
+            throw new ArgumentOutOfRangeException(paramName, "Time must be a non-negative finite value.");
+        }
+    }
+
+    private protected static void ValidateDecibels(float decibels, float minDecibels, float maxDecibels, string paramName)
+    {
+        if (!(decibels >= minDecibels && decibels <= maxDecibels))
+        {
+            throw new ArgumentOutOfRangeException(paramName, decibels, $"Level must be between {minDecibels} and {maxDecibels} dB.");
+        }
+    }
+}
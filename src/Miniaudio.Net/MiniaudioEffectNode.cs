@@ -0,0 +1,62 @@
+using System;
+using System.Runtime.InteropServices;
+using Miniaudio.Net.Interop;
+
+namespace Miniaudio.Net;
+
+// Base for miniaudio's built-in effect nodes. Each has one input and one output bus and starts attached to nothing,
+// so route a sound or group into it and attach its output where the processed signal should go.
+public abstract class MiniaudioEffectNode : MiniaudioNode, IDisposable
+{
+    private EffectNodeHandle? _handle;
+
+    private protected MiniaudioEffectNode(MiniaudioEngine engine, EffectNodeHandle handle, uint channels)
+        : base(engine)
+    {
+        _handle = handle ?? throw new ArgumentNullException(nameof(handle));
+        Channels = channels;
+        SampleRate = engine.SampleRate;
+    }
+
+    public uint Channels { get; }
+
+    // Engine sample rate captured at creation; filter frequencies must stay below half of it.
+    private protected uint SampleRate { get; }
+
+    private protected EffectNodeHandle Handle
+    {
+        get
+        {
+            if (_handle is null || _handle.IsClosed)
+            {
+                throw new ObjectDisposedException(GetType().Name);
+            }
+
+            return _handle;
+        }
+    }
+
+    public void Dispose()
+    {
+        if (_handle is null)
+        {
+            return;
+        }
+
+        _handle.Dispose();
+        _handle = null;
+        GC.SuppressFinalize(this);
+    }
+
+    private protected override SafeHandle NodeOwner => Handle;
+
+    private protected override IntPtr GetNativeNode() => NativeMethods.EffectNodeGetNode(_handle!);
+
+    internal static void ValidateFrequency(double frequency, uint sampleRate, string paramName)
+    {
+        if (!double.IsFinite(frequency) || frequency <= 0 || frequency >= sampleRate / 2.0)
+        {
+            throw new ArgumentOutOfRangeException(paramName, $"Frequency must be a finite value greater than 0 and below the Nyquist frequency ({sampleRate / 2.0} Hz).");
+        }
+    }
+}
@@ -1,20 +1,30 @@
 using System;
+using System.Collections.Generic;
 using System.Numerics;
+using System.Runtime.InteropServices;
+using System.Threading;
+using System.Threading.Tasks;
 using Miniaudio.Net.Interop;
 
 namespace Miniaudio.Net;
 
 public sealed class MiniaudioEngine : IDisposable
 {
+    // Shared by every async load; the per-load state travels through the GCHandle passed as user data.
+    private static readonly NativeMethods.SoundLoadCallback s_soundLoadedCallback = HandleSoundLoaded;
+
     private EngineHandle? _handle;
     private readonly MiniaudioContext? _context;
     private readonly MiniaudioResourceManager? _resourceManager;
+    private readonly bool _meteringEnabled;
+    private EndpointNode? _endpoint;
 
-    private MiniaudioEngine(EngineHandle handle, MiniaudioContext? context = null, MiniaudioResourceManager? resourceManager = null)
+    private MiniaudioEngine(EngineHandle handle, MiniaudioContext? context = null, MiniaudioResourceManager? resourceManager = null, bool meteringEnabled = false)
     {
         _handle = handle ?? throw new ArgumentNullException(nameof(handle));
         _context = context;
         _resourceManager = resourceManager;
+        _meteringEnabled = meteringEnabled;
     }
 
     public static MiniaudioEngine Create()
@@ -42,14 +52,15 @@ public sealed class MiniaudioEngine : IDisposable
             options.PeriodSizeInFrames ?? 0,
             options.PeriodSizeInMilliseconds ?? 0,
             options.NoAutoStart,
-            options.NoDevice);
+            options.NoDevice,
+            options.EnableMetering);
 
         if (handle is null || handle.IsInvalid)
         {
             throw new InvalidOperationException("Failed to initialize miniaudio engine with the provided options. Confirm that the native miniaudionet library is built and discoverable.");
         }
 
-        return new MiniaudioEngine(handle, options.Context, options.ResourceManager);
+        return new MiniaudioEngine(handle, options.Context, options.ResourceManager, options.EnableMetering);
     }
 
     public float Volume
@@ -187,6 +198,145 @@ public sealed class MiniaudioEngine : IDisposable
         return new MiniaudioSound(this, soundHandle, filePath);
     }
 
+    public MiniaudioSound CreateSound(ReadOnlySpan<byte> encodedData, string name, SoundInitFlags flags = SoundInitFlags.None)
+    {
+        ThrowIfDisposed();
+        ArgumentException.ThrowIfNullOrWhiteSpace(name);
+
+        if ((flags & SoundInitFlags.Stream) != 0)
+        {
+            throw new ArgumentException("In-memory assets cannot be opened with SoundInitFlags.Stream.", nameof(flags));
+        }
+
+        // Identical bytes under the same name share the existing registration; different bytes are a caller error.
+        var result = NativeMethods.EngineRegisterSharedEncodedData(_handle!, name, encodedData);
+        if (result == NativeMethods.ResultAlreadyExists)
+        {
+            throw new ArgumentException($"'{name}' is already registered with different data.", nameof(name));
+        }
+
+        result.EnsureSuccess(nameof(CreateSound));
+
+        var soundHandle = NativeMethods.SoundCreateFromRegisteredData(_handle!, name, (uint)flags);
+        if (soundHandle is null || soundHandle.IsInvalid)
+        {
+            throw new InvalidOperationException($"Failed to create sound from in-memory asset '{name}'. Verify that the data is a supported encoded format.");
+        }
+
+        return new MiniaudioSound(this, soundHandle, name);
+    }
+
+    // Completes once the resource manager has finished decoding (or, with SoundInitFlags.Stream, has the first pages ready).
+    public Task<MiniaudioSound> CreateSoundAsync(string filePath, SoundInitFlags flags = SoundInitFlags.None, CancellationToken cancellationToken = default)
+    {
+        ThrowIfDisposed();
+        ArgumentException.ThrowIfNullOrWhiteSpace(filePath);
+        cancellationToken.ThrowIfCancellationRequested();
+
+        var completion = new TaskCompletionSource<int>(TaskCreationOptions.RunContinuationsAsynchronously);
+        var completionHandle = GCHandle.Alloc(completion);
+        var asyncFlags = (uint)(flags | SoundInitFlags.Async);
+
+        SoundHandle soundHandle;
+        try
+        {
+            soundHandle = NativeMethods.SoundCreateFromFileAsync(_handle!, filePath, asyncFlags, s_soundLoadedCallback, GCHandle.ToIntPtr(completionHandle));
+        }
+        catch
+        {
+            completionHandle.Free();
+            throw;
+        }
+
+        // The native side only reports completion for sounds it managed to create.
+        if (soundHandle is null || soundHandle.IsInvalid)
+        {
+            completionHandle.Free();
+            throw new InvalidOperationException($"Failed to create sound for '{filePath}'. Verify that the file exists and the native library was compiled with decoder support.");
+        }
+
+        var sound = new MiniaudioSound(this, soundHandle, filePath);
+        return CompleteSoundLoadAsync(sound, completion.Task, cancellationToken);
+    }
+
+    public async Task<IReadOnlyList<MiniaudioSound>> PreloadAsync(IEnumerable<string> filePaths, SoundInitFlags flags = SoundInitFlags.Decode, CancellationToken cancellationToken = default)
+    {
+        ThrowIfDisposed();
+        ArgumentNullException.ThrowIfNull(filePaths);
+
+        var loads = new List<Task<MiniaudioSound>>();
+        try
+        {
+            foreach (var filePath in filePaths)
+            {
+                loads.Add(CreateSoundAsync(filePath, flags, cancellationToken));
+            }
+
+            return await Task.WhenAll(loads).ConfigureAwait(false);
+        }
+        catch
+        {
+            // All-or-nothing: release whatever did load before surfacing the first failure.
+            foreach (var load in loads)
+            {
+                try
+                {
+                    (await load.ConfigureAwait(false)).Dispose();
+                }
+                catch
+                {
+                }
+            }
+
+            throw;
+        }
+    }
+
+    public void RegisterEncodedData(string name, ReadOnlySpan<byte> encodedData)
+    {
+        ThrowIfDisposed();
+        ArgumentException.ThrowIfNullOrWhiteSpace(name);
+
+        if (encodedData.IsEmpty)
+        {
+            throw new ArgumentException("Encoded data cannot be empty.", nameof(encodedData));
+        }
+
+        NativeMethods.EngineRegisterEncodedData(_handle!, name, encodedData).EnsureSuccess(nameof(RegisterEncodedData));
+    }
+
+    public void RegisterDecodedData(string name, ReadOnlySpan<float> interleavedFrames, uint channels, uint sampleRate)
+    {
+        ThrowIfDisposed();
+        ArgumentException.ThrowIfNullOrWhiteSpace(name);
+        MiniaudioResourceManager.ValidateDecodedData(interleavedFrames, channels, sampleRate);
+
+        var frameCount = (ulong)(interleavedFrames.Length / channels);
+        NativeMethods.EngineRegisterDecodedData(_handle!, name, interleavedFrames, frameCount, channels, sampleRate).EnsureSuccess(nameof(RegisterDecodedData));
+    }
+
+    public bool UnregisterData(string name)
+    {
+        ThrowIfDisposed();
+        ArgumentNullException.ThrowIfNull(name);
+
+        var result = NativeMethods.EngineUnregisterData(_handle!, name);
+        if (result == NativeMethods.ResultDoesNotExist)
+        {
+            return false;
+        }
+
+        result.EnsureSuccess(nameof(UnregisterData));
+        return true;
+    }
+
+    public bool IsDataRegistered(string name)
+    {
+        ThrowIfDisposed();
+        ArgumentNullException.ThrowIfNull(name);
+        return NativeMethods.EngineIsDataRegistered(_handle!, name) != 0;
+    }
+
     public MiniaudioSound CreateSoundFromPcmFrames(ReadOnlySpan<float> interleavedFrames, uint channels, uint sampleRate, SoundInitFlags flags = SoundInitFlags.None)
     {
         ThrowIfDisposed();
@@ -221,7 +371,334 @@ public sealed class MiniaudioEngine : IDisposable
         return new MiniaudioSound(this, soundHandle, "pcm:memory");
     }
 
+    public MiniaudioSound CreateSoundFromPcmBuffer(MiniaudioPcmBuffer buffer, SoundInitFlags flags = SoundInitFlags.None)
+    {
+        ThrowIfDisposed();
+        ArgumentNullException.ThrowIfNull(buffer);
+
+        var soundHandle = NativeMethods.SoundCreateFromPcmBuffer(_handle!, buffer.DangerousHandle, (uint)flags);
+        if (soundHandle is null || soundHandle.IsInvalid)
+        {
+            throw new InvalidOperationException("Failed to create sound from PCM buffer. Confirm that the native miniaudionet library is up to date.");
+        }
+
+        return new MiniaudioSound(this, soundHandle, "pcm:shared");
+    }
+
+    // Final node of the graph; sounds and groups are attached here unless routed elsewhere.
+    public MiniaudioNode Endpoint
+    {
+        get
+        {
+            ThrowIfDisposed();
+            return _endpoint ??= new EndpointNode(this);
+        }
+    }
+
+    public MiniaudioSoundGroup CreateSoundGroup(MiniaudioSoundGroup? parent = null, SoundInitFlags flags = SoundInitFlags.None)
+    {
+        ThrowIfDisposed();
+
+        if (parent is not null && !ReferenceEquals(parent.Engine, this))
+        {
+            throw new ArgumentException("The parent group belongs to a different engine.", nameof(parent));
+        }
+
+        var groupHandle = NativeMethods.SoundGroupCreate(_handle!, (uint)flags, parent?.DangerousHandle);
+        if (groupHandle is null || groupHandle.IsInvalid)
+        {
+            throw new InvalidOperationException("Failed to create sound group. Confirm that the native miniaudionet library is up to date.");
+        }
+
+        return new MiniaudioSoundGroup(this, groupHandle, parent);
+    }
+
+    public MiniaudioSplitterNode CreateSplitter(uint outputBusCount = 2, uint? channels = null)
+    {
+        ThrowIfDisposed();
+
+        if (outputBusCount == 0 || outputBusCount > NativeMethods.MaxNodeBusCount)
+        {
+            throw new ArgumentOutOfRangeException(nameof(outputBusCount), $"Output bus count must be between 1 and {NativeMethods.MaxNodeBusCount}.");
+        }
+
+        var channelCount = channels ?? Channels;
+        if (channelCount == 0 || channelCount > NativeMethods.MaxChannels)
+        {
+            throw new ArgumentOutOfRangeException(nameof(channels), $"Channel count must be between 1 and {NativeMethods.MaxChannels}.");
+        }
+
+        var splitterHandle = NativeMethods.SplitterCreate(_handle!, channelCount, outputBusCount);
+        if (splitterHandle is null || splitterHandle.IsInvalid)
+        {
+            throw new InvalidOperationException("Failed to create splitter node. Confirm that the native miniaudionet library is up to date.");
+        }
+
+        return new MiniaudioSplitterNode(this, splitterHandle, channelCount);
+    }
+
+    public MiniaudioLowPassFilterNode CreateLowPassFilter(double cutoffFrequency, uint order = 2, uint? channels = null)
+    {
+        ThrowIfDisposed();
+        ValidateFilter(cutoffFrequency, order);
+        var channelCount = ResolveNodeChannels(channels);
+
+        var nodeHandle = NativeMethods.EffectNodeCreateLowPass(_handle!, channelCount, cutoffFrequency, order);
+        EnsureNodeCreated(nodeHandle, "low-pass filter");
+        return new MiniaudioLowPassFilterNode(this, nodeHandle, channelCount, cutoffFrequency, order);
+    }
+
+    public MiniaudioHighPassFilterNode CreateHighPassFilter(double cutoffFrequency, uint order = 2, uint? channels = null)
+    {
+        ThrowIfDisposed();
+        ValidateFilter(cutoffFrequency, order);
+        var channelCount = ResolveNodeChannels(channels);
+
+        var nodeHandle = NativeMethods.EffectNodeCreateHighPass(_handle!, channelCount, cutoffFrequency, order);
+        EnsureNodeCreated(nodeHandle, "high-pass filter");
+        return new MiniaudioHighPassFilterNode(this, nodeHandle, channelCount, cutoffFrequency, order);
+    }
+
+    public MiniaudioPeakingEqNode CreatePeakingEq(double frequency, double gainDb, double q = 0.707, uint? channels = null)
+    {
+        ThrowIfDisposed();
+        MiniaudioEffectNode.ValidateFrequency(frequency, SampleRate, nameof(frequency));
+        if (!double.IsFinite(gainDb))
+        {
+            throw new ArgumentOutOfRangeException(nameof(gainDb), "Gain must be a finite value.");
+        }
+
+        if (!double.IsFinite(q) || q <= 0)
+        {
+            throw new ArgumentOutOfRangeException(nameof(q), "Q must be a positive finite value.");
+        }
+
+        var channelCount = ResolveNodeChannels(channels);
+        var nodeHandle = NativeMethods.EffectNodeCreatePeakingEq(_handle!, channelCount, gainDb, q, frequency);
+        EnsureNodeCreated(nodeHandle, "peaking EQ");
+        return new MiniaudioPeakingEqNode(this, nodeHandle, channelCount, frequency, gainDb, q);
+    }
+
+    public MiniaudioBiquadNode CreateBiquad(float b0, float b1, float b2, float a0, float a1, float a2, uint? channels = null)
+    {
+        ThrowIfDisposed();
+        MiniaudioBiquadNode.ValidateCoefficients(a0);
+        var channelCount = ResolveNodeChannels(channels);
+
+        var nodeHandle = NativeMethods.EffectNodeCreateBiquad(_handle!, channelCount, b0, b1, b2, a0, a1, a2);
+        EnsureNodeCreated(nodeHandle, "biquad");
+        return new MiniaudioBiquadNode(this, nodeHandle, channelCount);
+    }
+
+    public MiniaudioDelayNode CreateDelay(uint delayInFrames, float decay = 0f, uint? channels = null)
+    {
+        ThrowIfDisposed();
+        if (delayInFrames == 0)
+        {
+            throw new ArgumentOutOfRangeException(nameof(delayInFrames), "Delay must be at least one frame.");
+        }
+
+        if (decay < 0 || decay >= 1)
+        {
+            throw new ArgumentOutOfRangeException(nameof(decay), "Decay must be in the range [0, 1).");
+        }
+
+        var channelCount = ResolveNodeChannels(channels);
+        var nodeHandle = NativeMethods.EffectNodeCreateDelay(_handle!, channelCount, delayInFrames, decay);
+        EnsureNodeCreated(nodeHandle, "delay");
+        return new MiniaudioDelayNode(this, nodeHandle, channelCount, delayInFrames);
+    }
+
+    // Lookahead defaults to 5 ms at the engine sample rate.
+    public MiniaudioLimiterNode CreateLimiter(float ceilingDb = -1f, float releaseMilliseconds = 50f, uint? lookaheadFrames = null, uint? channels = null, DynamicsKernel kernel = DynamicsKernel.Auto)
+    {
+        ThrowIfDisposed();
+        MiniaudioLimiterNode.ValidateParameters(ceilingDb, releaseMilliseconds);
+
+        var lookahead = lookaheadFrames ?? SampleRate / 200;
+        if (lookahead > SampleRate)
+        {
+            throw new ArgumentOutOfRangeException(nameof(lookaheadFrames), "Lookahead must not exceed one second.");
+        }
+
+        var channelCount = ResolveNodeChannels(channels);
+        EnsureKernelSupported(kernel);
+        var nodeHandle = NativeMethods.LimiterCreate(_handle!, channelCount, ceilingDb, releaseMilliseconds, lookahead, (uint)kernel);
+        EnsureNodeCreated(nodeHandle, "limiter");
+        return new MiniaudioLimiterNode(this, nodeHandle, channelCount, ceilingDb, releaseMilliseconds, lookahead);
+    }
+
+    public MiniaudioCompressorNode CreateCompressor(
+        float thresholdDb = -18f,
+        float ratio = 4f,
+        float attackMilliseconds = 10f,
+        float releaseMilliseconds = 100f,
+        float makeupGainDb = 0f,
+        uint? channels = null,
+        DynamicsKernel kernel = DynamicsKernel.Auto)
+    {
+        ThrowIfDisposed();
+        MiniaudioCompressorNode.ValidateParameters(thresholdDb, ratio, attackMilliseconds, releaseMilliseconds, makeupGainDb);
+
+        var channelCount = ResolveNodeChannels(channels);
+        EnsureKernelSupported(kernel);
+        var nodeHandle = NativeMethods.CompressorCreate(_handle!, channelCount, thresholdDb, ratio, attackMilliseconds, releaseMilliseconds, makeupGainDb, (uint)kernel);
+        EnsureNodeCreated(nodeHandle, "compressor");
+        return new MiniaudioCompressorNode(this, nodeHandle, channelCount, thresholdDb, ratio, attackMilliseconds, releaseMilliseconds, makeupGainDb);
+    }
+
+    // The process function is called once per graph processing chunk (normally one device period) with every bus's
+    // frames at once; see CustomNodeProcessContext for the buffer layout.
+    public unsafe MiniaudioCustomNode CreateCustomNode(
+        delegate* unmanaged[Cdecl]<CustomNodeProcessContext*, void> process,
+        IntPtr userData = default,
+        uint inputBusCount = 1,
+        uint outputBusCount = 1,
+        uint? channels = null,
+        CustomNodeFlags flags = CustomNodeFlags.None)
+    {
+        ThrowIfDisposed();
+        if (process == null)
+        {
+            throw new ArgumentNullException(nameof(process));
+        }
+
+        if (inputBusCount > NativeMethods.MaxNodeBusCount)
+        {
+            throw new ArgumentOutOfRangeException(nameof(inputBusCount), $"Input bus count must be between 0 and {NativeMethods.MaxNodeBusCount}.");
+        }
+
+        if (outputBusCount == 0 || outputBusCount > NativeMethods.MaxNodeBusCount)
+        {
+            throw new ArgumentOutOfRangeException(nameof(outputBusCount), $"Output bus count must be between 1 and {NativeMethods.MaxNodeBusCount}.");
+        }
+
+        const CustomNodeFlags supportedFlags = CustomNodeFlags.ContinuousProcessing | CustomNodeFlags.SilentOutput;
+        if ((flags & ~supportedFlags) != 0)
+        {
+            throw new ArgumentOutOfRangeException(nameof(flags), "Unsupported custom node flags.");
+        }
+
+        var channelCount = ResolveNodeChannels(channels);
+        var nodeHandle = NativeMethods.CustomNodeCreate(_handle!, inputBusCount, outputBusCount, channelCount, (uint)flags, process, userData);
+        EnsureNodeCreated(nodeHandle, "custom");
+
+        return new MiniaudioCustomNode(this, nodeHandle, channelCount, userData);
+    }
+
+    public MiniaudioVoicePool CreateVoicePool(uint capacity, uint channels, uint sampleRate, VoiceStealPolicy stealPolicy = VoiceStealPolicy.Oldest, SoundInitFlags flags = SoundInitFlags.None)
+    {
+        ThrowIfDisposed();
+
+        if (capacity == 0)
+        {
+            throw new ArgumentOutOfRangeException(nameof(capacity), "Voice pool capacity must be greater than 0.");
+        }
+
+        if (channels == 0 || channels > NativeMethods.MaxChannels)
+        {
+            throw new ArgumentOutOfRangeException(nameof(channels), $"Channel count must be between 1 and {NativeMethods.MaxChannels}.");
+        }
+
+        if (sampleRate == 0)
+        {
+            throw new ArgumentOutOfRangeException(nameof(sampleRate), "Sample rate must be greater than 0.");
+        }
+
+        if (!Enum.IsDefined(stealPolicy))
+        {
+            throw new ArgumentOutOfRangeException(nameof(stealPolicy));
+        }
+
+        var poolHandle = NativeMethods.VoicePoolCreate(_handle!, capacity, channels, sampleRate, (uint)flags, stealPolicy);
+        if (poolHandle is null || poolHandle.IsInvalid)
+        {
+            throw new InvalidOperationException("Failed to create voice pool. Confirm that the native miniaudionet library is up to date.");
+        }
+
+        return new MiniaudioVoicePool(this, poolHandle, channels, sampleRate, stealPolicy);
+    }
+
+    public unsafe MiniaudioSound CreateSoundFromPcmMemory(ReadOnlyMemory<float> interleavedFrames, uint channels, uint sampleRate, SoundInitFlags flags = SoundInitFlags.None)
+    {
+        ThrowIfDisposed();
+
+        if (channels == 0)
+        {
+            throw new ArgumentOutOfRangeException(nameof(channels), "Channel count must be greater than 0.");
+        }
+
+        if (sampleRate == 0)
+        {
+            throw new ArgumentOutOfRangeException(nameof(sampleRate), "Sample rate must be greater than 0.");
+        }
+
+        if (interleavedFrames.IsEmpty)
+        {
+            throw new ArgumentException("PCM data cannot be empty.", nameof(interleavedFrames));
+        }
+
+        if (interleavedFrames.Length % channels != 0)
+        {
+            throw new ArgumentException("PCM data length must be divisible by the number of channels.", nameof(interleavedFrames));
+        }
+
+        // The native sound reads straight from this memory, so it stays pinned until the sound is disposed.
+        var pin = interleavedFrames.Pin();
+        var frameCount = (ulong)(interleavedFrames.Length / channels);
+        var soundHandle = NativeMethods.SoundCreateFromPcmFramesRef(_handle!, (float*)pin.Pointer, frameCount, channels, sampleRate, (uint)flags);
+        if (soundHandle is null || soundHandle.IsInvalid)
+        {
+            pin.Dispose();
+            throw new InvalidOperationException("Failed to create sound from PCM memory. Confirm that the native miniaudionet library is up to date.");
+        }
+
+        return new MiniaudioSound(this, soundHandle, "pcm:memory", pin);
+    }
+
+    public MiniaudioSound CreateSoundFromPcmPlanes(ReadOnlySpan<ReadOnlyMemory<float>> channelPlanes, uint sampleRate, SoundInitFlags flags = SoundInitFlags.None)
+    {
+        ThrowIfDisposed();
+
+        if (channelPlanes.IsEmpty || channelPlanes.Length > NativeMethods.MaxChannels)
+        {
+            throw new ArgumentOutOfRangeException(nameof(channelPlanes), $"Channel plane count must be between 1 and {NativeMethods.MaxChannels}.");
+        }
+
+        if (sampleRate == 0)
+        {
+            throw new ArgumentOutOfRangeException(nameof(sampleRate), "Sample rate must be greater than 0.");
+        }
+
+        var frameCount = channelPlanes[0].Length;
+        if (frameCount == 0)
+        {
+            throw new ArgumentException("PCM data cannot be empty.", nameof(channelPlanes));
+        }
+
+        for (var i = 1; i < channelPlanes.Length; i++)
+        {
+            if (channelPlanes[i].Length != frameCount)
+            {
+                throw new ArgumentException("All channel planes must have the same length.", nameof(channelPlanes));
+            }
+        }
+
+        var soundHandle = NativeMethods.SoundCreateFromPcmPlanes(_handle!, channelPlanes, (ulong)frameCount, sampleRate, (uint)flags);
+        if (soundHandle is null || soundHandle.IsInvalid)
+        {
+            throw new InvalidOperationException("Failed to create sound from PCM planes. Confirm that the native miniaudionet library is up to date.");
+        }
+
+        return new MiniaudioSound(this, soundHandle, "pcm:memory");
+    }
+
     public MiniaudioStreamingSound CreateStreamingSound(uint channels, uint sampleRate, uint bufferCapacityInFrames = 65536, SoundInitFlags flags = SoundInitFlags.None)
+    {
+        return CreateStreamingSound(channels, sampleRate, MiniaudioSampleFormat.F32, bufferCapacityInFrames, flags);
+    }
+
+    public MiniaudioStreamingSound CreateStreamingSound(uint channels, uint sampleRate, MiniaudioSampleFormat inputFormat, uint bufferCapacityInFrames = 65536, SoundInitFlags flags = SoundInitFlags.None)
     {
         ThrowIfDisposed();
 
@@ -240,13 +717,18 @@ public sealed class MiniaudioEngine : IDisposable
             throw new ArgumentOutOfRangeException(nameof(bufferCapacityInFrames), "Buffer capacity must be greater than 0.");
         }
 
-        var soundHandle = NativeMethods.SoundCreateStreaming(_handle!, channels, sampleRate, bufferCapacityInFrames, (uint)flags);
+        if (inputFormat is < MiniaudioSampleFormat.U8 or > MiniaudioSampleFormat.F32)
+        {
+            throw new ArgumentOutOfRangeException(nameof(inputFormat), "Input format must be a concrete sample format.");
+        }
+
+        var soundHandle = NativeMethods.SoundCreateStreaming(_handle!, channels, sampleRate, bufferCapacityInFrames, (uint)flags, (uint)inputFormat);
         if (soundHandle is null || soundHandle.IsInvalid)
         {
             throw new InvalidOperationException("Failed to create streaming sound. Confirm that the native miniaudionet library is up to date.");
         }
 
-        return new MiniaudioStreamingSound(this, soundHandle, channels, sampleRate, bufferCapacityInFrames);
+        return new MiniaudioStreamingSound(this, soundHandle, channels, sampleRate, bufferCapacityInFrames, inputFormat);
     }
 
     public void Play(string filePath)
@@ -256,6 +738,38 @@ public sealed class MiniaudioEngine : IDisposable
         NativeMethods.EnginePlaySound(_handle!, filePath).EnsureSuccess(nameof(Play));
     }
 
+    public ulong Render(Span<float> interleavedFrames)
+    {
+        ThrowIfDisposed();
+
+        if (interleavedFrames.IsEmpty)
+        {
+            return 0;
+        }
+
+        var channels = Channels;
+        if (interleavedFrames.Length % channels != 0)
+        {
+            throw new ArgumentException("PCM buffer length must be divisible by the number of engine channels.", nameof(interleavedFrames));
+        }
+
+        var frameCount = (ulong)(interleavedFrames.Length / channels);
+        NativeMethods.EngineReadPcmFrames(_handle!, interleavedFrames, frameCount, out var framesRead).EnsureSuccess(nameof(Render));
+        return framesRead;
+    }
+
+    public MeterSnapshot GetMeterSnapshot()
+    {
+        ThrowIfDisposed();
+        if (!_meteringEnabled)
+        {
+            throw new InvalidOperationException("Metering is only available when the engine is created with EnableMetering.");
+        }
+
+        NativeMethods.EngineGetMeterSnapshot(_handle!, out var snapshot).EnsureSuccess(nameof(GetMeterSnapshot));
+        return MeterSnapshot.FromNative(in snapshot);
+    }
+
     public void Start()
     {
         ThrowIfDisposed();
@@ -384,6 +898,29 @@ public sealed class MiniaudioEngine : IDisposable
         GC.SuppressFinalize(this);
     }
 
+    private static async Task<MiniaudioSound> CompleteSoundLoadAsync(MiniaudioSound sound, Task<int> completion, CancellationToken cancellationToken)
+    {
+        try
+        {
+            var result = await completion.WaitAsync(cancellationToken).ConfigureAwait(false);
+            result.EnsureSuccess(nameof(CreateSoundAsync));
+            return sound;
+        }
+        catch
+        {
+            sound.Dispose();
+            throw;
+        }
+    }
+
+    private static void HandleSoundLoaded(IntPtr userData, int result)
+    {
+        var handle = GCHandle.FromIntPtr(userData);
+        var completion = (TaskCompletionSource<int>)handle.Target!;
+        handle.Free();
+        completion.TrySetResult(result);
+    }
+
     private void ThrowIfDisposed()
     {
         if (_handle is null || _handle.IsClosed)
@@ -391,4 +928,53 @@ public sealed class MiniaudioEngine : IDisposable
             throw new ObjectDisposedException(nameof(MiniaudioEngine));
         }
     }
+
+    private void ValidateFilter(double cutoffFrequency, uint order)
+    {
+        MiniaudioEffectNode.ValidateFrequency(cutoffFrequency, SampleRate, nameof(cutoffFrequency));
+
+        if (order == 0 || order > NativeMethods.MaxFilterOrder)
+        {
+            throw new ArgumentOutOfRangeException(nameof(order), $"Filter order must be between 1 and {NativeMethods.MaxFilterOrder}.");
+        }
+    }
+
+    private uint ResolveNodeChannels(uint? channels)
+    {
+        var channelCount = channels ?? Channels;
+        if (channelCount == 0 || channelCount > NativeMethods.MaxChannels)
+        {
+            throw new ArgumentOutOfRangeException(nameof(channels), $"Channel count must be between 1 and {NativeMethods.MaxChannels}.");
+        }
+
+        return channelCount;
+    }
+
+    private static void EnsureKernelSupported(DynamicsKernel kernel)
+    {
+        if (kernel != DynamicsKernel.Auto && !MiniaudioDynamicsNode.IsKernelSupported(kernel))
+        {
+            throw new NotSupportedException($"The {kernel} dynamics kernel is not available on this machine.");
+        }
+    }
+
+    private static void EnsureNodeCreated(SafeHandle? nodeHandle, string kind)
+    {
+        if (nodeHandle is null || nodeHandle.IsInvalid)
+        {
+            throw new InvalidOperationException($"Failed to create {kind} node. Confirm that the native miniaudionet library is up to date.");
+        }
+    }
+
+    private sealed class EndpointNode : MiniaudioNode
+    {
+        public EndpointNode(MiniaudioEngine engine)
+            : base(engine)
+        {
+        }
+
+        private protected override SafeHandle NodeOwner => Engine.DangerousHandle;
+
+        private protected override IntPtr GetNativeNode() => NativeMethods.EngineGetEndpointNode(Engine.DangerousHandle);
+    }
 }
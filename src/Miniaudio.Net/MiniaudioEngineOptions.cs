@@ -22,6 +22,9 @@ public sealed class MiniaudioEngineOptions
 
     public bool NoDevice { get; init; }
 
+    // Meters the engine output on the audio thread so MiniaudioEngine.GetMeterSnapshot is available.
+    public bool EnableMetering { get; init; }
+
     internal void Validate()
     {
         if (NoDevice)
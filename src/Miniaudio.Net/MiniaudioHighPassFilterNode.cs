@@ -0,0 +1,30 @@
+using System;
+using Miniaudio.Net.Interop;
+
+namespace Miniaudio.Net;
+
+// Butterworth high-pass filter. The order is fixed at creation; the cutoff can be moved while audio is playing.
+public sealed class MiniaudioHighPassFilterNode : MiniaudioEffectNode
+{
+    private double _cutoffFrequency;
+
+    internal MiniaudioHighPassFilterNode(MiniaudioEngine engine, EffectNodeHandle handle, uint channels, double cutoffFrequency, uint order)
+        : base(engine, handle, channels)
+    {
+        _cutoffFrequency = cutoffFrequency;
+        Order = order;
+    }
+
+    public uint Order { get; }
+
+    public double CutoffFrequency
+    {
+        get => _cutoffFrequency;
+        set
+        {
+            ValidateFrequency(value, SampleRate, nameof(value));
+            NativeMethods.EffectNodeSetCutoff(Handle, value).EnsureSuccess(nameof(CutoffFrequency));
+            _cutoffFrequency = value;
+        }
+    }
+}
@@ -0,0 +1,48 @@
+using System;
+using Miniaudio.Net.Interop;
+
+namespace Miniaudio.Net;
+
+// Lookahead peak limiter. The signal is delayed by LookaheadFrames so the gain can ramp down before a peak arrives;
+// no output sample exceeds the ceiling.
+public sealed class MiniaudioLimiterNode : MiniaudioDynamicsNode
+{
+    private float _ceilingDb;
+    private float _releaseMilliseconds;
+
+    internal MiniaudioLimiterNode(MiniaudioEngine engine, DynamicsNodeHandle handle, uint channels, float ceilingDb, float releaseMilliseconds, uint lookaheadFrames)
+        : base(engine, handle, channels)
+    {
+        _ceilingDb = ceilingDb;
+        _releaseMilliseconds = releaseMilliseconds;
+        LookaheadFrames = lookaheadFrames;
+    }
+
+    public uint LookaheadFrames { get; }
+
+    public float CeilingDb
+    {
+        get => _ceilingDb;
+        set => SetParameters(value, _releaseMilliseconds);
+    }
+
+    public float ReleaseMilliseconds
+    {
+        get => _releaseMilliseconds;
+        set => SetParameters(_ceilingDb, value);
+    }
+
+    public void SetParameters(float ceilingDb, float releaseMilliseconds)
+    {
+        ValidateParameters(ceilingDb, releaseMilliseconds);
+        NativeMethods.DynamicsNodeSetLimiter(Handle, ceilingDb, releaseMilliseconds).EnsureSuccess(nameof(SetParameters));
+        _ceilingDb = ceilingDb;
+        _releaseMilliseconds = releaseMilliseconds;
+    }
+
+    internal static void ValidateParameters(float ceilingDb, float releaseMilliseconds)
+    {
+        ValidateDecibels(ceilingDb, MinLevelDb, MaxLevelDb, nameof(ceilingDb));
+        ValidateTime(releaseMilliseconds, nameof(releaseMilliseconds));
+    }
+}
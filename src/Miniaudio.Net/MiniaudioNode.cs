@@ -0,0 +1,87 @@
+using System;
+using System.Runtime.InteropServices;
+using Miniaudio.Net.Interop;
+
+namespace Miniaudio.Net;
+
+// A node in the engine's node graph. Every output bus can feed one input bus of another node; by default sounds and
+// groups feed the engine endpoint.
+public abstract class MiniaudioNode
+{
+    private protected MiniaudioNode(MiniaudioEngine engine)
+    {
+        Engine = engine ?? throw new ArgumentNullException(nameof(engine));
+    }
+
+    public MiniaudioEngine Engine { get; }
+
+    public uint InputBusCount => UseNode(NativeMethods.NodeGetInputBusCount);
+
+    public uint OutputBusCount => UseNode(NativeMethods.NodeGetOutputBusCount);
+
+    public void AttachOutputBus(MiniaudioNode target) => AttachOutputBus(0, target, 0);
+
+    // Replaces whatever the output bus was attached to before.
+    public void AttachOutputBus(uint outputBus, MiniaudioNode target, uint targetInputBus = 0)
+    {
+        ArgumentNullException.ThrowIfNull(target);
+        EnsureSameEngine(target);
+
+        var result = UseNode(node => target.UseNode(targetNode => NativeMethods.NodeAttachOutputBus(node, outputBus, targetNode, targetInputBus)));
+        result.EnsureSuccess(nameof(AttachOutputBus));
+    }
+
+    public void DetachOutputBus(uint outputBus)
+    {
+        UseNode(node => NativeMethods.NodeDetachOutputBus(node, outputBus)).EnsureSuccess(nameof(DetachOutputBus));
+    }
+
+    public void DetachAllOutputBuses()
+    {
+        UseNode(NativeMethods.NodeDetachAllOutputBuses).EnsureSuccess(nameof(DetachAllOutputBuses));
+    }
+
+    public float GetOutputBusVolume(uint outputBus)
+    {
+        var volume = 0f;
+        UseNode(node => NativeMethods.NodeGetOutputBusVolume(node, outputBus, out volume)).EnsureSuccess(nameof(GetOutputBusVolume));
+        return volume;
+    }
+
+    public void SetOutputBusVolume(uint outputBus, float volume)
+    {
+        UseNode(node => NativeMethods.NodeSetOutputBusVolume(node, outputBus, volume)).EnsureSuccess(nameof(SetOutputBusVolume));
+    }
+
+    // Handle of the object that owns the node; throws ObjectDisposedException once it is released.
+    private protected abstract SafeHandle NodeOwner { get; }
+
+    private protected abstract IntPtr GetNativeNode();
+
+    internal T UseNode<T>(Func<IntPtr, T> action)
+    {
+        var owner = NodeOwner;
+        var addRef = false;
+
+        try
+        {
+            owner.DangerousAddRef(ref addRef);
+            return action(GetNativeNode());
+        }
+        finally
+        {
+            if (addRef)
+            {
+                owner.DangerousRelease();
+            }
+        }
+    }
+
+    internal void EnsureSameEngine(MiniaudioNode target)
+    {
+        if (!ReferenceEquals(target.Engine, Engine))
+        {
+            throw new ArgumentException("Nodes can only be connected within the same engine.", nameof(target));
+        }
+    }
+}
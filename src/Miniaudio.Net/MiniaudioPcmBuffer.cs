@@ -0,0 +1,76 @@
+using System;
+using Miniaudio.Net.Interop;
+
+namespace Miniaudio.Net;
+
+public sealed class MiniaudioPcmBuffer : IDisposable
+{
+    private PcmBufferHandle? _handle;
+
+    private MiniaudioPcmBuffer(PcmBufferHandle handle, uint channels, uint sampleRate, ulong frameCount)
+    {
+        _handle = handle ?? throw new ArgumentNullException(nameof(handle));
+        Channels = channels;
+        SampleRate = sampleRate;
+        FrameCount = frameCount;
+    }
+
+    public static MiniaudioPcmBuffer Create(ReadOnlySpan<float> interleavedFrames, uint channels, uint sampleRate)
+    {
+        if (channels == 0)
+        {
+            throw new ArgumentOutOfRangeException(nameof(channels), "Channel count must be greater than 0.");
+        }
+
+        if (sampleRate == 0)
+        {
+            throw new ArgumentOutOfRangeException(nameof(sampleRate), "Sample rate must be greater than 0.");
+        }
+
+        if (interleavedFrames.IsEmpty)
+        {
+            throw new ArgumentException("PCM data cannot be empty.", nameof(interleavedFrames));
+        }
+
+        if (interleavedFrames.Length % channels != 0)
+        {
+            throw new ArgumentException("PCM data length must be divisible by the number of channels.", nameof(interleavedFrames));
+        }
+
+        var frameCount = (ulong)(interleavedFrames.Length / channels);
+        var handle = NativeMethods.PcmBufferCreate(interleavedFrames, frameCount, channels, sampleRate);
+        if (handle is null || handle.IsInvalid)
+        {
+            throw new InvalidOperationException("Failed to allocate the native PCM buffer.");
+        }
+
+        return new MiniaudioPcmBuffer(handle, channels, sampleRate, frameCount);
+    }
+
+    public uint Channels { get; }
+
+    public uint SampleRate { get; }
+
+    public ulong FrameCount { get; }
+
+    internal PcmBufferHandle DangerousHandle
+    {
+        get
+        {
+            if (_handle is null || _handle.IsClosed)
+            {
+                throw new ObjectDisposedException(nameof(MiniaudioPcmBuffer));
+            }
+
+            return _handle;
+        }
+    }
+
+    // Sounds created from this buffer hold their own reference, so disposing it does not stop them.
+    public void Dispose()
+    {
+        _handle?.Dispose();
+        _handle = null;
+        GC.SuppressFinalize(this);
+    }
+}
@@ -0,0 +1,57 @@
+using System;
+using Miniaudio.Net.Interop;
+
+namespace Miniaudio.Net;
+
+// Second-order peaking EQ band. Changing any parameter recomputes the coefficients without resetting the filter state.
+public sealed class MiniaudioPeakingEqNode : MiniaudioEffectNode
+{
+    private double _frequency;
+    private double _gainDb;
+    private double _q;
+
+    internal MiniaudioPeakingEqNode(MiniaudioEngine engine, EffectNodeHandle handle, uint channels, double frequency, double gainDb, double q)
+        : base(engine, handle, channels)
+    {
+        _frequency = frequency;
+        _gainDb = gainDb;
+        _q = q;
+    }
+
+    public double Frequency
+    {
+        get => _frequency;
+        set => SetParameters(value, _gainDb, _q);
+    }
+
+    public double GainDb
+    {
+        get => _gainDb;
+        set => SetParameters(_frequency, value, _q);
+    }
+
+    public double Q
+    {
+        get => _q;
+        set => SetParameters(_frequency, _gainDb, value);
+    }
+
+    public void SetParameters(double frequency, double gainDb, double q)
+    {
+        ValidateFrequency(frequency, SampleRate, nameof(frequency));
+        if (!double.IsFinite(gainDb))
+        {
+            throw new ArgumentOutOfRangeException(nameof(gainDb), "Gain must be a finite value.");
+        }
+
+        if (!double.IsFinite(q) || q <= 0)
+        {
+            throw new ArgumentOutOfRangeException(nameof(q), "Q must be a positive finite value.");
+        }
+
+        NativeMethods.EffectNodeSetPeakingEq(Handle, gainDb, q, frequency).EnsureSuccess(nameof(SetParameters));
+        _frequency = frequency;
+        _gainDb = gainDb;
+        _q = q;
+    }
+}
@@ -1,4 +1,6 @@
 using System;
+using System.IO;
+using System.Runtime.InteropServices;
 using Miniaudio.Net.Interop;
 
 namespace Miniaudio.Net;
@@ -7,11 +9,13 @@ public sealed class MiniaudioResourceManager : IDisposable
 {
     private ResourceManagerHandle? _handle;
     private readonly MiniaudioResourceManagerOptions _options;
+    private GCHandle _fileSystemHandle;
 
-    private MiniaudioResourceManager(ResourceManagerHandle handle, MiniaudioResourceManagerOptions options)
+    private MiniaudioResourceManager(ResourceManagerHandle handle, MiniaudioResourceManagerOptions options, GCHandle fileSystemHandle)
     {
         _handle = handle ?? throw new ArgumentNullException(nameof(handle));
         _options = options;
+        _fileSystemHandle = fileSystemHandle;
     }
 
     public static MiniaudioResourceManager Create(MiniaudioResourceManagerOptions? options = null)
@@ -19,16 +23,62 @@ public sealed class MiniaudioResourceManager : IDisposable
         options ??= new MiniaudioResourceManagerOptions();
         options.Validate();
 
-        ResourceManagerHandle handle = options.HasOverrides
-            ? NativeMethods.ResourceManagerCreate(options.ToNativeConfig())
-            : NativeMethods.ResourceManagerCreateDefault();
+        // The file system must stay reachable from job threads until the native manager is destroyed.
+        var fileSystemHandle = options.VirtualFileSystem is { } fileSystem ? GCHandle.Alloc(fileSystem) : default;
+
+        ResourceManagerHandle handle;
+        var config = options.ToNativeConfig();
+        var pack = options.AssetPack?.DangerousHandle;
+        var packAddRef = false;
+        var cacheDirectory = IntPtr.Zero;
+        try
+        {
+            if (options.DecodedCacheDirectory is { } directory)
+            {
+                cacheDirectory = Marshal.StringToCoTaskMemUTF8(Directory.CreateDirectory(directory).FullName);
+                config.DecodedCacheDirectory = cacheDirectory;
+            }
+
+            // The native manager takes its own reference on the pack.
+            if (pack is not null)
+            {
+                pack.DangerousAddRef(ref packAddRef);
+                config.AssetPack = pack.DangerousGetHandle();
+            }
+
+            if (fileSystemHandle.IsAllocated)
+            {
+                var vfs = MiniaudioVirtualFileSystem.ToNativeConfig(GCHandle.ToIntPtr(fileSystemHandle));
+                handle = NativeMethods.ResourceManagerCreate(config, vfs);
+            }
+            else
+            {
+                handle = options.HasOverrides
+                    ? NativeMethods.ResourceManagerCreate(config)
+                    : NativeMethods.ResourceManagerCreateDefault();
+            }
+        }
+        finally
+        {
+            if (packAddRef)
+            {
+                pack!.DangerousRelease();
+            }
+
+            Marshal.FreeCoTaskMem(cacheDirectory);
+        }
 
         if (handle is null || handle.IsInvalid)
         {
+            if (fileSystemHandle.IsAllocated)
+            {
+                fileSystemHandle.Free();
+            }
+
             throw new InvalidOperationException("Failed to initialize a miniaudio resource manager. Confirm that the native miniaudionet library is built and discoverable.");
         }
 
-        return new MiniaudioResourceManager(handle, options.Snapshot());
+        return new MiniaudioResourceManager(handle, options.Snapshot(), fileSystemHandle);
     }
 
     public MiniaudioResourceManagerOptions Options => _options;
@@ -46,10 +96,260 @@ public sealed class MiniaudioResourceManager : IDisposable
         }
     }
 
+    public ResourceManagerStatistics Statistics
+    {
+        get
+        {
+            NativeMethods.ResourceManagerGetStats(DangerousHandle, out var stats).EnsureSuccess(nameof(Statistics));
+            return new ResourceManagerStatistics(
+                stats.LoadedBuffers,
+                stats.ResidentBytes,
+                stats.CachedBuffers,
+                stats.CachedBytes,
+                stats.BudgetInBytes,
+                stats.CacheHits,
+                stats.CacheMisses,
+                stats.Evictions,
+                stats.PendingJobs);
+        }
+    }
+
+    // 0 disables retention: decoded data is released as soon as the last sound using it is disposed.
+    public ulong MemoryBudgetInBytes
+    {
+        get
+        {
+            NativeMethods.ResourceManagerGetStats(DangerousHandle, out var stats).EnsureSuccess(nameof(MemoryBudgetInBytes));
+            return stats.BudgetInBytes;
+        }
+        set => NativeMethods.ResourceManagerSetMemoryBudget(DangerousHandle, value).EnsureSuccess(nameof(MemoryBudgetInBytes));
+    }
+
+    public void ResetStatistics()
+    {
+        NativeMethods.ResourceManagerResetStats(DangerousHandle).EnsureSuccess(nameof(ResetStatistics));
+    }
+
+    public ResourceManagerJobStatistics JobStatistics
+    {
+        get
+        {
+            EnsureJobStatistics();
+            NativeMethods.ResourceManagerGetJobStats(DangerousHandle, out var stats).EnsureSuccess(nameof(JobStatistics));
+            return ResourceManagerJobStatistics.FromNative(in stats);
+        }
+    }
+
+    public void ResetJobStatistics()
+    {
+        EnsureJobStatistics();
+        NativeMethods.ResourceManagerResetJobStats(DangerousHandle).EnsureSuccess(nameof(ResetJobStatistics));
+    }
+
+    private void EnsureJobStatistics()
+    {
+        if (!_options.CollectJobStatistics)
+        {
+            throw new InvalidOperationException("Job statistics are only collected when the resource manager is created with CollectJobStatistics enabled.");
+        }
+    }
+
+    public void RegisterDecodedData(string name, ReadOnlySpan<float> interleavedFrames, uint channels, uint sampleRate)
+    {
+        ArgumentException.ThrowIfNullOrWhiteSpace(name);
+        ValidateDecodedData(interleavedFrames, channels, sampleRate);
+
+        var frameCount = (ulong)(interleavedFrames.Length / channels);
+        NativeMethods.ResourceManagerRegisterDecodedData(DangerousHandle, name, interleavedFrames, frameCount, channels, sampleRate).EnsureSuccess(nameof(RegisterDecodedData));
+    }
+
+    public void RegisterEncodedData(string name, ReadOnlySpan<byte> encodedData)
+    {
+        ArgumentException.ThrowIfNullOrWhiteSpace(name);
+
+        if (encodedData.IsEmpty)
+        {
+            throw new ArgumentException("Encoded data cannot be empty.", nameof(encodedData));
+        }
+
+        NativeMethods.ResourceManagerRegisterEncodedData(DangerousHandle, name, encodedData).EnsureSuccess(nameof(RegisterEncodedData));
+    }
+
+    public bool UnregisterData(string name)
+    {
+        ArgumentNullException.ThrowIfNull(name);
+
+        var result = NativeMethods.ResourceManagerUnregisterData(DangerousHandle, name);
+        if (result == NativeMethods.ResultDoesNotExist)
+        {
+            return false;
+        }
+
+        result.EnsureSuccess(nameof(UnregisterData));
+        return true;
+    }
+
+    public bool IsDataRegistered(string name)
+    {
+        ArgumentNullException.ThrowIfNull(name);
+        return NativeMethods.ResourceManagerIsDataRegistered(DangerousHandle, name) != 0;
+    }
+
+    internal static void ValidateDecodedData(ReadOnlySpan<float> interleavedFrames, uint channels, uint sampleRate)
+    {
+        if (channels == 0)
+        {
+            throw new ArgumentOutOfRangeException(nameof(channels), "Channel count must be greater than 0.");
+        }
+
+        if (sampleRate == 0)
+        {
+            throw new ArgumentOutOfRangeException(nameof(sampleRate), "Sample rate must be greater than 0.");
+        }
+
+        if (interleavedFrames.IsEmpty)
+        {
+            throw new ArgumentException("PCM data cannot be empty.", nameof(interleavedFrames));
+        }
+
+        if (interleavedFrames.Length % channels != 0)
+        {
+            throw new ArgumentException("PCM data length must be divisible by the number of channels.", nameof(interleavedFrames));
+        }
+    }
+
     public void Dispose()
     {
         _handle?.Dispose();
         _handle = null;
+
+        if (_fileSystemHandle.IsAllocated)
+        {
+            _fileSystemHandle.Free();
+        }
+
         GC.SuppressFinalize(this);
     }
+
+    public readonly struct ResourceManagerStatistics
+    {
+        public ResourceManagerStatistics(uint loadedBuffers, ulong residentBytes, uint cachedBuffers, ulong cachedBytes, ulong memoryBudgetInBytes, ulong cacheHits, ulong cacheMisses, ulong evictions, uint pendingJobs)
+        {
+            LoadedBuffers = loadedBuffers;
+            ResidentBytes = residentBytes;
+            CachedBuffers = cachedBuffers;
+            CachedBytes = cachedBytes;
+            MemoryBudgetInBytes = memoryBudgetInBytes;
+            CacheHits = cacheHits;
+            CacheMisses = cacheMisses;
+            Evictions = evictions;
+            PendingJobs = pendingJobs;
+        }
+
+        public uint LoadedBuffers { get; }
+
+        public ulong ResidentBytes { get; }
+
+        // Buffers kept resident only by the memory budget, with no sound referencing them.
+        public uint CachedBuffers { get; }
+
+        public ulong CachedBytes { get; }
+
+        public ulong MemoryBudgetInBytes { get; }
+
+        public ulong CacheHits { get; }
+
+        public ulong CacheMisses { get; }
+
+        public ulong Evictions { get; }
+
+        public uint PendingJobs { get; }
+    }
+
+    public sealed class ResourceManagerJobStatistics
+    {
+        private readonly ulong[] _queued;
+        private readonly ulong[] _completed;
+
+        private ResourceManagerJobStatistics(ulong[] queued, ulong[] completed, JobDurationHistogram queueWait, JobDurationHistogram processing, JobDurationHistogram decode, ulong streamRefills, ulong streamRefillMisses, uint pendingJobs, uint workerCount)
+        {
+            _queued = queued;
+            _completed = completed;
+            QueueWait = queueWait;
+            Processing = processing;
+            Decode = decode;
+            StreamRefills = streamRefills;
+            StreamRefillMisses = streamRefillMisses;
+            PendingJobs = pendingJobs;
+            WorkerCount = workerCount;
+        }
+
+        // Time from the dispatcher taking a job off miniaudio's queue to a worker starting it. Time spent in
+        // miniaudio's queue before that is not visible to the bridge; Processing covers the job itself.
+        public JobDurationHistogram QueueWait { get; }
+
+        public JobDurationHistogram Processing { get; }
+
+        // Total job time spent loading and decoding each asynchronously loaded asset, recorded once it completes.
+        public JobDurationHistogram Decode { get; }
+
+        public ulong StreamRefills { get; }
+
+        // Refills that started after playback had already consumed every decoded page.
+        public ulong StreamRefillMisses { get; }
+
+        // Jobs taken off the queue but not yet started by a worker.
+        public uint PendingJobs { get; }
+
+        public uint WorkerCount { get; }
+
+        // Jobs miniaudio re-posts to keep per-asset ordering are counted each time they pass through the queue.
+        public ulong GetQueuedCount(ResourceManagerJobType type) => _queued[GetSlot(type)];
+
+        public ulong GetCompletedCount(ResourceManagerJobType type) => _completed[GetSlot(type)];
+
+        private static int GetSlot(ResourceManagerJobType type)
+        {
+            var slot = (int)type;
+            if (slot <= 0 || slot >= NativeMethods.JobTypeSlots)
+            {
+                throw new ArgumentOutOfRangeException(nameof(type), type, "Unknown job type.");
+            }
+
+            return slot;
+        }
+
+        internal static unsafe ResourceManagerJobStatistics FromNative(in NativeMethods.ResourceManagerJobStats stats)
+        {
+            var queued = new ulong[NativeMethods.JobTypeSlots];
+            var completed = new ulong[NativeMethods.JobTypeSlots];
+            fixed (ulong* source = stats.Queued)
+            {
+                new ReadOnlySpan<ulong>(source, NativeMethods.JobTypeSlots).CopyTo(queued);
+            }
+
+            fixed (ulong* source = stats.Completed)
+            {
+                new ReadOnlySpan<ulong>(source, NativeMethods.JobTypeSlots).CopyTo(completed);
+            }
+
+            return new ResourceManagerJobStatistics(
+                queued,
+                completed,
+                ToHistogram(stats.QueueWait),
+                ToHistogram(stats.Processing),
+                ToHistogram(stats.Decode),
+                stats.StreamRefills,
+                stats.StreamRefillMisses,
+                stats.PendingJobs,
+                stats.WorkerCount);
+        }
+
+        private static unsafe JobDurationHistogram ToHistogram(NativeMethods.JobHistogram histogram)
+        {
+            var buckets = new ulong[NativeMethods.JobHistogramBucketCount];
+            new ReadOnlySpan<ulong>(histogram.Buckets, NativeMethods.JobHistogramBucketCount).CopyTo(buckets);
+            return new JobDurationHistogram(histogram.Count, histogram.TotalMicroseconds, histogram.MaxMicroseconds, buckets);
+        }
+    }
 }
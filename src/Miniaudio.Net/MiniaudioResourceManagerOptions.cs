@@ -15,12 +15,29 @@ public sealed class MiniaudioResourceManagerOptions
 
     public ResourceManagerFlags Flags { get; init; } = ResourceManagerFlags.None;
 
+    // Replaces the default stdio file access for every path the resource manager opens.
+    public MiniaudioVirtualFileSystem? VirtualFileSystem { get; init; }
+
+    // Serves "pack://<name>" paths from the memory-mapped pack; other paths still use VirtualFileSystem or stdio.
+    public MiniaudioAssetPack? AssetPack { get; init; }
+
+    // Decode loads are stored here as PCM at the engine's format and memory-mapped on later runs. Created if missing.
+    public string? DecodedCacheDirectory { get; init; }
+
+    // Runs the job threads through an instrumented dispatcher so MiniaudioResourceManager.JobStatistics is available.
+    // The dispatcher uses JobThreadCount workers (1 when unset); JobThreadCount = 0 is rejected by Validate.
+    public bool CollectJobStatistics { get; init; }
+
     internal bool HasOverrides =>
         DecodedFormat != MiniaudioSampleFormat.Unknown ||
         DecodedChannels.HasValue ||
         DecodedSampleRate.HasValue ||
         JobThreadCount.HasValue ||
-        Flags != ResourceManagerFlags.None;
+        Flags != ResourceManagerFlags.None ||
+        VirtualFileSystem is not null ||
+        AssetPack is not null ||
+        DecodedCacheDirectory is not null ||
+        CollectJobStatistics;
 
     internal void Validate()
     {
@@ -38,6 +55,16 @@ public sealed class MiniaudioResourceManagerOptions
         {
             throw new ArgumentOutOfRangeException(nameof(JobThreadCount), "Job thread count must be greater than 0.");
         }
+
+        if (DecodedCacheDirectory is not null && string.IsNullOrWhiteSpace(DecodedCacheDirectory))
+        {
+            throw new ArgumentException("Decoded cache directory cannot be empty.", nameof(DecodedCacheDirectory));
+        }
+
+        if (CollectJobStatistics && (Flags & (ResourceManagerFlags.NonBlocking | ResourceManagerFlags.NoThreading)) != 0)
+        {
+            throw new ArgumentException("Job statistics require the resource manager's own job threads; they cannot be combined with NonBlocking or NoThreading.", nameof(CollectJobStatistics));
+        }
     }
 
     internal NativeMethods.ResourceManagerConfig ToNativeConfig()
@@ -49,6 +76,7 @@ public sealed class MiniaudioResourceManagerOptions
             DecodedChannels = DecodedChannels ?? 0,
             DecodedSampleRate = DecodedSampleRate ?? 0,
             JobThreadCount = JobThreadCount ?? 0,
+            CollectJobStatistics = CollectJobStatistics ? 1u : 0u,
         };
     }
 
@@ -61,6 +89,10 @@ public sealed class MiniaudioResourceManagerOptions
             DecodedSampleRate = DecodedSampleRate,
             JobThreadCount = JobThreadCount,
             Flags = Flags,
+            VirtualFileSystem = VirtualFileSystem,
+            AssetPack = AssetPack,
+            DecodedCacheDirectory = DecodedCacheDirectory,
+            CollectJobStatistics = CollectJobStatistics,
         };
     }
 }
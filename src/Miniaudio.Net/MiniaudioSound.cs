@@ -1,10 +1,11 @@
 using System;
+using System.Buffers;
 using System.Runtime.InteropServices;
 using Miniaudio.Net.Interop;
 
 namespace Miniaudio.Net;
 
-public class MiniaudioSound : IDisposable
+public class MiniaudioSound : MiniaudioNode, IDisposable
 {
     private SoundHandle? _handle;
     private readonly MiniaudioEngine _engine;
@@ -12,17 +13,23 @@ public class MiniaudioSound : IDisposable
     private NativeMethods.SoundEndCallback? _endCallback;
     private GCHandle _endCallbackHandle;
     private bool _endCallbackHandleAllocated;
+    private MemoryHandle _pinnedFrames;
 
     internal MiniaudioSound(MiniaudioEngine engine, SoundHandle handle, string sourcePath)
+        : base(engine)
     {
-        _engine = engine ?? throw new ArgumentNullException(nameof(engine));
+        _engine = engine;
         _handle = handle ?? throw new ArgumentNullException(nameof(handle));
         SourcePath = sourcePath;
     }
 
-    public string SourcePath { get; }
+    internal MiniaudioSound(MiniaudioEngine engine, SoundHandle handle, string sourcePath, MemoryHandle pinnedFrames)
+        : this(engine, handle, sourcePath)
+    {
+        _pinnedFrames = pinnedFrames;
+    }
 
-    public MiniaudioEngine Engine => _engine;
+    public string SourcePath { get; }
 
     internal SoundHandle DangerousHandle
     {
@@ -201,6 +208,20 @@ public class MiniaudioSound : IDisposable
         }
     }
 
+    // Instances share the decoded data of this sound and only get their own playback state.
+    public MiniaudioSound CreateInstance()
+    {
+        ThrowIfDisposed();
+
+        var instanceHandle = NativeMethods.SoundCreateInstance(_handle!);
+        if (instanceHandle is null || instanceHandle.IsInvalid)
+        {
+            throw new InvalidOperationException("Failed to create sound instance. Only sounds loaded through the resource manager without SoundInitFlags.Stream, or created from a MiniaudioPcmBuffer, can be instanced.");
+        }
+
+        return new MiniaudioSound(_engine, instanceHandle, SourcePath);
+    }
+
     public void Start()
     {
         ThrowIfDisposed();
@@ -372,11 +393,26 @@ public class MiniaudioSound : IDisposable
         }
 
         DisableEndCallback();
+        OnHandleReleasing();
         _handle.Dispose();
         _handle = null;
+        _pinnedFrames.Dispose();
+        OnHandleReleased();
         GC.SuppressFinalize(this);
     }
 
+    private protected virtual void OnHandleReleasing()
+    {
+    }
+
+    private protected virtual void OnHandleReleased()
+    {
+    }
+
+    private protected override SafeHandle NodeOwner => DangerousHandle;
+
+    private protected override IntPtr GetNativeNode() => NativeMethods.SoundGetNode(_handle!);
+
     protected void ThrowIfDisposed()
     {
         if (_handle is null || _handle.IsClosed)
@@ -0,0 +1,122 @@
+using System;
+using System.Runtime.InteropServices;
+using Miniaudio.Net.Interop;
+
+namespace Miniaudio.Net;
+
+// Mixes the sounds attached to it so volume, pitch and pan are applied once per bus rather than per voice.
+public sealed class MiniaudioSoundGroup : MiniaudioNode, IDisposable
+{
+    private SoundGroupHandle? _handle;
+
+    internal MiniaudioSoundGroup(MiniaudioEngine engine, SoundGroupHandle handle, MiniaudioSoundGroup? parent)
+        : base(engine)
+    {
+        _handle = handle ?? throw new ArgumentNullException(nameof(handle));
+        Parent = parent;
+    }
+
+    public MiniaudioSoundGroup? Parent { get; }
+
+    internal SoundGroupHandle DangerousHandle
+    {
+        get
+        {
+            ThrowIfDisposed();
+            return _handle!;
+        }
+    }
+
+    public float Volume
+    {
+        get
+        {
+            ThrowIfDisposed();
+            return NativeMethods.SoundGroupGetVolume(_handle!);
+        }
+        set
+        {
+            ThrowIfDisposed();
+            NativeMethods.SoundGroupSetVolume(_handle!, value).EnsureSuccess(nameof(Volume));
+        }
+    }
+
+    public float Pitch
+    {
+        get
+        {
+            ThrowIfDisposed();
+            return NativeMethods.SoundGroupGetPitch(_handle!);
+        }
+        set
+        {
+            ThrowIfDisposed();
+            if (value <= 0)
+            {
+                throw new ArgumentOutOfRangeException(nameof(value), "Pitch must be greater than 0.");
+            }
+
+            NativeMethods.SoundGroupSetPitch(_handle!, value).EnsureSuccess(nameof(Pitch));
+        }
+    }
+
+    public float Pan
+    {
+        get
+        {
+            ThrowIfDisposed();
+            return NativeMethods.SoundGroupGetPan(_handle!);
+        }
+        set
+        {
+            ThrowIfDisposed();
+            NativeMethods.SoundGroupSetPan(_handle!, value).EnsureSuccess(nameof(Pan));
+        }
+    }
+
+    public bool IsPlaying
+    {
+        get
+        {
+            ThrowIfDisposed();
+            return NativeMethods.SoundGroupIsPlaying(_handle!) != 0;
+        }
+    }
+
+    // Groups start playing when created; stopping one silences every sound routed through it.
+    public void Start()
+    {
+        ThrowIfDisposed();
+        NativeMethods.SoundGroupStart(_handle!).EnsureSuccess(nameof(Start));
+    }
+
+    public void Stop()
+    {
+        ThrowIfDisposed();
+        NativeMethods.SoundGroupStop(_handle!).EnsureSuccess(nameof(Stop));
+    }
+
+    public void Dispose()
+    {
+        if (_handle is null)
+        {
+            return;
+        }
+
+        _handle.Dispose();
+        _handle = null;
+        GC.SuppressFinalize(this);
+    }
+
+    private protected override SafeHandle NodeOwner => DangerousHandle;
+
+    private protected override IntPtr GetNativeNode() => NativeMethods.SoundGroupGetNode(_handle!);
+
+    private void ThrowIfDisposed()
+    {
+        if (_handle is null || _handle.IsClosed)
+        {
+            throw new ObjectDisposedException(nameof(MiniaudioSoundGroup));
+        }
+    }
+}
@@ -0,0 +1,47 @@
+using System;
+using System.Runtime.InteropServices;
+using Miniaudio.Net.Interop;
+
+namespace Miniaudio.Net;
+
+// Copies its single input to every output bus. Outputs start detached, so attach each one where it should go.
+public sealed class MiniaudioSplitterNode : MiniaudioNode, IDisposable
+{
+    private SplitterHandle? _handle;
+
+    internal MiniaudioSplitterNode(MiniaudioEngine engine, SplitterHandle handle, uint channels)
+        : base(engine)
+    {
+        _handle = handle ?? throw new ArgumentNullException(nameof(handle));
+        Channels = channels;
+    }
+
+    public uint Channels { get; }
+
+    public void Dispose()
+    {
+        if (_handle is null)
+        {
+            return;
+        }
+
+        _handle.Dispose();
+        _handle = null;
+        GC.SuppressFinalize(this);
+    }
+
+    private protected override SafeHandle NodeOwner
+    {
+        get
+        {
+            if (_handle is null || _handle.IsClosed)
+            {
+                throw new ObjectDisposedException(nameof(MiniaudioSplitterNode));
+            }
+
+            return _handle;
+        }
+    }
+
+    private protected override IntPtr GetNativeNode() => NativeMethods.SplitterGetNode(_handle!);
+}
@@ -1,4 +1,7 @@
 using System;
+using System.Runtime.InteropServices;
+using System.Threading;
+using System.Threading.Tasks;
 using Miniaudio.Net.Interop;
 
 namespace Miniaudio.Net;
@@ -7,8 +10,15 @@ public sealed class MiniaudioStreamingSound : MiniaudioSound
 {
     private readonly uint _channels;
     private readonly uint _capacityInFrames;
+    private readonly MiniaudioSampleFormat _inputFormat;
+    private readonly AutoResetEvent _lowWatermarkEvent = new(false);
+    private NativeSignalWaiter? _notificationWaiter;
+    private TaskCompletionSource? _lowWatermarkWaiter;
+    private TaskCompletionSource? _writeSpaceWaiter;
+    private uint _lowWatermarkInFrames;
+    private int _appendAsyncInProgress;
 
-    internal MiniaudioStreamingSound(MiniaudioEngine engine, SoundHandle handle, uint channels, uint sampleRate, uint capacityInFrames)
+    internal MiniaudioStreamingSound(MiniaudioEngine engine, SoundHandle handle, uint channels, uint sampleRate, uint capacityInFrames, MiniaudioSampleFormat inputFormat)
         : base(engine, handle, "pcm:stream")
     {
         if (channels == 0)
@@ -23,12 +33,15 @@ public sealed class MiniaudioStreamingSound : MiniaudioSound
 
         _channels = channels;
         _capacityInFrames = capacityInFrames;
+        _inputFormat = inputFormat;
     }
 
     public uint Channels => _channels;
 
     public uint BufferCapacityInFrames => _capacityInFrames;
 
+    public MiniaudioSampleFormat InputFormat => _inputFormat;
+
     public ulong QueuedFrames
     {
         get
@@ -49,6 +62,90 @@ public sealed class MiniaudioStreamingSound : MiniaudioSound
         }
     }
 
+    public StreamStatistics Statistics
+    {
+        get
+        {
+            ThrowIfDisposed();
+            NativeMethods.SoundStreamGetStatistics(DangerousHandle, out var stats).EnsureSuccess(nameof(Statistics));
+            return new StreamStatistics(
+                stats.UnderrunCount,
+                stats.SilenceFramesInserted,
+                stats.FramesRead,
+                stats.FramesWritten,
+                stats.MinQueuedFrames,
+                stats.MaxQueuedFrames);
+        }
+    }
+
+    public void ResetStatistics()
+    {
+        ThrowIfDisposed();
+        NativeMethods.SoundStreamResetStatistics(DangerousHandle).EnsureSuccess(nameof(ResetStatistics));
+    }
+
+    public uint LowWatermarkInFrames
+    {
+        get
+        {
+            ThrowIfDisposed();
+            return _lowWatermarkInFrames;
+        }
+        set
+        {
+            ThrowIfDisposed();
+            if (value > _capacityInFrames)
+            {
+                throw new ArgumentOutOfRangeException(nameof(value), "Low watermark cannot exceed the buffer capacity.");
+            }
+
+            EnsureNotificationWaiterStarted();
+            NativeMethods.SoundStreamSetLowWatermark(DangerousHandle, value).EnsureSuccess(nameof(LowWatermarkInFrames));
+            _lowWatermarkInFrames = value;
+        }
+    }
+
+    public WaitHandle LowWatermarkWaitHandle
+    {
+        get
+        {
+            ThrowIfDisposed();
+            return _lowWatermarkEvent;
+        }
+    }
+
+    public ValueTask WaitForLowWatermarkAsync(CancellationToken cancellationToken = default)
+    {
+        ThrowIfDisposed();
+
+        var watermark = _lowWatermarkInFrames;
+        if (watermark == 0)
+        {
+            throw new InvalidOperationException("LowWatermarkInFrames must be set before waiting for a refill notification.");
+        }
+
+        if (QueuedFrames < watermark)
+        {
+            return ValueTask.CompletedTask;
+        }
+
+        var waiter = Volatile.Read(ref _lowWatermarkWaiter);
+        if (waiter is null)
+        {
+            var created = new TaskCompletionSource(TaskCreationOptions.RunContinuationsAsynchronously);
+            waiter = Interlocked.CompareExchange(ref _lowWatermarkWaiter, created, null) ?? created;
+        }
+
+        // The audio thread may have drained the buffer between the first check and publishing the waiter.
+        if (QueuedFrames < watermark)
+        {
+            Interlocked.CompareExchange(ref _lowWatermarkWaiter, null, waiter);
+            waiter.TrySetResult();
+        }
+
+        return new ValueTask(waiter.Task.WaitAsync(cancellationToken));
+    }
+
     public ulong AppendPcmFrames(ReadOnlySpan<float> interleavedFrames)
     {
         ThrowIfDisposed();
@@ -68,6 +165,137 @@ public sealed class MiniaudioStreamingSound : MiniaudioSound
         return written;
     }
 
+    public ulong AppendPcmFrames(ReadOnlySpan<short> interleavedFrames)
+    {
+        ThrowIfDisposed();
+
+        if (_inputFormat != MiniaudioSampleFormat.S16)
+        {
+            throw new InvalidOperationException("16-bit PCM can only be appended to a stream created with MiniaudioSampleFormat.S16.");
+        }
+
+        return AppendRawPcmFrames(MemoryMarshal.AsBytes(interleavedFrames));
+    }
+
+    public ulong AppendPlanarPcmFrames(ReadOnlySpan<ReadOnlyMemory<float>> channelPlanes)
+    {
+        ThrowIfDisposed();
+
+        if (channelPlanes.Length != _channels)
+        {
+            throw new ArgumentException("One plane per channel is required.", nameof(channelPlanes));
+        }
+
+        var frameCount = channelPlanes[0].Length;
+        for (var i = 1; i < channelPlanes.Length; i++)
+        {
+            if (channelPlanes[i].Length != frameCount)
+            {
+                throw new ArgumentException("All channel planes must have the same length.", nameof(channelPlanes));
+            }
+        }
+
+        if (frameCount == 0)
+        {
+            return 0;
+        }
+
+        NativeMethods.SoundStreamAppendPcmPlanes(DangerousHandle, channelPlanes, (ulong)frameCount, out var written).EnsureSuccess(nameof(AppendPlanarPcmFrames));
+        return written;
+    }
+
+    public ulong AppendRawPcmFrames(ReadOnlySpan<byte> interleavedFrames)
+    {
+        ThrowIfDisposed();
+
+        if (interleavedFrames.IsEmpty)
+        {
+            return 0;
+        }
+
+        var bytesPerFrame = GetBytesPerSample(_inputFormat) * _channels;
+        if (interleavedFrames.Length % bytesPerFrame != 0)
+        {
+            throw new ArgumentException("PCM data length must be a whole number of frames in the stream's input format.", nameof(interleavedFrames));
+        }
+
+        var frameCount = (ulong)(interleavedFrames.Length / bytesPerFrame);
+        NativeMethods.SoundStreamAppendRawPcmFrames(DangerousHandle, interleavedFrames, frameCount, out var written).EnsureSuccess(nameof(AppendRawPcmFrames));
+        return written;
+    }
+
+    public unsafe Span<float> AcquireWrite(int frames)
+    {
+        ThrowIfDisposed();
+
+        if (frames < 0)
+        {
+            throw new ArgumentOutOfRangeException(nameof(frames), "Frame count must be non-negative.");
+        }
+
+        var mappedFrames = (uint)frames;
+        NativeMethods.SoundStreamAcquireWrite(DangerousHandle, ref mappedFrames, out var buffer).EnsureSuccess(nameof(AcquireWrite));
+        if (mappedFrames == 0 || buffer == IntPtr.Zero)
+        {
+            return Span<float>.Empty;
+        }
+
+        return new Span<float>(buffer.ToPointer(), checked((int)(mappedFrames * _channels)));
+    }
+
+    public void CommitWrite(int frames)
+    {
+        ThrowIfDisposed();
+
+        if (frames < 0)
+        {
+            throw new ArgumentOutOfRangeException(nameof(frames), "Frame count must be non-negative.");
+        }
+
+        NativeMethods.SoundStreamCommitWrite(DangerousHandle, (uint)frames).EnsureSuccess(nameof(CommitWrite));
+    }
+
+    public async ValueTask AppendPcmFramesAsync(ReadOnlyMemory<float> interleavedFrames, CancellationToken cancellationToken = default)
+    {
+        ThrowIfDisposed();
+
+        if (interleavedFrames.Length % _channels != 0)
+        {
+            throw new ArgumentException("PCM data length must be divisible by the number of channels.", nameof(interleavedFrames));
+        }
+
+        if (Interlocked.Exchange(ref _appendAsyncInProgress, 1) != 0)
+        {
+            throw new InvalidOperationException("Another AppendPcmFramesAsync call is already in progress on this stream.");
+        }
+
+        try
+        {
+            var remaining = interleavedFrames;
+            while (!remaining.IsEmpty)
+            {
+                cancellationToken.ThrowIfCancellationRequested();
+
+                var written = AppendPcmFrames(remaining.Span);
+                remaining = remaining[checked((int)(written * _channels))..];
+                if (remaining.IsEmpty)
+                {
+                    break;
+                }
+
+                // Resume once half the ring (or the whole remainder, if smaller) is free so each wakeup moves a
+                // sizeable block while the other half keeps the audio thread fed.
+                var remainingFrames = (uint)(remaining.Length / _channels);
+                var resumeThreshold = Math.Min(remainingFrames, Math.Max(1u, _capacityInFrames / 2));
+                await WaitForWriteSpaceAsync(resumeThreshold, cancellationToken).ConfigureAwait(false);
+            }
+        }
+        finally
+        {
+            Volatile.Write(ref _appendAsyncInProgress, 0);
+        }
+    }
+
     public void SignalEndOfStream()
     {
         ThrowIfDisposed();
@@ -94,4 +322,114 @@ public sealed class MiniaudioStreamingSound : MiniaudioSound
         ThrowIfDisposed();
         NativeMethods.SoundStreamReset(DangerousHandle).EnsureSuccess(nameof(ResetBuffer));
     }
+
+    private async Task WaitForWriteSpaceAsync(uint frames, CancellationToken cancellationToken)
+    {
+        EnsureNotificationWaiterStarted();
+
+        var waiter = new TaskCompletionSource(TaskCreationOptions.RunContinuationsAsynchronously);
+        Volatile.Write(ref _writeSpaceWaiter, waiter);
+        NativeMethods.SoundStreamRequestWriteSpace(DangerousHandle, frames).EnsureSuccess(nameof(AppendPcmFramesAsync));
+
+        // The audio thread may have freed the space before the request was armed.
+        if (AvailableFramesToWrite >= frames)
+        {
+            Interlocked.CompareExchange(ref _writeSpaceWaiter, null, waiter);
+            waiter.TrySetResult();
+        }
+
+        try
+        {
+            await waiter.Task.WaitAsync(cancellationToken).ConfigureAwait(false);
+        }
+        catch (OperationCanceledException)
+        {
+            // Disarm the native request too; a stopped stream would otherwise keep it pending indefinitely.
+            if (Interlocked.CompareExchange(ref _writeSpaceWaiter, null, waiter) == waiter)
+            {
+                NativeMethods.SoundStreamRequestWriteSpace(DangerousHandle, 0).EnsureSuccess(nameof(AppendPcmFramesAsync));
+            }
+
+            throw;
+        }
+    }
+
+    // The audio thread only raises native notification bits; this waiter thread turns them into managed
+    // completions. It keeps the sound reachable until Dispose closes the notifications.
+    private void EnsureNotificationWaiterStarted()
+    {
+        var handle = DangerousHandle;
+        NativeSignalWaiter.EnsureStarted(
+            ref _notificationWaiter,
+            "Miniaudio stream notifications",
+            (out uint bits) => NativeMethods.SoundStreamWaitNotifications(handle, out bits),
+            HandleNotifications);
+    }
+
+    private void HandleNotifications(uint bits)
+    {
+        var notifications = (NativeMethods.SoundStreamNotification)bits;
+        if ((notifications & NativeMethods.SoundStreamNotification.LowWatermark) != 0)
+        {
+            _lowWatermarkEvent.Set();
+            Interlocked.Exchange(ref _lowWatermarkWaiter, null)?.TrySetResult();
+        }
+
+        if ((notifications & NativeMethods.SoundStreamNotification.WriteSpace) != 0)
+        {
+            Interlocked.Exchange(ref _writeSpaceWaiter, null)?.TrySetResult();
+        }
+    }
+
+    private static uint GetBytesPerSample(MiniaudioSampleFormat format)
+    {
+        return format switch
+        {
+            MiniaudioSampleFormat.U8 => 1,
+            MiniaudioSampleFormat.S16 => 2,
+            MiniaudioSampleFormat.S24 => 3,
+            _ => 4,
+        };
+    }
+
+    private protected override void OnHandleReleasing()
+    {
+        // Wakes the waiter thread for good; its pending native wait holds the handle until it returns.
+        if (Volatile.Read(ref _notificationWaiter) is not null)
+        {
+            NativeMethods.SoundStreamCloseNotifications(DangerousHandle).EnsureSuccess(nameof(Dispose));
+        }
+    }
+
+    private protected override void OnHandleReleased()
+    {
+        Interlocked.Exchange(ref _lowWatermarkWaiter, null)?.TrySetException(new ObjectDisposedException(nameof(MiniaudioStreamingSound)));
+        Interlocked.Exchange(ref _writeSpaceWaiter, null)?.TrySetException(new ObjectDisposedException(nameof(MiniaudioStreamingSound)));
+        _lowWatermarkEvent.Dispose();
+    }
+
+    public readonly struct StreamStatistics
+    {
+        public StreamStatistics(ulong underrunCount, ulong silenceFramesInserted, ulong framesRead, ulong framesWritten, ulong minQueuedFrames, ulong maxQueuedFrames)
+        {
+            UnderrunCount = underrunCount;
+            SilenceFramesInserted = silenceFramesInserted;
+            FramesRead = framesRead;
+            FramesWritten = framesWritten;
+            MinQueuedFrames = minQueuedFrames;
+            MaxQueuedFrames = maxQueuedFrames;
+        }
+
+        public ulong UnderrunCount { get; }
+
+        public ulong SilenceFramesInserted { get; }
+
+        public ulong FramesRead { get; }
+
+        public ulong FramesWritten { get; }
+
+        public ulong MinQueuedFrames { get; }
+
+        public ulong MaxQueuedFrames { get; }
+    }
 }
@@ -0,0 +1,182 @@
+using System;
+using System.IO;
+using System.Runtime.InteropServices;
+using Miniaudio.Net.Interop;
+
+namespace Miniaudio.Net;
+
+public abstract class MiniaudioVirtualFileSystem
+{
+    private static readonly unsafe NativeMethods.VfsOpenCallback s_open = HandleOpen;
+    private static readonly NativeMethods.VfsCloseCallback s_close = HandleClose;
+    private static readonly unsafe NativeMethods.VfsReadCallback s_read = HandleRead;
+    private static readonly NativeMethods.VfsSeekCallback s_seek = HandleSeek;
+    private static readonly unsafe NativeMethods.VfsTellCallback s_tell = HandleTell;
+    private static readonly unsafe NativeMethods.VfsSizeCallback s_size = HandleSize;
+
+    // Called from resource manager job threads as well as from the thread creating a sound.
+    // Returning null reports the path as missing. Non-seekable streams are buffered in memory.
+    public abstract Stream? OpenRead(string path);
+
+    public static MiniaudioVirtualFileSystem FromDelegate(Func<string, Stream?> openRead)
+    {
+        ArgumentNullException.ThrowIfNull(openRead);
+        return new DelegateFileSystem(openRead);
+    }
+
+    internal static NativeMethods.VfsConfig ToNativeConfig(IntPtr userData)
+    {
+        return new NativeMethods.VfsConfig
+        {
+            OnOpen = Marshal.GetFunctionPointerForDelegate(s_open),
+            OnClose = Marshal.GetFunctionPointerForDelegate(s_close),
+            OnRead = Marshal.GetFunctionPointerForDelegate(s_read),
+            OnSeek = Marshal.GetFunctionPointerForDelegate(s_seek),
+            OnTell = Marshal.GetFunctionPointerForDelegate(s_tell),
+            OnSize = Marshal.GetFunctionPointerForDelegate(s_size),
+            UserData = userData,
+        };
+    }
+
+    private static unsafe int HandleOpen(IntPtr userData, byte* path, uint openMode, IntPtr* file)
+    {
+        *file = IntPtr.Zero;
+
+        try
+        {
+            var fileSystem = (MiniaudioVirtualFileSystem)GCHandle.FromIntPtr(userData).Target!;
+            var stream = fileSystem.OpenRead(Marshal.PtrToStringUTF8((IntPtr)path) ?? string.Empty);
+            if (stream is null)
+            {
+                return NativeMethods.ResultDoesNotExist;
+            }
+
+            if (!stream.CanSeek)
+            {
+                var buffered = new MemoryStream();
+                using (stream)
+                {
+                    stream.CopyTo(buffered);
+                }
+
+                buffered.Position = 0;
+                stream = buffered;
+            }
+
+            *file = GCHandle.ToIntPtr(GCHandle.Alloc(stream));
+            return 0;
+        }
+        catch (FileNotFoundException)
+        {
+            return NativeMethods.ResultDoesNotExist;
+        }
+        catch (DirectoryNotFoundException)
+        {
+            return NativeMethods.ResultDoesNotExist;
+        }
+        catch
+        {
+            // Exceptions must not cross into native job threads.
+            return NativeMethods.ResultIoError;
+        }
+    }
+
+    private static int HandleClose(IntPtr userData, IntPtr file)
+    {
+        var handle = GCHandle.FromIntPtr(file);
+        try
+        {
+            ((Stream)handle.Target!).Dispose();
+            return 0;
+        }
+        catch
+        {
+            return NativeMethods.ResultIoError;
+        }
+        finally
+        {
+            handle.Free();
+        }
+    }
+
+    private static unsafe int HandleRead(IntPtr userData, IntPtr file, byte* destination, nuint sizeInBytes, nuint* bytesRead)
+    {
+        *bytesRead = 0;
+
+        try
+        {
+            var stream = (Stream)GCHandle.FromIntPtr(file).Target!;
+            var remaining = sizeInBytes;
+            while (remaining > 0)
+            {
+                var chunk = (int)Math.Min(remaining, (nuint)int.MaxValue);
+                var read = stream.Read(new Span<byte>(destination + (sizeInBytes - remaining), chunk));
+                if (read == 0)
+                {
+                    break;
+                }
+
+                remaining -= (nuint)read;
+            }
+
+            *bytesRead = sizeInBytes - remaining;
+            return 0;
+        }
+        catch
+        {
+            return NativeMethods.ResultIoError;
+        }
+    }
+
+    private static int HandleSeek(IntPtr userData, IntPtr file, long offset, uint origin)
+    {
+        try
+        {
+            // ma_seek_origin uses the same values as SeekOrigin.
+            ((Stream)GCHandle.FromIntPtr(file).Target!).Seek(offset, (SeekOrigin)origin);
+            return 0;
+        }
+        catch
+        {
+            return NativeMethods.ResultBadSeek;
+        }
+    }
+
+    private static unsafe int HandleTell(IntPtr userData, IntPtr file, long* cursor)
+    {
+        try
+        {
+            *cursor = ((Stream)GCHandle.FromIntPtr(file).Target!).Position;
+            return 0;
+        }
+        catch
+        {
+            return NativeMethods.ResultIoError;
+        }
+    }
+
+    private static unsafe int HandleSize(IntPtr userData, IntPtr file, ulong* sizeInBytes)
+    {
+        try
+        {
+            *sizeInBytes = (ulong)((Stream)GCHandle.FromIntPtr(file).Target!).Length;
+            return 0;
+        }
+        catch
+        {
+            return NativeMethods.ResultIoError;
+        }
+    }
+
+    private sealed class DelegateFileSystem : MiniaudioVirtualFileSystem
+    {
+        private readonly Func<string, Stream?> _openRead;
+
+        public DelegateFileSystem(Func<string, Stream?> openRead)
+        {
+            _openRead = openRead;
+        }
+
+        public override Stream? OpenRead(string path) => _openRead(path);
+    }
+}
@@ -0,0 +1,120 @@
+using System;
+using Miniaudio.Net.Interop;
+
+namespace Miniaudio.Net;
+
+public sealed class MiniaudioVoicePool : IDisposable
+{
+    private VoicePoolHandle? _handle;
+    private readonly MiniaudioEngine _engine;
+
+    internal MiniaudioVoicePool(MiniaudioEngine engine, VoicePoolHandle handle, uint channels, uint sampleRate, VoiceStealPolicy stealPolicy)
+    {
+        _engine = engine ?? throw new ArgumentNullException(nameof(engine));
+        _handle = handle ?? throw new ArgumentNullException(nameof(handle));
+        Channels = channels;
+        SampleRate = sampleRate;
+        StealPolicy = stealPolicy;
+    }
+
+    public MiniaudioEngine Engine => _engine;
+
+    public uint Channels { get; }
+
+    public uint SampleRate { get; }
+
+    public VoiceStealPolicy StealPolicy { get; }
+
+    public VoicePoolStatistics Statistics
+    {
+        get
+        {
+            ThrowIfDisposed();
+            NativeMethods.VoicePoolGetStats(_handle!, out var stats).EnsureSuccess(nameof(Statistics));
+            return new VoicePoolStatistics(stats.Capacity, stats.ActiveVoices, stats.PlayCount, stats.StealCount, stats.RejectCount);
+        }
+    }
+
+    // Returns false only when every voice is busy and the pool was created with VoiceStealPolicy.None.
+    public bool TryPlay(MiniaudioPcmBuffer clip, float volume = 1f, float pan = 0f)
+    {
+        ThrowIfDisposed();
+        ArgumentNullException.ThrowIfNull(clip);
+
+        if (clip.Channels != Channels || clip.SampleRate != SampleRate)
+        {
+            throw new ArgumentException($"Clip format ({clip.Channels} ch, {clip.SampleRate} Hz) does not match the voice pool ({Channels} ch, {SampleRate} Hz).", nameof(clip));
+        }
+
+        var result = NativeMethods.VoicePoolPlay(_handle!, clip.DangerousHandle, volume, pan);
+        if (result == NativeMethods.ResultBusy)
+        {
+            return false;
+        }
+
+        result.EnsureSuccess(nameof(TryPlay));
+        return true;
+    }
+
+    // Routes every voice of the pool into the target, typically a MiniaudioSoundGroup.
+    public void AttachOutputTo(MiniaudioNode target, uint targetInputBus = 0)
+    {
+        ThrowIfDisposed();
+        ArgumentNullException.ThrowIfNull(target);
+
+        if (!ReferenceEquals(target.Engine, _engine))
+        {
+            throw new ArgumentException("The target node belongs to a different engine.", nameof(target));
+        }
+
+        target.UseNode(node => NativeMethods.VoicePoolAttachOutput(_handle!, node, targetInputBus)).EnsureSuccess(nameof(AttachOutputTo));
+    }
+
+    public void StopAll()
+    {
+        ThrowIfDisposed();
+        NativeMethods.VoicePoolStopAll(_handle!).EnsureSuccess(nameof(StopAll));
+    }
+
+    public void Dispose()
+    {
+        if (_handle is null)
+        {
+            return;
+        }
+
+        _handle.Dispose();
+        _handle = null;
+        GC.SuppressFinalize(this);
+    }
+
+    private void ThrowIfDisposed()
+    {
+        if (_handle is null || _handle.IsClosed)
+        {
+            throw new ObjectDisposedException(nameof(MiniaudioVoicePool));
+        }
+    }
+
+    public readonly struct VoicePoolStatistics
+    {
+        public VoicePoolStatistics(uint capacity, uint activeVoices, ulong playCount, ulong stealCount, ulong rejectCount)
+        {
+            Capacity = capacity;
+            ActiveVoices = activeVoices;
+            PlayCount = playCount;
+            StealCount = stealCount;
+            RejectCount = rejectCount;
+        }
+
+        public uint Capacity { get; }
+
+        public uint ActiveVoices { get; }
+
+        public ulong PlayCount { get; }
+
+        public ulong StealCount { get; }
+
+        public ulong RejectCount { get; }
+    }
+}
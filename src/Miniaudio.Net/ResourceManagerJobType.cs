@@ -0,0 +1,15 @@
+namespace Miniaudio.Net;
+
+public enum ResourceManagerJobType
+{
+    Custom = 1,
+    LoadDataBufferNode = 2,
+    FreeDataBufferNode = 3,
+    PageDataBufferNode = 4,
+    LoadDataBuffer = 5,
+    FreeDataBuffer = 6,
+    LoadDataStream = 7,
+    FreeDataStream = 8,
+    PageDataStream = 9,
+    SeekDataStream = 10,
+}
@@ -0,0 +1,8 @@
+namespace Miniaudio.Net;
+
+public enum VoiceStealPolicy
+{
+    None = 0,
+    Oldest = 1,
+    Quietest = 2,
+}
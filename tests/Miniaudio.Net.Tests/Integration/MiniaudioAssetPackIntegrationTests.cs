@@ -0,0 +1,122 @@
+using NUnit.Framework;
+using Miniaudio.Net;
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Text;
+
+namespace Miniaudio.Net.Tests.Integration;
+
+/// <summary>
+/// MiniaudioAssetPackのインテグレーションテスト。
+/// これらのテストはネイティブライブラリが必要です。
+/// </summary>
+[TestFixture]
+[Category("Integration")]
+public class MiniaudioAssetPackIntegrationTests
+{
+    private string _directory = string.Empty;
+    private string _packPath = string.Empty;
+    private string _loosePath = string.Empty;
+
+    [SetUp]
+    public void SetUp()
+    {
+        _directory = Path.Combine(Path.GetTempPath(), $"manet-pack-{Guid.NewGuid():N}");
+        Directory.CreateDirectory(_directory);
+
+        var quiet = Path.Combine(_directory, "quiet.wav");
+        var loud = Path.Combine(_directory, "loud.wav");
+        File.WriteAllBytes(quiet, TestAudio.CreateConstantWav(8192, 2, 48000, 4800));
+        File.WriteAllBytes(loud, TestAudio.CreateConstantWav(16384, 2, 48000, 4800));
+        _loosePath = loud;
+
+        _packPath = Path.Combine(_directory, "assets.pak");
+        MiniaudioAssetPack.Build(_packPath, new Dictionary<string, string>
+        {
+            ["sfx/quiet.wav"] = quiet,
+            ["bgm/loud.wav"] = loud,
+        });
+    }
+
+    [TearDown]
+    public void TearDown()
+    {
+        Directory.Delete(_directory, recursive: true);
+    }
+
+    [Test]
+    public void Open_ListsBuiltEntries()
+    {
+        using var pack = MiniaudioAssetPack.Open(_packPath);
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(pack.Count, Is.EqualTo(2));
+            Assert.That(pack.Contains("sfx/quiet.wav"), Is.True);
+            Assert.That(pack.Contains("pack://bgm/loud.wav"), Is.True);
+            Assert.That(pack.Contains("sfx/missing.wav"), Is.False);
+        });
+    }
+
+    [Test]
+    public void Open_InvalidFile_Throws()
+    {
+        var bogus = Path.Combine(_directory, "bogus.pak");
+        File.WriteAllBytes(bogus, Encoding.ASCII.GetBytes("not a pack file"));
+
+        Assert.Throws<InvalidOperationException>(() => MiniaudioAssetPack.Open(bogus));
+    }
+
+    [Test]
+    public void Build_DuplicateName_Throws()
+    {
+        var entries = new List<KeyValuePair<string, string>>
+        {
+            new("a.wav", _loosePath),
+            new("a.wav", _loosePath),
+        };
+
+        Assert.Throws<ArgumentException>(() => MiniaudioAssetPack.Build(Path.Combine(_directory, "dup.pak"), entries));
+    }
+
+    [TestCase(SoundInitFlags.Decode)]
+    [TestCase(SoundInitFlags.Stream)]
+    public void CreateSound_ResolvesPackPaths(SoundInitFlags loadFlags)
+    {
+        MiniaudioResourceManager manager;
+        using (var pack = MiniaudioAssetPack.Open(_packPath))
+        {
+            manager = MiniaudioResourceManager.Create(new MiniaudioResourceManagerOptions { AssetPack = pack });
+        }
+
+        // パックを破棄してもリソースマネージャーがマッピングを保持する。
+        using (manager)
+        using (var engine = TestAudio.CreateEngine(manager))
+        {
+            using var quiet = engine.CreateSound("pack://sfx/quiet.wav", loadFlags | SoundInitFlags.NoSpatialization | SoundInitFlags.NoPitch);
+            quiet.Start();
+
+            var output = new float[1024 * 2];
+            engine.Render(output);
+
+            Assert.That(output[512 * 2], Is.EqualTo(0.25f).Within(1e-3f));
+            Assert.Throws<InvalidOperationException>(() => engine.CreateSound("pack://sfx/missing.wav", loadFlags));
+        }
+    }
+
+    [Test]
+    public void CreateSound_NonPackPathsUseFileSystem()
+    {
+        using var pack = MiniaudioAssetPack.Open(_packPath);
+        using var manager = MiniaudioResourceManager.Create(new MiniaudioResourceManagerOptions { AssetPack = pack });
+        using var engine = TestAudio.CreateEngine(manager);
+        using var loose = engine.CreateSound(_loosePath, SoundInitFlags.Decode | SoundInitFlags.NoSpatialization | SoundInitFlags.NoPitch);
+
+        loose.Start();
+        var output = new float[1024 * 2];
+        engine.Render(output);
+
+        Assert.That(output[512 * 2], Is.EqualTo(0.5f).Within(1e-3f));
+    }
+}
@@ -0,0 +1,219 @@
+using NUnit.Framework;
+using Miniaudio.Net;
+using System;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace Miniaudio.Net.Tests.Integration;
+
+/// <summary>
+/// キャプチャイベントとプル型キャプチャ(TryRead/ReadAsync)のインテグレーションテスト。
+/// Null バックエンドのデバイスを停止したまま使い、デバイススレッドと同じ経路でフレームを書き込みます。
+/// これらのテストは MANET_ENABLE_TEST_HOOKS を有効にしてビルドしたネイティブライブラリが必要です（無効な場合はスキップします）。
+/// </summary>
+[TestFixture]
+[Category("Integration")]
+public class MiniaudioCaptureDeviceIntegrationTests
+{
+    private const uint Channels = 2;
+
+    private MiniaudioContext _context = null!;
+
+    [SetUp]
+    public void SetUp()
+    {
+        _context = MiniaudioContext.Create(new[] { MiniaudioBackend.Null });
+    }
+
+    [TearDown]
+    public void TearDown()
+    {
+        _context?.Dispose();
+    }
+
+    [Test]
+    public void TryRead_ReturnsFramesInCaptureOrder()
+    {
+        using var capture = CreatePullDevice(256);
+        capture.WriteCapturedFrames(CreateRamp(0, 100));
+        capture.WriteCapturedFrames(CreateRamp(100, 60));
+
+        var first = new float[120 * Channels];
+        var second = new float[120 * Channels];
+        var firstRead = capture.TryRead(first);
+        var secondRead = capture.TryRead(second);
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(firstRead, Is.EqualTo(120));
+            Assert.That(secondRead, Is.EqualTo(40));
+            Assert.That(first, Is.EqualTo(CreateRamp(0, 120)));
+            Assert.That(second.AsSpan(0, 40 * (int)Channels).ToArray(), Is.EqualTo(CreateRamp(120, 40)));
+            Assert.That(capture.AvailableFramesToRead, Is.EqualTo(0u));
+        });
+    }
+
+    [Test]
+    public void TryRead_RingWrapsAround_KeepsOrder()
+    {
+        using var capture = CreatePullDevice(128);
+        var block = new float[96 * Channels];
+
+        capture.WriteCapturedFrames(CreateRamp(0, 96));
+        capture.TryRead(block);
+        capture.WriteCapturedFrames(CreateRamp(96, 96));
+        var read = capture.TryRead(block);
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(read, Is.EqualTo(96));
+            Assert.That(block, Is.EqualTo(CreateRamp(96, 96)));
+        });
+    }
+
+    [Test]
+    public void Overflow_DropsNewestFramesAndCountsThem()
+    {
+        using var capture = CreatePullDevice(128);
+        capture.WriteCapturedFrames(CreateRamp(0, 100));
+        capture.WriteCapturedFrames(CreateRamp(100, 100));
+
+        var destination = new float[200 * Channels];
+        var read = capture.TryRead(destination);
+
+        // リングが溢れた分(新しい側)が破棄され、古いフレームはそのまま残る。
+        Assert.Multiple(() =>
+        {
+            Assert.That(capture.DroppedFrames, Is.EqualTo(72UL));
+            Assert.That(read, Is.EqualTo(128));
+            Assert.That(destination.AsSpan(0, 128 * (int)Channels).ToArray(), Is.EqualTo(CreateRamp(0, 128)));
+        });
+    }
+
+    [Test]
+    public async Task ReadAsync_CompletesOnceWholeBlockIsQueued()
+    {
+        using var capture = CreatePullDevice(256);
+        var destination = new float[128 * Channels];
+
+        var read = capture.ReadAsync(destination).AsTask();
+        capture.WriteCapturedFrames(CreateRamp(0, 64));
+        await Task.Delay(50);
+        Assert.That(read.IsCompleted, Is.False);
+
+        capture.WriteCapturedFrames(CreateRamp(64, 64));
+        var completed = await Task.WhenAny(read, Task.Delay(TimeSpan.FromSeconds(5)));
+
+        Assert.That(completed, Is.SameAs(read));
+        Assert.Multiple(() =>
+        {
+            Assert.That(read.Result, Is.EqualTo(128));
+            Assert.That(destination, Is.EqualTo(CreateRamp(0, 128)));
+        });
+    }
+
+    [Test]
+    public void ReadAsync_AlreadyInProgress_Throws()
+    {
+        using var capture = CreatePullDevice(256);
+        using var cts = new CancellationTokenSource();
+
+        var pending = capture.ReadAsync(new float[128 * Channels], cts.Token).AsTask();
+
+        Assert.ThrowsAsync<InvalidOperationException>(async () => await capture.ReadAsync(new float[128 * Channels]));
+
+        cts.Cancel();
+        Assert.CatchAsync<OperationCanceledException>(async () => await pending);
+    }
+
+    [Test]
+    public async Task ReadAsync_Cancelled_ReleasesGuard()
+    {
+        using var capture = CreatePullDevice(256);
+        using var cts = new CancellationTokenSource();
+
+        var pending = capture.ReadAsync(new float[128 * Channels], cts.Token).AsTask();
+        cts.Cancel();
+        Assert.CatchAsync<OperationCanceledException>(async () => await pending);
+
+        capture.WriteCapturedFrames(CreateRamp(0, 32));
+        var destination = new float[32 * Channels];
+        Assert.That(await capture.ReadAsync(destination), Is.EqualTo(32));
+    }
+
+    [Test]
+    public void PullMode_RejectsPcmCaptured()
+    {
+        using var capture = CreatePullDevice(256);
+
+        Assert.Throws<InvalidOperationException>(() => capture.PcmCaptured += (_, _) => { });
+    }
+
+    [Test]
+    public void SamplesCaptured_ReceivesWrittenFrames()
+    {
+        using var capture = MiniaudioCaptureDevice.Create(new MiniaudioCaptureDeviceOptions
+        {
+            Context = _context,
+            SampleRate = 48000,
+            Channels = Channels,
+        });
+        RequireTestHooks(capture);
+
+        float[]? received = null;
+        uint receivedChannels = 0;
+        capture.SamplesCaptured += (samples, channels) =>
+        {
+            received = samples.ToArray();
+            receivedChannels = channels;
+        };
+
+        capture.WriteCapturedFrames(CreateRamp(0, 64));
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(receivedChannels, Is.EqualTo(Channels));
+            Assert.That(received, Is.EqualTo(CreateRamp(0, 64)));
+        });
+    }
+
+    private MiniaudioCaptureDevice CreatePullDevice(uint capacityInFrames)
+    {
+        var capture = MiniaudioCaptureDevice.Create(new MiniaudioCaptureDeviceOptions
+        {
+            Context = _context,
+            SampleRate = 48000,
+            Channels = Channels,
+            CaptureBufferCapacityInFrames = capacityInFrames,
+        });
+
+        RequireTestHooks(capture);
+        return capture;
+    }
+
+    // フレームの書き込みはテスト用エクスポートなので、含まれていないネイティブライブラリではスキップする。
+    private static void RequireTestHooks(MiniaudioCaptureDevice capture)
+    {
+        try
+        {
+            capture.WriteCapturedFrames(ReadOnlySpan<float>.Empty);
+        }
+        catch (EntryPointNotFoundException)
+        {
+            capture.Dispose();
+            Assert.Ignore("The native library was built without MANET_ENABLE_TEST_HOOKS.");
+        }
+    }
+
+    private static float[] CreateRamp(int firstFrame, int frameCount)
+    {
+        var samples = new float[frameCount * Channels];
+        for (var frame = 0; frame < frameCount; frame++)
+        {
+            samples[frame * Channels] = firstFrame + frame;
+            samples[frame * Channels + 1] = -(firstFrame + frame);
+        }
+
+        return samples;
+    }
+}
@@ -0,0 +1,210 @@
+using NUnit.Framework;
+using Miniaudio.Net;
+using System;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+
+namespace Miniaudio.Net.Tests.Integration;
+
+/// <summary>
+/// UnmanagedCallersOnly 関数で処理するカスタムノードのインテグレーションテスト。
+/// これらのテストはネイティブライブラリが必要です。
+/// </summary>
+[TestFixture]
+[Category("Integration")]
+public unsafe class MiniaudioCustomNodeIntegrationTests
+{
+    [Test]
+    public void Process_AppliesGainFromUserData()
+    {
+        var gain = (float*)NativeMemory.Alloc(sizeof(float));
+        *gain = 0.5f;
+        try
+        {
+            using var engine = TestAudio.CreateEngine();
+            using var node = engine.CreateCustomNode(&ApplyGain, (IntPtr)gain);
+            using var sound = TestAudio.CreateConstantSound(engine, 0.25f);
+
+            sound.AttachOutputBus(node);
+            node.AttachOutputBus(engine.Endpoint);
+            sound.Start();
+
+            Assert.Multiple(() =>
+            {
+                Assert.That(node.Channels, Is.EqualTo(2u));
+                Assert.That(node.UserData, Is.EqualTo((IntPtr)gain));
+                Assert.That(TestAudio.RenderMiddleSample(engine), Is.EqualTo(0.125f).Within(1e-6f));
+            });
+
+            *gain = 2f;
+            Assert.That(TestAudio.RenderMiddleSample(engine), Is.EqualTo(0.5f).Within(1e-6f));
+        }
+        finally
+        {
+            NativeMemory.Free(gain);
+        }
+    }
+
+    [Test]
+    public void Process_ReceivesEveryInputBus()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var node = engine.CreateCustomNode(&Subtract, inputBusCount: 2);
+        using var first = TestAudio.CreateConstantSound(engine, 0.25f);
+        using var second = TestAudio.CreateConstantSound(engine, 0.1f);
+
+        first.AttachOutputBus(0, node, 0);
+        second.AttachOutputBus(0, node, 1);
+        node.AttachOutputBus(engine.Endpoint);
+        first.Start();
+        second.Start();
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(node.InputBusCount, Is.EqualTo(2u));
+            Assert.That(TestAudio.RenderMiddleSample(engine), Is.EqualTo(0.15f).Within(1e-6f));
+        });
+    }
+
+    [Test]
+    public void Process_WritesEveryOutputBus()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var node = engine.CreateCustomNode(&CopyAndDouble, outputBusCount: 2);
+        using var sound = TestAudio.CreateConstantSound(engine, 0.25f);
+
+        sound.AttachOutputBus(node);
+        node.AttachOutputBus(0, engine.Endpoint);
+        node.AttachOutputBus(1, engine.Endpoint);
+        sound.Start();
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(node.OutputBusCount, Is.EqualTo(2u));
+            Assert.That(TestAudio.RenderMiddleSample(engine), Is.EqualTo(0.75f).Within(1e-6f));
+        });
+    }
+
+    [Test]
+    public void Process_WithoutInputBuses_ActsAsSource()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var node = engine.CreateCustomNode(&Generate, inputBusCount: 0);
+
+        node.AttachOutputBus(engine.Endpoint);
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(node.InputBusCount, Is.EqualTo(0u));
+            Assert.That(TestAudio.RenderMiddleSample(engine), Is.EqualTo(0.2f).Within(1e-6f));
+        });
+    }
+
+    [Test]
+    public void ContinuousProcessing_RunsWithoutInput()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var idle = engine.CreateCustomNode(&AddOffset);
+        using var continuous = engine.CreateCustomNode(&AddOffset, flags: CustomNodeFlags.ContinuousProcessing);
+
+        idle.AttachOutputBus(engine.Endpoint);
+        continuous.AttachOutputBus(engine.Endpoint);
+
+        var output = new float[1024 * 2];
+        engine.Render(output);
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(output[0], Is.EqualTo(0.2f).Within(1e-6f));
+            Assert.That(output[1023 * 2], Is.EqualTo(0.2f).Within(1e-6f));
+        });
+    }
+
+    [Test]
+    public void Create_InvalidArguments_Throw()
+    {
+        using var engine = TestAudio.CreateEngine();
+
+        Assert.Multiple(() =>
+        {
+            Assert.Throws<ArgumentNullException>(() => engine.CreateCustomNode(null));
+            Assert.Throws<ArgumentOutOfRangeException>(() => engine.CreateCustomNode(&ApplyGain, outputBusCount: 0));
+            Assert.Throws<ArgumentOutOfRangeException>(() => engine.CreateCustomNode(&ApplyGain, inputBusCount: 255));
+            Assert.Throws<ArgumentOutOfRangeException>(() => engine.CreateCustomNode(&ApplyGain, flags: (CustomNodeFlags)0x4));
+        });
+    }
+
+    [Test]
+    public void Dispose_DetachesNodeFromGraph()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var sound = TestAudio.CreateConstantSound(engine, 0.25f);
+        var node = engine.CreateCustomNode(&CopyAndDouble, outputBusCount: 2);
+
+        sound.AttachOutputBus(node);
+        node.AttachOutputBus(engine.Endpoint);
+        sound.Start();
+        node.Dispose();
+        node.Dispose();
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(TestAudio.RenderMiddleSample(engine), Is.EqualTo(0f).Within(1e-6f));
+            Assert.Throws<ObjectDisposedException>(() => node.AttachOutputBus(engine.Endpoint));
+        });
+    }
+
+    [UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+    private static void ApplyGain(CustomNodeProcessContext* context)
+    {
+        var gain = *(float*)context->UserData;
+        var input = context->GetInput(0);
+        var output = context->GetOutput(0);
+        for (var i = 0; i < output.Length; i++)
+        {
+            output[i] = input[i] * gain;
+        }
+    }
+
+    [UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+    private static void Subtract(CustomNodeProcessContext* context)
+    {
+        var left = context->GetInput(0);
+        var right = context->GetInput(1);
+        var output = context->GetOutput(0);
+        for (var i = 0; i < output.Length; i++)
+        {
+            output[i] = left[i] - right[i];
+        }
+    }
+
+    [UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+    private static void CopyAndDouble(CustomNodeProcessContext* context)
+    {
+        var input = context->GetInput(0);
+        var copy = context->GetOutput(0);
+        var doubled = context->GetOutput(1);
+        for (var i = 0; i < input.Length; i++)
+        {
+            copy[i] = input[i];
+            doubled[i] = input[i] * 2;
+        }
+    }
+
+    [UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+    private static void Generate(CustomNodeProcessContext* context)
+    {
+        context->GetOutput(0).Fill(0.2f);
+    }
+
+    [UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+    private static void AddOffset(CustomNodeProcessContext* context)
+    {
+        var input = context->GetInput(0);
+        var output = context->GetOutput(0);
+        for (var i = 0; i < output.Length; i++)
+        {
+            output[i] = input[i] + 0.2f;
+        }
+    }
+}
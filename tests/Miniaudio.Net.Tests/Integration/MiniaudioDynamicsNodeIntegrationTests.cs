@@ -0,0 +1,227 @@
+using NUnit.Framework;
+using Miniaudio.Net;
+using System;
+using System.Linq;
+
+namespace Miniaudio.Net.Tests.Integration;
+
+/// <summary>
+/// リミッター/コンプレッサーノードのインテグレーションテスト。
+/// これらのテストはネイティブライブラリが必要です。
+/// </summary>
+[TestFixture]
+[Category("Integration")]
+public class MiniaudioDynamicsNodeIntegrationTests
+{
+    [Test]
+    public void Limiter_HoldsStackedVoicesAtCeiling()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var master = engine.CreateSoundGroup(flags: TestAudio.NodeFlags);
+        using var limiter = engine.CreateLimiter(ceilingDb: -6f, lookaheadFrames: 240);
+        using var first = TestAudio.CreateSound(engine, TestAudio.CreateConstantFrames(0.6f));
+        using var second = TestAudio.CreateSound(engine, TestAudio.CreateConstantFrames(0.6f));
+
+        first.AttachOutputBus(master);
+        second.AttachOutputBus(master);
+        master.AttachOutputBus(limiter);
+        limiter.AttachOutputBus(engine.Endpoint);
+        first.Start();
+        second.Start();
+
+        var output = TestAudio.Render(engine, 4096);
+        var ceiling = MathF.Pow(10, -6f / 20);
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(output.Max(MathF.Abs), Is.LessThanOrEqualTo(ceiling + 1e-5f));
+            Assert.That(output[^2], Is.EqualTo(ceiling).Within(1e-4f));
+            Assert.That(limiter.ReadMaxGainReductionDb(), Is.EqualTo(20 * MathF.Log10(1.2f / ceiling)).Within(0.01f));
+            Assert.That(limiter.ReadMaxGainReductionDb(), Is.EqualTo(0f));
+        });
+    }
+
+    [Test]
+    public void Limiter_BelowCeiling_OnlyDelaysSignal()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var limiter = engine.CreateLimiter(lookaheadFrames: 100);
+        using var sound = TestAudio.CreateSound(engine, TestAudio.CreateConstantFrames(0.25f));
+
+        RouteThrough(sound, limiter, engine);
+        sound.Start();
+
+        var output = TestAudio.Render(engine, 1024);
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(limiter.LookaheadFrames, Is.EqualTo(100u));
+            Assert.That(output[99 * 2], Is.EqualTo(0f));
+            Assert.That(output[100 * 2], Is.EqualTo(0.25f).Within(1e-6f));
+            Assert.That(output[1023 * 2], Is.EqualTo(0.25f).Within(1e-6f));
+            Assert.That(limiter.ReadMaxGainReductionDb(), Is.EqualTo(0f));
+        });
+    }
+
+    [Test]
+    public void Limiter_CatchesTransientWithinLookahead()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var limiter = engine.CreateLimiter(ceilingDb: -3f, releaseMilliseconds: 20f, lookaheadFrames: 64);
+        var samples = TestAudio.CreateConstantFrames(0.1f);
+        for (var i = 3000 * 2; i < 3010 * 2; i++)
+        {
+            samples[i] = i % 2 == 0 ? 1.0f : -0.9f;
+        }
+
+        using var sound = TestAudio.CreateSound(engine, samples);
+        RouteThrough(sound, limiter, engine);
+        sound.Start();
+
+        var output = TestAudio.Render(engine, 8192);
+        var ceiling = MathF.Pow(10, -3f / 20);
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(output.Max(MathF.Abs), Is.LessThanOrEqualTo(ceiling + 1e-5f));
+            Assert.That(output[(3005 + 64) * 2], Is.EqualTo(ceiling).Within(1e-4f));
+            Assert.That(output[8000 * 2], Is.EqualTo(0.1f).Within(1e-3f));
+        });
+    }
+
+    [Test]
+    public void Compressor_AppliesRatioAboveThreshold()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var compressor = engine.CreateCompressor(thresholdDb: -12f, ratio: 4f, attackMilliseconds: 0f, makeupGainDb: 3f);
+        using var sound = TestAudio.CreateSound(engine, TestAudio.CreateConstantFrames(0.5f));
+
+        RouteThrough(sound, compressor, engine);
+        sound.Start();
+
+        var threshold = MathF.Pow(10, -12f / 20);
+        var compressed = threshold * MathF.Pow(0.5f / threshold, 1f / 4f);
+        var makeup = MathF.Pow(10, 3f / 20);
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(TestAudio.RenderMiddleSample(engine), Is.EqualTo(compressed * makeup).Within(1e-4f));
+            Assert.That(compressor.ReadMaxGainReductionDb(), Is.EqualTo(20 * MathF.Log10(0.5f / compressed)).Within(0.01f));
+        });
+
+        compressor.Ratio = 1f;
+        Assert.That(TestAudio.RenderMiddleSample(engine), Is.EqualTo(0.5f * makeup).Within(1e-4f));
+    }
+
+    [Test]
+    public void Compressor_BelowThreshold_AppliesOnlyMakeup()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var compressor = engine.CreateCompressor(thresholdDb: -6f, makeupGainDb: -6f);
+        using var sound = TestAudio.CreateSound(engine, TestAudio.CreateConstantFrames(0.25f));
+
+        RouteThrough(sound, compressor, engine);
+        sound.Start();
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(compressor.ThresholdDb, Is.EqualTo(-6f));
+            Assert.That(TestAudio.RenderMiddleSample(engine), Is.EqualTo(0.25f * MathF.Pow(10, -6f / 20)).Within(1e-5f));
+            Assert.That(compressor.ReadMaxGainReductionDb(), Is.EqualTo(0f).Within(1e-4f));
+        });
+    }
+
+    [Test]
+    public void Kernels_MatchScalarReference()
+    {
+        var reference = RenderWithKernels(DynamicsKernel.Scalar);
+        Assert.That(MiniaudioDynamicsNode.IsKernelSupported(DynamicsKernel.Scalar), Is.True);
+
+        foreach (var kernel in new[] { DynamicsKernel.Sse2, DynamicsKernel.Avx2, DynamicsKernel.Neon })
+        {
+            if (!MiniaudioDynamicsNode.IsKernelSupported(kernel))
+            {
+                continue;
+            }
+
+            var output = RenderWithKernels(kernel);
+            for (var i = 0; i < output.Length; i++)
+            {
+                Assert.That(output[i], Is.EqualTo(reference[i]).Within(1e-4f), $"{kernel} sample {i}");
+            }
+        }
+    }
+
+    [Test]
+    public void Create_InvalidArguments_Throw()
+    {
+        using var engine = TestAudio.CreateEngine();
+
+        Assert.Multiple(() =>
+        {
+            Assert.Throws<ArgumentOutOfRangeException>(() => engine.CreateLimiter(ceilingDb: float.NaN));
+            Assert.Throws<ArgumentOutOfRangeException>(() => engine.CreateLimiter(releaseMilliseconds: -1f));
+            Assert.Throws<ArgumentOutOfRangeException>(() => engine.CreateLimiter(lookaheadFrames: 48001));
+            Assert.Throws<ArgumentOutOfRangeException>(() => engine.CreateCompressor(ratio: 0.5f));
+            Assert.Throws<ArgumentOutOfRangeException>(() => engine.CreateCompressor(attackMilliseconds: float.PositiveInfinity));
+
+            // 範囲外のレベルは線形値がアンダーフロー/オーバーフローし、ゲイン計算が NaN になる。
+            Assert.Throws<ArgumentOutOfRangeException>(() => engine.CreateLimiter(ceilingDb: -120f));
+            Assert.Throws<ArgumentOutOfRangeException>(() => engine.CreateLimiter(ceilingDb: 6f));
+            Assert.Throws<ArgumentOutOfRangeException>(() => engine.CreateCompressor(thresholdDb: -1000f));
+            Assert.Throws<ArgumentOutOfRangeException>(() => engine.CreateCompressor(makeupGainDb: 400f));
+        });
+
+        using var compressor = engine.CreateCompressor();
+        Assert.Throws<ArgumentOutOfRangeException>(() => compressor.Ratio = 0f);
+        Assert.Throws<ArgumentOutOfRangeException>(() => compressor.ThresholdDb = 1f);
+
+        using var limiter = engine.CreateLimiter(ceilingDb: MiniaudioDynamicsNode.MinLevelDb);
+        Assert.That(limiter.CeilingDb, Is.EqualTo(-96f));
+
+        foreach (var kernel in Enum.GetValues<DynamicsKernel>().Where(k => k != DynamicsKernel.Auto && !MiniaudioDynamicsNode.IsKernelSupported(k)))
+        {
+            Assert.Throws<NotSupportedException>(() => engine.CreateLimiter(kernel: kernel));
+        }
+    }
+
+    private static float[] RenderWithKernels(DynamicsKernel kernel)
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var compressor = engine.CreateCompressor(thresholdDb: -20f, ratio: 6f, attackMilliseconds: 1f, releaseMilliseconds: 30f, makeupGainDb: 4f, kernel: kernel);
+        using var limiter = engine.CreateLimiter(ceilingDb: -2f, releaseMilliseconds: 10f, lookaheadFrames: 37, kernel: kernel);
+        using var sound = TestAudio.CreateSound(engine, CreateBurstFrames());
+
+        Assert.That(compressor.Kernel, Is.EqualTo(kernel));
+        sound.AttachOutputBus(compressor);
+        compressor.AttachOutputBus(limiter);
+        limiter.AttachOutputBus(engine.Endpoint);
+        sound.Start();
+
+        // Odd block sizes leave remainders for the scalar tails of the vector loops.
+        var output = new float[333 * 2 * 12];
+        for (var block = 0; block < 12; block++)
+        {
+            engine.Render(output.AsSpan(block * 333 * 2, 333 * 2));
+        }
+
+        return output;
+    }
+
+    private static void RouteThrough(MiniaudioNode source, MiniaudioNode effect, MiniaudioEngine engine)
+    {
+        source.AttachOutputBus(effect);
+        effect.AttachOutputBus(engine.Endpoint);
+    }
+
+    // 50ms ごとに大音量と小音量を切り替え、アタックとリリースの両方を通す。
+    private static float[] CreateBurstFrames()
+    {
+        static float Envelope(int frame) => frame % 4800 < 2400 ? 1.2f : 0.05f;
+
+        return TestAudio.CreateFrames(
+            frame => Envelope(frame) * MathF.Sin(2 * MathF.PI * 440 * frame / TestAudio.SampleRate),
+            frame => Envelope(frame) * MathF.Sin(2 * MathF.PI * 660 * frame / TestAudio.SampleRate),
+            (int)TestAudio.SampleRate);
+    }
+}
@@ -0,0 +1,191 @@
+using NUnit.Framework;
+using Miniaudio.Net;
+using System;
+
+namespace Miniaudio.Net.Tests.Integration;
+
+/// <summary>
+/// 組み込みエフェクトノード(フィルター・EQ・ディレイ)のインテグレーションテスト。
+/// これらのテストはネイティブライブラリが必要です。
+/// </summary>
+[TestFixture]
+[Category("Integration")]
+public class MiniaudioEffectNodeIntegrationTests
+{
+    [Test]
+    public void LowPassFilter_PassesDcAndKeepsParameters()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var filter = engine.CreateLowPassFilter(1000, order: 4);
+        using var sound = TestAudio.CreateConstantSound(engine, 0.25f);
+
+        RouteThrough(sound, filter, engine);
+        sound.Start();
+        TestAudio.RenderMiddleSample(engine);
+
+        filter.CutoffFrequency = 2000;
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(filter.Order, Is.EqualTo(4u));
+            Assert.That(filter.Channels, Is.EqualTo(2u));
+            Assert.That(filter.CutoffFrequency, Is.EqualTo(2000d));
+            Assert.That(TestAudio.RenderMiddleSample(engine), Is.EqualTo(0.25f).Within(1e-3f));
+        });
+    }
+
+    [Test]
+    public void HighPassFilter_RemovesDc()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var filter = engine.CreateHighPassFilter(1000);
+        using var sound = TestAudio.CreateConstantSound(engine, 0.25f);
+
+        RouteThrough(sound, filter, engine);
+        sound.Start();
+        TestAudio.RenderMiddleSample(engine);
+
+        Assert.That(TestAudio.RenderMiddleSample(engine), Is.EqualTo(0f).Within(1e-3f));
+    }
+
+    [Test]
+    public void Biquad_SetCoefficients_ChangesGainWhilePlaying()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var biquad = engine.CreateBiquad(1, 0, 0, 1, 0, 0);
+        using var sound = TestAudio.CreateConstantSound(engine, 0.25f);
+
+        RouteThrough(sound, biquad, engine);
+        sound.Start();
+        Assert.That(TestAudio.RenderMiddleSample(engine), Is.EqualTo(0.25f).Within(1e-5f));
+
+        biquad.SetCoefficients(1, 0, 0, 2, 0, 0);
+        Assert.That(TestAudio.RenderMiddleSample(engine), Is.EqualTo(0.125f).Within(1e-5f));
+    }
+
+    [Test]
+    public void PeakingEq_LeavesDcUnchanged()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var eq = engine.CreatePeakingEq(1000, 6);
+        using var sound = TestAudio.CreateConstantSound(engine, 0.25f);
+
+        RouteThrough(sound, eq, engine);
+        sound.Start();
+        TestAudio.RenderMiddleSample(engine);
+        eq.GainDb = -6;
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(eq.GainDb, Is.EqualTo(-6d));
+            Assert.That(eq.Frequency, Is.EqualTo(1000d));
+            Assert.That(TestAudio.RenderMiddleSample(engine), Is.EqualTo(0.25f).Within(1e-3f));
+        });
+    }
+
+    [Test]
+    public void Delay_OutputsInputAfterDelay()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var delay = engine.CreateDelay(700);
+        using var sound = TestAudio.CreateConstantSound(engine, 0.25f);
+
+        RouteThrough(sound, delay, engine);
+        delay.Wet = 0.5f;
+        sound.Start();
+
+        var output = new float[1024 * 2];
+        engine.Render(output);
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(delay.DelayInFrames, Is.EqualTo(700u));
+            Assert.That(delay.Wet, Is.EqualTo(0.5f));
+            Assert.That(delay.Dry, Is.EqualTo(1f));
+            Assert.That(output[600 * 2], Is.EqualTo(0f).Within(1e-6f));
+            Assert.That(output[800 * 2], Is.EqualTo(0.125f).Within(1e-3f));
+        });
+    }
+
+    [Test]
+    public void EffectNode_WorksOnSoundGroupOutput()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var group = engine.CreateSoundGroup(flags: TestAudio.NodeFlags);
+        using var biquad = engine.CreateBiquad(0.5f, 0, 0, 1, 0, 0);
+        using var sound = TestAudio.CreateConstantSound(engine, 0.25f);
+
+        sound.AttachOutputBus(group);
+        RouteThrough(group, biquad, engine);
+        sound.Start();
+
+        Assert.That(TestAudio.RenderMiddleSample(engine), Is.EqualTo(0.125f).Within(1e-5f));
+    }
+
+    [Test]
+    public void Create_InvalidArguments_Throw()
+    {
+        using var engine = TestAudio.CreateEngine();
+
+        Assert.Multiple(() =>
+        {
+            Assert.Throws<ArgumentOutOfRangeException>(() => engine.CreateLowPassFilter(0));
+            Assert.Throws<ArgumentOutOfRangeException>(() => engine.CreateHighPassFilter(1000, order: 9));
+            Assert.Throws<ArgumentOutOfRangeException>(() => engine.CreatePeakingEq(1000, 3, q: 0));
+            Assert.Throws<ArgumentOutOfRangeException>(() => engine.CreateBiquad(1, 0, 0, 0, 0, 0));
+            Assert.Throws<ArgumentOutOfRangeException>(() => engine.CreateDelay(0));
+            Assert.Throws<ArgumentOutOfRangeException>(() => engine.CreateDelay(100, decay: 1));
+        });
+    }
+
+    [Test]
+    public void Frequencies_AtOrAboveNyquistOrNonFinite_Throw()
+    {
+        using var engine = TestAudio.CreateEngine();
+        var nyquist = engine.SampleRate / 2.0;
+        using var lowPass = engine.CreateLowPassFilter(1000);
+        using var highPass = engine.CreateHighPassFilter(1000);
+        using var peaking = engine.CreatePeakingEq(1000, 3);
+
+        Assert.Multiple(() =>
+        {
+            Assert.Throws<ArgumentOutOfRangeException>(() => engine.CreateLowPassFilter(nyquist));
+            Assert.Throws<ArgumentOutOfRangeException>(() => engine.CreateHighPassFilter(double.NaN));
+            Assert.Throws<ArgumentOutOfRangeException>(() => engine.CreatePeakingEq(double.PositiveInfinity, 3));
+            Assert.Throws<ArgumentOutOfRangeException>(() => lowPass.CutoffFrequency = nyquist + 1);
+            Assert.Throws<ArgumentOutOfRangeException>(() => highPass.CutoffFrequency = double.NaN);
+            Assert.Throws<ArgumentOutOfRangeException>(() => peaking.Frequency = nyquist);
+            Assert.Throws<ArgumentOutOfRangeException>(() => peaking.Q = double.PositiveInfinity);
+
+            // 失敗した設定は直前の値を保つ
+            Assert.That(lowPass.CutoffFrequency, Is.EqualTo(1000));
+            Assert.That(peaking.Frequency, Is.EqualTo(1000));
+        });
+
+        // ナイキスト直下は受け付ける
+        lowPass.CutoffFrequency = nyquist - 1;
+        Assert.That(lowPass.CutoffFrequency, Is.EqualTo(nyquist - 1));
+    }
+
+    [Test]
+    public void Dispose_ThrowsOnFurtherUse()
+    {
+        using var engine = TestAudio.CreateEngine();
+        var filter = engine.CreateLowPassFilter(1000);
+
+        filter.Dispose();
+        filter.Dispose();
+
+        Assert.Multiple(() =>
+        {
+            Assert.Throws<ObjectDisposedException>(() => filter.CutoffFrequency = 500);
+            Assert.Throws<ObjectDisposedException>(() => filter.AttachOutputBus(engine.Endpoint));
+        });
+    }
+
+    private static void RouteThrough(MiniaudioNode source, MiniaudioNode effect, MiniaudioEngine engine)
+    {
+        source.AttachOutputBus(effect);
+        effect.AttachOutputBus(engine.Endpoint);
+    }
+}
@@ -1,6 +1,8 @@
 using NUnit.Framework;
 using Miniaudio.Net;
 using System;
+using System.IO;
+using System.Threading.Tasks;
 
 namespace Miniaudio.Net.Tests.Integration;
 
@@ -115,6 +117,113 @@ public class MiniaudioEngineIntegrationTests
         Assert.That(sound, Is.Not.Null);
     }
 
+    [Test]
+    public void CreateSoundFromPcmBuffer_SharedBySounds_OutlivesBufferDispose()
+    {
+        var options = new MiniaudioEngineOptions
+        {
+            NoDevice = true,
+            SampleRate = 48000,
+            Channels = 2,
+        };
+
+        using var engine = MiniaudioEngine.Create(options);
+
+        var frames = new float[4800 * 2];
+        Array.Fill(frames, 0.25f);
+
+        MiniaudioSound first;
+        MiniaudioSound second;
+        using (var buffer = MiniaudioPcmBuffer.Create(frames, 2, 48000))
+        {
+            first = engine.CreateSoundFromPcmBuffer(buffer, SoundInitFlags.NoSpatialization | SoundInitFlags.NoPitch);
+            second = engine.CreateSoundFromPcmBuffer(buffer, SoundInitFlags.NoSpatialization | SoundInitFlags.NoPitch);
+            Assert.That(buffer.FrameCount, Is.EqualTo(4800UL));
+        }
+
+        using (first)
+        using (second)
+        {
+            first.Start();
+            second.Start();
+
+            var output = new float[1024 * 2];
+            engine.Render(output);
+
+            Assert.That(output[512 * 2], Is.EqualTo(0.5f).Within(1e-4f));
+        }
+    }
+
+    [Test]
+    public void CreateSoundFromPcmMemory_ReadsCallerBufferWithoutCopy()
+    {
+        var options = new MiniaudioEngineOptions
+        {
+            NoDevice = true,
+            SampleRate = 48000,
+            Channels = 2,
+        };
+
+        using var engine = MiniaudioEngine.Create(options);
+
+        var frames = new float[4800 * 2];
+        using var sound = engine.CreateSoundFromPcmMemory(frames, 2, 48000, SoundInitFlags.NoSpatialization | SoundInitFlags.NoPitch);
+
+        // 生成後に書き換えた内容が再生されることで、コピーされていないことを確認する
+        Array.Fill(frames, -0.5f);
+        sound.Start();
+
+        var output = new float[1024 * 2];
+        engine.Render(output);
+
+        Assert.That(output[512 * 2], Is.EqualTo(-0.5f).Within(1e-4f));
+    }
+
+    [Test]
+    public void CreateSoundFromPcmPlanes_InterleavesChannels()
+    {
+        var options = new MiniaudioEngineOptions
+        {
+            NoDevice = true,
+            SampleRate = 48000,
+            Channels = 2,
+        };
+
+        using var engine = MiniaudioEngine.Create(options);
+
+        var left = new float[4800];
+        var right = new float[4800];
+        Array.Fill(left, 0.5f);
+        Array.Fill(right, -0.5f);
+
+        using var sound = engine.CreateSoundFromPcmPlanes(new ReadOnlyMemory<float>[] { left, right }, 48000, SoundInitFlags.NoSpatialization | SoundInitFlags.NoPitch);
+        sound.Start();
+
+        var output = new float[1024 * 2];
+        engine.Render(output);
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(output[512 * 2], Is.EqualTo(0.5f).Within(1e-4f));
+            Assert.That(output[512 * 2 + 1], Is.EqualTo(-0.5f).Within(1e-4f));
+        });
+    }
+
+    [Test]
+    public void CreateSoundFromPcmPlanes_MismatchedPlaneLengths_Throws()
+    {
+        var options = new MiniaudioEngineOptions
+        {
+            NoDevice = true,
+            SampleRate = 48000,
+            Channels = 2,
+        };
+
+        using var engine = MiniaudioEngine.Create(options);
+
+        Assert.Throws<ArgumentException>(() => engine.CreateSoundFromPcmPlanes(new ReadOnlyMemory<float>[] { new float[16], new float[8] }, 48000));
+    }
+
     [Test]
     public void GetAbsoluteTimeInFrames_ReturnsValue()
     {
@@ -162,6 +271,314 @@ public class MiniaudioEngineIntegrationTests
         Assert.DoesNotThrow(() => engine.SetTime(TimeSpan.FromSeconds(1)));
     }
 
+    [Test]
+    public void Render_NoDeviceMode_MixesPlayingSound()
+    {
+        var options = new MiniaudioEngineOptions
+        {
+            NoDevice = true,
+            SampleRate = 48000,
+            Channels = 2,
+        };
+
+        using var engine = MiniaudioEngine.Create(options);
+        var pcmData = GenerateSineWave(440, 48000, 2, 0.5);
+        using var sound = engine.CreateSoundFromPcmFrames(pcmData, 2, 48000);
+        sound.Start();
+
+        var output = new float[4800 * 2];
+        var framesRead = engine.Render(output);
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(framesRead, Is.EqualTo(4800UL));
+            Assert.That(output.Any(sample => sample != 0f), Is.True);
+            Assert.That(engine.TimeInPcmFrames, Is.EqualTo(4800UL));
+        });
+    }
+
+    [Test]
+    public void Render_LengthNotDivisibleByChannels_Throws()
+    {
+        var options = new MiniaudioEngineOptions
+        {
+            NoDevice = true,
+            SampleRate = 48000,
+            Channels = 2,
+        };
+
+        using var engine = MiniaudioEngine.Create(options);
+
+        Assert.Throws<ArgumentException>(() => engine.Render(new float[3]));
+    }
+
+    [Test]
+    public void CreateSound_FromEncodedWav_DecodesFromMemory()
+    {
+        var options = new MiniaudioEngineOptions
+        {
+            NoDevice = true,
+            SampleRate = 48000,
+            Channels = 2,
+        };
+
+        using var engine = MiniaudioEngine.Create(options);
+        var wav = TestAudio.CreateConstantWav(16384, 2, 48000, 4800);
+
+        using var sound = engine.CreateSound(wav, "memory://constant.wav", SoundInitFlags.Decode | SoundInitFlags.NoSpatialization | SoundInitFlags.NoPitch);
+        sound.Start();
+
+        var output = new float[1024 * 2];
+        engine.Render(output);
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(engine.IsDataRegistered("memory://constant.wav"), Is.True);
+            Assert.That(output[512 * 2], Is.EqualTo(0.5f).Within(1e-3f));
+        });
+    }
+
+    [Test]
+    public void RegisterEncodedData_DuplicateName_Throws()
+    {
+        var options = new MiniaudioEngineOptions
+        {
+            NoDevice = true,
+            SampleRate = 48000,
+            Channels = 2,
+        };
+
+        using var engine = MiniaudioEngine.Create(options);
+        var wav = TestAudio.CreateConstantWav(0, 1, 48000, 480);
+        engine.RegisterEncodedData("dup.wav", wav);
+
+        Assert.Throws<MiniaudioException>(() => engine.RegisterEncodedData("dup.wav", wav));
+    }
+
+    [Test]
+    public void CreateSound_FromEncodedWav_SameNameSharesIdenticalDataAndRejectsDifferentData()
+    {
+        var options = new MiniaudioEngineOptions
+        {
+            NoDevice = true,
+            SampleRate = 48000,
+            Channels = 2,
+        };
+
+        using var engine = MiniaudioEngine.Create(options);
+        const SoundInitFlags flags = SoundInitFlags.Decode | SoundInitFlags.NoSpatialization | SoundInitFlags.NoPitch;
+        var wav = TestAudio.CreateConstantWav(8192, 2, 48000, 480);
+
+        using var first = engine.CreateSound(wav, "shared.wav", flags);
+        using var second = engine.CreateSound((byte[])wav.Clone(), "shared.wav", flags);
+
+        // 同じ長さでも中身が異なれば別アセットとして扱い、黙って既存データを返さない。
+        Assert.Throws<ArgumentException>(() => engine.CreateSound(TestAudio.CreateConstantWav(-8192, 2, 48000, 480), "shared.wav", flags));
+        Assert.Throws<ArgumentException>(() => engine.CreateSound(TestAudio.CreateConstantWav(8192, 2, 48000, 960), "shared.wav", flags));
+    }
+
+    [Test]
+    public void UnregisterData_WhileSoundAlive_SoundKeepsPlaying()
+    {
+        var options = new MiniaudioEngineOptions
+        {
+            NoDevice = true,
+            SampleRate = 48000,
+            Channels = 2,
+        };
+
+        using var engine = MiniaudioEngine.Create(options);
+        engine.RegisterEncodedData("transient.wav", TestAudio.CreateConstantWav(-8192, 2, 48000, 4800));
+        using var sound = engine.CreateSound("transient.wav", SoundInitFlags.NoSpatialization | SoundInitFlags.NoPitch);
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(engine.UnregisterData("transient.wav"), Is.True);
+            Assert.That(engine.UnregisterData("transient.wav"), Is.False);
+        });
+
+        sound.Start();
+        var output = new float[1024 * 2];
+        engine.Render(output);
+
+        Assert.That(output[512 * 2], Is.EqualTo(-0.25f).Within(1e-3f));
+    }
+
+    [Test]
+    public void CreateInstance_FromDecodedAsset_PlaysAfterSourceDisposed()
+    {
+        var options = new MiniaudioEngineOptions
+        {
+            NoDevice = true,
+            SampleRate = 48000,
+            Channels = 2,
+        };
+
+        using var engine = MiniaudioEngine.Create(options);
+        var flags = SoundInitFlags.Decode | SoundInitFlags.NoSpatialization | SoundInitFlags.NoPitch;
+        var source = engine.CreateSound(TestAudio.CreateConstantWav(8192, 2, 48000, 4800), "instance.wav", flags);
+        using var first = source.CreateInstance();
+        using var second = first.CreateInstance();
+        source.Dispose();
+
+        first.Start();
+        second.Start();
+        var output = new float[1024 * 2];
+        engine.Render(output);
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(second.SourcePath, Is.EqualTo("instance.wav"));
+            Assert.That(output[512 * 2], Is.EqualTo(0.5f).Within(1e-3f));
+        });
+    }
+
+    [Test]
+    public void CreateInstance_FromPcmBufferSound_SharesBuffer()
+    {
+        var options = new MiniaudioEngineOptions
+        {
+            NoDevice = true,
+            SampleRate = 48000,
+            Channels = 2,
+        };
+
+        using var engine = MiniaudioEngine.Create(options);
+        var frames = new float[4800 * 2];
+        Array.Fill(frames, 0.125f);
+        using var buffer = MiniaudioPcmBuffer.Create(frames, 2, 48000);
+        using var sound = engine.CreateSoundFromPcmBuffer(buffer, SoundInitFlags.NoSpatialization | SoundInitFlags.NoPitch);
+        using var instance = sound.CreateInstance();
+
+        sound.Start();
+        instance.Start();
+        var output = new float[1024 * 2];
+        engine.Render(output);
+
+        Assert.That(output[512 * 2], Is.EqualTo(0.25f).Within(1e-3f));
+    }
+
+    [Test]
+    public void CreateInstance_StreamingSound_Throws()
+    {
+        var options = new MiniaudioEngineOptions
+        {
+            NoDevice = true,
+            SampleRate = 48000,
+            Channels = 2,
+        };
+
+        using var engine = MiniaudioEngine.Create(options);
+        using var streaming = engine.CreateStreamingSound(2, 48000, 4800);
+
+        Assert.Throws<InvalidOperationException>(() => streaming.CreateInstance());
+    }
+
+    [Test]
+    public async Task CreateSoundAsync_FromWavFile_CompletesWhenDecoded()
+    {
+        var options = new MiniaudioEngineOptions
+        {
+            NoDevice = true,
+            SampleRate = 48000,
+            Channels = 2,
+        };
+
+        var path = Path.Combine(Path.GetTempPath(), $"manet-async-{Guid.NewGuid():N}.wav");
+        File.WriteAllBytes(path, TestAudio.CreateConstantWav(8192, 2, 48000, 48000));
+
+        try
+        {
+            using var engine = MiniaudioEngine.Create(options);
+            using var sound = await engine.CreateSoundAsync(path, SoundInitFlags.Decode | SoundInitFlags.NoSpatialization | SoundInitFlags.NoPitch);
+
+            sound.Start();
+            var output = new float[1024 * 2];
+            engine.Render(output);
+
+            Assert.Multiple(() =>
+            {
+                Assert.That(sound.LengthInFrames, Is.EqualTo(48000ul));
+                Assert.That(output[512 * 2], Is.EqualTo(0.25f).Within(1e-3f));
+            });
+        }
+        finally
+        {
+            File.Delete(path);
+        }
+    }
+
+    [Test]
+    public async Task CreateSoundAsync_DisposedAsSoonAsLoaded_NextLoadCompletes()
+    {
+        using var engine = TestAudio.CreateEngine();
+        var path = TestAudio.WriteTempWav(8192, 1, 4800);
+
+        try
+        {
+            // 読み込み完了の直後に破棄しても、次の読み込みが完了することを繰り返し確認する。
+            for (var i = 0; i < 128; i++)
+            {
+                var sound = await engine.CreateSoundAsync(path, SoundInitFlags.Decode).WaitAsync(TimeSpan.FromSeconds(5));
+                sound.Dispose();
+            }
+        }
+        finally
+        {
+            File.Delete(path);
+        }
+    }
+
+    [Test]
+    public async Task PreloadAsync_MultipleAssets_ReturnsLoadedSounds()
+    {
+        var options = new MiniaudioEngineOptions
+        {
+            NoDevice = true,
+            SampleRate = 48000,
+            Channels = 2,
+        };
+
+        using var engine = MiniaudioEngine.Create(options);
+        engine.RegisterEncodedData("preload-a.wav", TestAudio.CreateConstantWav(4096, 2, 48000, 2400));
+        engine.RegisterEncodedData("preload-b.wav", TestAudio.CreateConstantWav(4096, 1, 48000, 4800));
+
+        var sounds = await engine.PreloadAsync(new[] { "preload-a.wav", "preload-b.wav" });
+        try
+        {
+            Assert.Multiple(() =>
+            {
+                Assert.That(sounds, Has.Count.EqualTo(2));
+                Assert.That(sounds[0].LengthInFrames, Is.EqualTo(2400ul));
+                Assert.That(sounds[1].LengthInFrames, Is.EqualTo(4800ul));
+            });
+        }
+        finally
+        {
+            foreach (var sound in sounds)
+            {
+                sound.Dispose();
+            }
+        }
+    }
+
+    [Test]
+    public void PreloadAsync_MissingFile_Throws()
+    {
+        var options = new MiniaudioEngineOptions
+        {
+            NoDevice = true,
+            SampleRate = 48000,
+            Channels = 2,
+        };
+
+        using var engine = MiniaudioEngine.Create(options);
+        engine.RegisterEncodedData("preload-ok.wav", TestAudio.CreateConstantWav(4096, 2, 48000, 2400));
+        var missing = Path.Combine(Path.GetTempPath(), $"manet-missing-{Guid.NewGuid():N}.wav");
+
+        Assert.CatchAsync<Exception>(async () => await engine.PreloadAsync(new[] { "preload-ok.wav", missing }));
+    }
+
     private static float[] GenerateSineWave(double frequency, int sampleRate, int channels, double durationSeconds)
     {
         var totalFrames = (int)(sampleRate * durationSeconds);
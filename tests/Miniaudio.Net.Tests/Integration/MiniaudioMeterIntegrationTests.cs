@@ -0,0 +1,117 @@
+using NUnit.Framework;
+using Miniaudio.Net;
+using System;
+
+namespace Miniaudio.Net.Tests.Integration;
+
+/// <summary>
+/// エンジン出力メーター(ピーク/RMS/ラウドネス)のインテグレーションテスト。
+/// これらのテストはネイティブライブラリが必要です。
+/// </summary>
+[TestFixture]
+[Category("Integration")]
+public class MiniaudioMeterIntegrationTests
+{
+    private const int SampleRate = (int)TestAudio.SampleRate;
+
+    [Test]
+    public void GetMeterSnapshot_ConstantSignal_ReportsPeakAndRms()
+    {
+        using var engine = TestAudio.CreateEngine(enableMetering: true);
+        using var sound = TestAudio.CreateConstantSound(engine, 0.5f);
+        sound.Start();
+
+        TestAudio.Render(engine, SampleRate / 2);
+        var snapshot = engine.GetMeterSnapshot();
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(snapshot.Channels, Is.EqualTo(2));
+            Assert.That(snapshot.FramesProcessed, Is.GreaterThanOrEqualTo((ulong)(SampleRate * 4 / 10)));
+            Assert.That(snapshot.Peak[0], Is.EqualTo(0.5f).Within(1e-6f));
+            Assert.That(snapshot.Peak[1], Is.EqualTo(0.5f).Within(1e-6f));
+            Assert.That(snapshot.Rms[0], Is.EqualTo(0.5f).Within(1e-4f));
+            Assert.That(snapshot.GetPeakDbfs(1), Is.EqualTo(-6.02f).Within(0.01f));
+        });
+    }
+
+    [Test]
+    public void GetMeterSnapshot_SineAt997Hz_MatchesReferenceLoudness()
+    {
+        // BS.1770 では 997Hz の正弦波は K 特性で減衰しないため、-20dBFS のステレオ正弦波は -20 LUFS になる。
+        const float amplitude = 0.1f;
+        using var engine = TestAudio.CreateEngine(enableMetering: true);
+        using var sound = TestAudio.CreateSound(engine, TestAudio.CreateSineFrames(997f, amplitude, SampleRate * 4));
+        sound.Start();
+
+        TestAudio.Render(engine, SampleRate * 31 / 10);
+        var snapshot = engine.GetMeterSnapshot();
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(snapshot.MomentaryLoudness, Is.EqualTo(-20f).Within(0.1f));
+            Assert.That(snapshot.ShortTermLoudness, Is.EqualTo(-20f).Within(0.1f));
+            Assert.That(snapshot.Peak[0], Is.EqualTo(amplitude).Within(1e-4f));
+            Assert.That(snapshot.Rms[1], Is.EqualTo(amplitude / MathF.Sqrt(2f)).Within(1e-4f));
+        });
+    }
+
+    [Test]
+    public void GetMeterSnapshot_ShortTermWindow_RampsUpFromStart()
+    {
+        using var engine = TestAudio.CreateEngine(enableMetering: true);
+        using var sound = TestAudio.CreateSound(engine, TestAudio.CreateSineFrames(997f, 0.1f, SampleRate * 2));
+        sound.Start();
+
+        TestAudio.Render(engine, SampleRate);
+        var snapshot = engine.GetMeterSnapshot();
+
+        // 3 秒窓のうち 1 秒分しか音がないため、短期ラウドネスは約 10*log10(1/3) dB 低くなる。
+        Assert.Multiple(() =>
+        {
+            Assert.That(snapshot.MomentaryLoudness, Is.EqualTo(-20f).Within(0.1f));
+            Assert.That(snapshot.ShortTermLoudness, Is.EqualTo(-24.77f).Within(0.2f));
+        });
+    }
+
+    [Test]
+    public void GetMeterSnapshot_Silence_ReportsNegativeInfinity()
+    {
+        using var engine = TestAudio.CreateEngine(enableMetering: true);
+
+        var initial = engine.GetMeterSnapshot();
+        TestAudio.Render(engine, SampleRate);
+        var silent = engine.GetMeterSnapshot();
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(initial.FramesProcessed, Is.EqualTo(0UL));
+            Assert.That(silent.FramesProcessed, Is.EqualTo((ulong)SampleRate));
+            Assert.That(float.IsNegativeInfinity(silent.MomentaryLoudness), Is.True);
+            Assert.That(float.IsNegativeInfinity(silent.ShortTermLoudness), Is.True);
+            Assert.That(silent.Peak[0], Is.EqualTo(0f));
+            Assert.That(float.IsNegativeInfinity(silent.GetRmsDbfs(0)), Is.True);
+        });
+    }
+
+    [Test]
+    public void GetMeterSnapshot_MeasuresAfterEngineVolume()
+    {
+        using var engine = TestAudio.CreateEngine(enableMetering: true);
+        using var sound = TestAudio.CreateConstantSound(engine, 0.5f);
+        engine.Volume = 0.5f;
+        sound.Start();
+
+        TestAudio.Render(engine, SampleRate / 2);
+
+        Assert.That(engine.GetMeterSnapshot().Peak[0], Is.EqualTo(0.25f).Within(1e-6f));
+    }
+
+    [Test]
+    public void GetMeterSnapshot_WithoutEnableMetering_Throws()
+    {
+        using var engine = TestAudio.CreateEngine();
+
+        Assert.Throws<InvalidOperationException>(() => engine.GetMeterSnapshot());
+    }
+}
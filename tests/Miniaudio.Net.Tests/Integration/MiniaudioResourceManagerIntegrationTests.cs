@@ -1,6 +1,9 @@
 using NUnit.Framework;
 using Miniaudio.Net;
 using System;
+using System.IO;
+using System.Threading;
+using System.Threading.Tasks;
 
 namespace Miniaudio.Net.Tests.Integration;
 
@@ -55,7 +58,538 @@ public class MiniaudioResourceManagerIntegrationTests
         });
     }
 
+    [Test]
+    public void RegisterDecodedData_SharedAcrossSoundsAndEngines()
+    {
+        using var manager = MiniaudioResourceManager.Create();
+        var frames = new float[4800 * 2];
+        Array.Fill(frames, 0.25f);
+        manager.RegisterDecodedData("shared-clip", frames, 2, 48000);
+
+        var options = new MiniaudioEngineOptions
+        {
+            NoDevice = true,
+            SampleRate = 48000,
+            Channels = 2,
+            ResourceManager = manager,
+        };
+
+        using var engine = MiniaudioEngine.Create(options);
+        using var first = engine.CreateSound("shared-clip", SoundInitFlags.NoSpatialization | SoundInitFlags.NoPitch);
+        using var second = engine.CreateSound("shared-clip", SoundInitFlags.NoSpatialization | SoundInitFlags.NoPitch);
+
+        using var otherEngine = MiniaudioEngine.Create(options);
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(manager.IsDataRegistered("shared-clip"), Is.True);
+            Assert.That(otherEngine.IsDataRegistered("shared-clip"), Is.True);
+        });
+
+        first.Start();
+        second.Start();
+        var output = new float[1024 * 2];
+        engine.Render(output);
+
+        Assert.That(output[512 * 2], Is.EqualTo(0.5f).Within(1e-3f));
+    }
+
+    [Test]
+    public void RegisterDecodedData_DuplicateName_Throws()
+    {
+        using var manager = MiniaudioResourceManager.Create();
+        var frames = new float[64];
+        manager.RegisterDecodedData("dup", frames, 1, 48000);
+
+        Assert.Throws<MiniaudioException>(() => manager.RegisterDecodedData("dup", frames, 1, 48000));
+        Assert.Multiple(() =>
+        {
+            Assert.That(manager.UnregisterData("dup"), Is.True);
+            Assert.That(manager.UnregisterData("dup"), Is.False);
+        });
+    }
+
+    [Test]
+    public void RegisterDecodedData_LengthNotDivisibleByChannels_Throws()
+    {
+        using var manager = MiniaudioResourceManager.Create();
+
+        Assert.Throws<ArgumentException>(() => manager.RegisterDecodedData("odd", new float[3], 2, 48000));
+    }
+
+    [Test]
+    public void Statistics_CountsHitsAndMissesForFileLoads()
+    {
+        using var manager = MiniaudioResourceManager.Create();
+        using var engine = TestAudio.CreateEngine(manager);
+        var path = TestAudio.WriteTempWav(8192, 1, 4800);
+
+        try
+        {
+            using (var first = engine.CreateSound(path, SoundInitFlags.Decode))
+            using (var second = engine.CreateSound(path, SoundInitFlags.Decode))
+            {
+                var stats = manager.Statistics;
+                Assert.Multiple(() =>
+                {
+                    Assert.That(stats.CacheMisses, Is.EqualTo(1ul));
+                    Assert.That(stats.CacheHits, Is.EqualTo(1ul));
+                    Assert.That(stats.LoadedBuffers, Is.EqualTo(1u));
+                    Assert.That(stats.ResidentBytes, Is.EqualTo(4800ul * sizeof(short)));
+                    Assert.That(stats.CachedBuffers, Is.EqualTo(0u));
+                });
+            }
+
+            // 予算が 0 のときはサウンド破棄と同時にバッファが解放される。
+            Assert.That(manager.Statistics.LoadedBuffers, Is.EqualTo(0u));
+
+            manager.ResetStatistics();
+            var reset = manager.Statistics;
+            Assert.Multiple(() =>
+            {
+                Assert.That(reset.CacheHits, Is.EqualTo(0ul));
+                Assert.That(reset.CacheMisses, Is.EqualTo(0ul));
+            });
+        }
+        finally
+        {
+            File.Delete(path);
+        }
+    }
+
+    [Test]
+    public void MemoryBudget_RetainsUnreferencedBuffersAndEvictsLeastRecentlyUsed()
+    {
+        using var manager = MiniaudioResourceManager.Create();
+        using var engine = TestAudio.CreateEngine(manager);
+        const int frames = 4800;
+        const ulong clipBytes = frames * sizeof(short);
+        var first = TestAudio.WriteTempWav(8192, 1, frames);
+        var second = TestAudio.WriteTempWav(8192, 1, frames);
+
+        try
+        {
+            manager.MemoryBudgetInBytes = clipBytes + clipBytes / 2;
+            Assert.That(manager.MemoryBudgetInBytes, Is.EqualTo(clipBytes + clipBytes / 2));
+
+            engine.CreateSound(first, SoundInitFlags.Decode).Dispose();
+
+            var retained = manager.Statistics;
+            Assert.Multiple(() =>
+            {
+                Assert.That(retained.LoadedBuffers, Is.EqualTo(1u));
+                Assert.That(retained.CachedBuffers, Is.EqualTo(1u));
+                Assert.That(retained.CachedBytes, Is.EqualTo(clipBytes));
+            });
+
+            // 再ロードはキャッシュにヒットする。
+            engine.CreateSound(first, SoundInitFlags.Decode).Dispose();
+            Assert.That(manager.Statistics.CacheHits, Is.EqualTo(1ul));
+
+            // 2 つ目のクリップで予算を超えるため、最も古い 1 つ目が追い出される。
+            engine.CreateSound(second, SoundInitFlags.Decode).Dispose();
+
+            var evicted = manager.Statistics;
+            Assert.Multiple(() =>
+            {
+                Assert.That(evicted.Evictions, Is.EqualTo(1ul));
+                Assert.That(evicted.LoadedBuffers, Is.EqualTo(1u));
+                Assert.That(evicted.ResidentBytes, Is.LessThanOrEqualTo(manager.MemoryBudgetInBytes));
+            });
+
+            manager.MemoryBudgetInBytes = 0;
+            Assert.That(manager.Statistics.LoadedBuffers, Is.EqualTo(0u));
+        }
+        finally
+        {
+            File.Delete(first);
+            File.Delete(second);
+        }
+    }
+
+    [Test]
+    public async Task MemoryBudget_EvictsAsyncLoadsOnceFullyDecoded()
+    {
+        using var manager = MiniaudioResourceManager.Create();
+        using var engine = TestAudio.CreateEngine(manager);
+
+        // 非同期読み込みのキャッシュエントリは、デコードが終わる前のサウンド作成時点で登録される。
+        const int frames = 8192 * 3;
+        const ulong clipBytes = frames * sizeof(short);
+        var first = TestAudio.WriteTempWav(8192, 1, frames);
+        var second = TestAudio.WriteTempWav(8192, 1, frames);
+
+        try
+        {
+            manager.MemoryBudgetInBytes = clipBytes + clipBytes / 2;
+
+            (await engine.CreateSoundAsync(first, SoundInitFlags.Decode)).Dispose();
+            Assert.That(manager.Statistics.CachedBytes, Is.EqualTo(clipBytes));
+
+            // デコード完了後のサイズで予算と比較されるため、1 つ目が追い出される。
+            (await engine.CreateSoundAsync(second, SoundInitFlags.Decode)).Dispose();
+
+            var stats = manager.Statistics;
+            Assert.Multiple(() =>
+            {
+                Assert.That(stats.Evictions, Is.EqualTo(1ul));
+                Assert.That(stats.CachedBuffers, Is.EqualTo(1u));
+                Assert.That(stats.ResidentBytes, Is.LessThanOrEqualTo(manager.MemoryBudgetInBytes));
+            });
+        }
+        finally
+        {
+            File.Delete(first);
+            File.Delete(second);
+        }
+    }
+
+    [Test]
+    public void MemoryBudget_DoesNotEvictBuffersInUse()
+    {
+        using var manager = MiniaudioResourceManager.Create();
+        using var engine = TestAudio.CreateEngine(manager);
+        var path = TestAudio.WriteTempWav(8192, 1, 4800);
+
+        try
+        {
+            manager.MemoryBudgetInBytes = 1;
+            using var sound = engine.CreateSound(path, SoundInitFlags.Decode);
+
+            var stats = manager.Statistics;
+            Assert.Multiple(() =>
+            {
+                Assert.That(stats.LoadedBuffers, Is.EqualTo(1u));
+                Assert.That(stats.Evictions, Is.EqualTo(0ul));
+            });
+        }
+        finally
+        {
+            File.Delete(path);
+        }
+    }
+
+    [Test]
+    public void DecodedCache_WritesCacheFileAndMapsItOnNextRun()
+    {
+        var cacheDirectory = Path.Combine(Path.GetTempPath(), $"manet-decoded-{Guid.NewGuid():N}");
+        var path = TestAudio.WriteTempWav(8192, 1, 4800);
+        var options = new MiniaudioResourceManagerOptions { DecodedCacheDirectory = cacheDirectory };
+        const SoundInitFlags flags = SoundInitFlags.Decode | SoundInitFlags.NoSpatialization | SoundInitFlags.NoPitch;
+
+        try
+        {
+            using (var manager = MiniaudioResourceManager.Create(options))
+            using (var engine = TestAudio.CreateEngine(manager))
+            using (var sound = engine.CreateSound(path, flags))
+            {
+                Assert.That(RenderMiddleSample(engine, sound), Is.EqualTo(0.25f).Within(1e-3f));
+            }
+
+            var cacheFiles = Directory.GetFiles(cacheDirectory, "*.pcm");
+            Assert.That(cacheFiles, Has.Count.EqualTo(1));
+
+            // キャッシュのサンプルを書き換え、次回の起動でデコードではなくキャッシュが使われることを確認する。
+            using (var cacheFile = File.OpenWrite(cacheFiles[0]))
+            using (var writer = new BinaryWriter(cacheFile))
+            {
+                cacheFile.Position = 32;
+                for (var i = 0; i < 4800 * 2; i++)
+                {
+                    writer.Write(0.5f);
+                }
+            }
+
+            using (var manager = MiniaudioResourceManager.Create(options))
+            using (var engine = TestAudio.CreateEngine(manager))
+            using (var sound = engine.CreateSound(path, flags))
+            {
+                Assert.That(RenderMiddleSample(engine, sound), Is.EqualTo(0.5f).Within(1e-3f));
+            }
+
+            Assert.That(Directory.GetFiles(cacheDirectory, "*.pcm"), Has.Count.EqualTo(1));
+        }
+        finally
+        {
+            File.Delete(path);
+            Directory.Delete(cacheDirectory, recursive: true);
+        }
+    }
 
+    [Test]
+    public void DecodedCache_StreamedSoundsBypassCache()
+    {
+        var cacheDirectory = Path.Combine(Path.GetTempPath(), $"manet-decoded-{Guid.NewGuid():N}");
+        var path = TestAudio.WriteTempWav(8192, 1, 4800);
+
+        try
+        {
+            using var manager = MiniaudioResourceManager.Create(new MiniaudioResourceManagerOptions { DecodedCacheDirectory = cacheDirectory });
+            using var engine = TestAudio.CreateEngine(manager);
+            using var sound = engine.CreateSound(path, SoundInitFlags.Stream);
+
+            Assert.That(Directory.GetFiles(cacheDirectory, "*.pcm"), Is.Empty);
+        }
+        finally
+        {
+            File.Delete(path);
+            Directory.Delete(cacheDirectory, recursive: true);
+        }
+    }
+
+    [Test]
+    public void DecodedCache_SourceChanged_RehashesContent()
+    {
+        var cacheDirectory = Path.Combine(Path.GetTempPath(), $"manet-decoded-{Guid.NewGuid():N}");
+        var path = TestAudio.WriteTempWav(8192, 1, 4800);
+        var replacement = TestAudio.WriteTempWav(8192, 1, 9600);
+        const SoundInitFlags flags = SoundInitFlags.Decode | SoundInitFlags.NoSpatialization | SoundInitFlags.NoPitch;
+
+        try
+        {
+            using var manager = MiniaudioResourceManager.Create(new MiniaudioResourceManagerOptions { DecodedCacheDirectory = cacheDirectory });
+            using var engine = TestAudio.CreateEngine(manager);
+            engine.CreateSound(path, flags).Dispose();
+
+            // サイズと更新日時が変わったファイルは、記憶済みのハッシュを使わずに読み直す。
+            File.Copy(replacement, path, overwrite: true);
+            engine.CreateSound(path, flags).Dispose();
+
+            Assert.That(Directory.GetFiles(cacheDirectory, "*.pcm"), Has.Count.EqualTo(2));
+        }
+        finally
+        {
+            File.Delete(path);
+            File.Delete(replacement);
+            Directory.Delete(cacheDirectory, recursive: true);
+        }
+    }
+
+    [Test]
+    public void DecodedCache_LastSoundDisposed_ReleasesMapping()
+    {
+        var cacheDirectory = Path.Combine(Path.GetTempPath(), $"manet-decoded-{Guid.NewGuid():N}");
+        var path = TestAudio.WriteTempWav(8192, 1, 4800);
+        const SoundInitFlags flags = SoundInitFlags.Decode | SoundInitFlags.NoSpatialization | SoundInitFlags.NoPitch;
+
+        try
+        {
+            using var manager = MiniaudioResourceManager.Create(new MiniaudioResourceManagerOptions { DecodedCacheDirectory = cacheDirectory });
+            using var engine = TestAudio.CreateEngine(manager);
+            engine.CreateSound(path, flags).Dispose();
+
+            // マッピングが登録に残っていれば、削除したキャッシュファイルは作り直されない。
+            foreach (var cacheFile in Directory.GetFiles(cacheDirectory, "*.pcm"))
+            {
+                File.Delete(cacheFile);
+            }
+
+            using var sound = engine.CreateSound(path, flags);
+
+            Assert.Multiple(() =>
+            {
+                Assert.That(Directory.GetFiles(cacheDirectory, "*.pcm"), Has.Count.EqualTo(1));
+                Assert.That(RenderMiddleSample(engine, sound), Is.EqualTo(0.25f).Within(1e-3f));
+            });
+        }
+        finally
+        {
+            File.Delete(path);
+            Directory.Delete(cacheDirectory, recursive: true);
+        }
+    }
+
+    [Test]
+    public async Task DecodedCache_AsyncLoad_UsesCacheOnlyForSourcesAlreadyHashed()
+    {
+        var cacheDirectory = Path.Combine(Path.GetTempPath(), $"manet-decoded-{Guid.NewGuid():N}");
+        var path = TestAudio.WriteTempWav(8192, 1, 4800);
+        const SoundInitFlags flags = SoundInitFlags.Decode | SoundInitFlags.NoSpatialization | SoundInitFlags.NoPitch;
+
+        try
+        {
+            using var manager = MiniaudioResourceManager.Create(new MiniaudioResourceManagerOptions { DecodedCacheDirectory = cacheDirectory });
+            using var engine = TestAudio.CreateEngine(manager);
+
+            // 未ハッシュのソースは、呼び出し元をブロックしないよう通常の非同期読み込みになる。
+            using (var sound = await engine.CreateSoundAsync(path, flags))
+            {
+                Assert.That(Directory.GetFiles(cacheDirectory, "*.pcm"), Is.Empty);
+            }
+
+            engine.CreateSound(path, flags).Dispose();
+            var cacheFiles = Directory.GetFiles(cacheDirectory, "*.pcm");
+            Assert.That(cacheFiles, Has.Count.EqualTo(1));
+
+            using (var cacheFile = File.OpenWrite(cacheFiles[0]))
+            using (var writer = new BinaryWriter(cacheFile))
+            {
+                cacheFile.Position = 32;
+                for (var i = 0; i < 4800 * 2; i++)
+                {
+                    writer.Write(0.5f);
+                }
+            }
+
+            using (var sound = await engine.CreateSoundAsync(path, flags))
+            {
+                Assert.That(RenderMiddleSample(engine, sound), Is.EqualTo(0.5f).Within(1e-3f));
+            }
+        }
+        finally
+        {
+            File.Delete(path);
+            Directory.Delete(cacheDirectory, recursive: true);
+        }
+    }
+
+    [Test]
+    public async Task DecodedCache_AsyncLoadInNewManager_UsesPersistedKey()
+    {
+        var cacheDirectory = Path.Combine(Path.GetTempPath(), $"manet-decoded-{Guid.NewGuid():N}");
+        var path = TestAudio.WriteTempWav(8192, 1, 4800);
+        const SoundInitFlags flags = SoundInitFlags.Decode | SoundInitFlags.NoSpatialization | SoundInitFlags.NoPitch;
+        var options = new MiniaudioResourceManagerOptions { DecodedCacheDirectory = cacheDirectory };
+
+        try
+        {
+            using (var manager = MiniaudioResourceManager.Create(options))
+            using (var engine = TestAudio.CreateEngine(manager))
+            {
+                engine.CreateSound(path, flags).Dispose();
+            }
+
+            // キャッシュファイルを書き換え、ソースを再デコードせずにキャッシュから読み込まれたことを値で確認する。
+            var cacheFiles = Directory.GetFiles(cacheDirectory, "*.pcm");
+            Assert.That(cacheFiles, Has.Count.EqualTo(1));
+            using (var cacheFile = File.OpenWrite(cacheFiles[0]))
+            using (var writer = new BinaryWriter(cacheFile))
+            {
+                cacheFile.Position = 32;
+                for (var i = 0; i < 4800 * 2; i++)
+                {
+                    writer.Write(0.5f);
+                }
+            }
+
+            // 別プロセスと同じく、新しいリソースマネージャーはメモリ上の記憶を持たない。
+            using (var manager = MiniaudioResourceManager.Create(options))
+            using (var engine = TestAudio.CreateEngine(manager))
+            using (var sound = await engine.CreateSoundAsync(path, flags))
+            {
+                Assert.That(RenderMiddleSample(engine, sound), Is.EqualTo(0.5f).Within(1e-3f));
+            }
+        }
+        finally
+        {
+            File.Delete(path);
+            Directory.Delete(cacheDirectory, recursive: true);
+        }
+    }
+
+    [Test]
+    public async Task JobStatistics_RecordsAsyncDecodeJobs()
+    {
+        using var manager = MiniaudioResourceManager.Create(new MiniaudioResourceManagerOptions { CollectJobStatistics = true });
+        using var engine = TestAudio.CreateEngine(manager);
+        var path = TestAudio.WriteTempWav(8192, 1, 4800);
+
+        try
+        {
+            using var sound = await engine.CreateSoundAsync(path, SoundInitFlags.Decode);
+
+            // 完了通知はジョブ処理中に届くため、計測値の反映を待つ。
+            Assert.That(SpinWait.SpinUntil(() => manager.JobStatistics.Decode.Count > 0, TimeSpan.FromSeconds(5)), Is.True);
+
+            // 初期化はサウンド作成スレッド上で行われ、残りのデコードがページジョブとして投入される。
+            var stats = manager.JobStatistics;
+            Assert.Multiple(() =>
+            {
+                Assert.That(stats.WorkerCount, Is.EqualTo(1u));
+                Assert.That(stats.GetQueuedCount(ResourceManagerJobType.PageDataBufferNode), Is.GreaterThanOrEqualTo(1ul));
+                Assert.That(stats.GetCompletedCount(ResourceManagerJobType.PageDataBufferNode), Is.GreaterThanOrEqualTo(1ul));
+                Assert.That(stats.QueueWait.Count, Is.GreaterThanOrEqualTo(1ul));
+                Assert.That(stats.Decode.Count, Is.EqualTo(1ul));
+                Assert.That(stats.Decode.EstimatePercentile(1.0), Is.EqualTo(stats.Decode.Maximum));
+                Assert.That(RenderMiddleSample(engine, sound), Is.EqualTo(0.25f).Within(1e-3));
+            });
+
+            manager.ResetJobStatistics();
+            var reset = manager.JobStatistics;
+            Assert.Multiple(() =>
+            {
+                Assert.That(reset.GetQueuedCount(ResourceManagerJobType.PageDataBufferNode), Is.EqualTo(0ul));
+                Assert.That(reset.QueueWait.Count, Is.EqualTo(0ul));
+                Assert.That(reset.Decode.Count, Is.EqualTo(0ul));
+                Assert.That(reset.WorkerCount, Is.EqualTo(1u));
+            });
+        }
+        finally
+        {
+            File.Delete(path);
+        }
+    }
+
+    [Test]
+    public void JobStatistics_CountsStreamRefills()
+    {
+        using var manager = MiniaudioResourceManager.Create(new MiniaudioResourceManagerOptions
+        {
+            CollectJobStatistics = true,
+            JobThreadCount = 2,
+        });
+        using var engine = TestAudio.CreateEngine(manager);
+        var path = TestAudio.WriteTempWav(8192, 1, 48000 * 3);
+
+        try
+        {
+            using var sound = engine.CreateSound(path, SoundInitFlags.Stream);
+            sound.Start();
+
+            // ページ(1 秒)を読み切ると次のページの補充ジョブが投入される。
+            var output = new float[4800 * 2];
+            for (var i = 0; i < 12; i++)
+            {
+                engine.Render(output);
+            }
+
+            Assert.That(SpinWait.SpinUntil(() => manager.JobStatistics.StreamRefills > 0, TimeSpan.FromSeconds(5)), Is.True);
+
+            var stats = manager.JobStatistics;
+            Assert.Multiple(() =>
+            {
+                Assert.That(stats.WorkerCount, Is.EqualTo(2u));
+                Assert.That(stats.GetCompletedCount(ResourceManagerJobType.LoadDataStream), Is.EqualTo(1ul));
+                Assert.That(stats.GetQueuedCount(ResourceManagerJobType.PageDataStream), Is.GreaterThanOrEqualTo(1ul));
+                Assert.That(stats.StreamRefillMisses, Is.LessThanOrEqualTo(stats.StreamRefills));
+            });
+        }
+        finally
+        {
+            File.Delete(path);
+        }
+    }
+
+    [Test]
+    public void JobStatistics_NotEnabled_Throws()
+    {
+        using var manager = MiniaudioResourceManager.Create();
+
+        Assert.Throws<InvalidOperationException>(() => _ = manager.JobStatistics);
+        Assert.Throws<InvalidOperationException>(() => manager.ResetJobStatistics());
+    }
+
+    [Test]
+    public void JobStatistics_WithNoThreading_Throws()
+    {
+        var options = new MiniaudioResourceManagerOptions
+        {
+            CollectJobStatistics = true,
+            Flags = ResourceManagerFlags.NoThreading,
+        };
+
+        Assert.Throws<ArgumentException>(() => MiniaudioResourceManager.Create(options));
+    }
 
     [Test]
     public void Options_ReturnsSnapshot()
@@ -70,4 +604,10 @@ public class MiniaudioResourceManagerIntegrationTests
 
         Assert.That(retrievedOptions.DecodedChannels, Is.EqualTo(4u));
     }
+
+    private static float RenderMiddleSample(MiniaudioEngine engine, MiniaudioSound sound)
+    {
+        sound.Start();
+        return TestAudio.RenderMiddleSample(engine);
+    }
 }
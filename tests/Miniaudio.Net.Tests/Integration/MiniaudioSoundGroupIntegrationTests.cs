@@ -0,0 +1,200 @@
+using NUnit.Framework;
+using Miniaudio.Net;
+using System;
+
+namespace Miniaudio.Net.Tests.Integration;
+
+/// <summary>
+/// MiniaudioSoundGroupとノードグラフ接続のインテグレーションテスト。
+/// これらのテストはネイティブライブラリが必要です。
+/// </summary>
+[TestFixture]
+[Category("Integration")]
+public class MiniaudioSoundGroupIntegrationTests
+{
+    [Test]
+    public void Volume_AppliesOnceToMixOfAttachedSounds()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var group = engine.CreateSoundGroup(flags: TestAudio.NodeFlags);
+        using var first = TestAudio.CreateConstantSound(engine, 0.25f);
+        using var second = TestAudio.CreateConstantSound(engine, 0.25f);
+
+        first.AttachOutputBus(group);
+        second.AttachOutputBus(group);
+        group.Volume = 0.5f;
+
+        first.Start();
+        second.Start();
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(group.Volume, Is.EqualTo(0.5f));
+            Assert.That(group.InputBusCount, Is.EqualTo(1u));
+            Assert.That(TestAudio.RenderMiddleSample(engine), Is.EqualTo(0.25f).Within(1e-3f));
+        });
+    }
+
+    [Test]
+    public void Stop_SilencesRoutedSounds()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var group = engine.CreateSoundGroup(flags: TestAudio.NodeFlags);
+        using var sound = TestAudio.CreateConstantSound(engine, 0.25f);
+
+        sound.AttachOutputBus(group);
+        sound.Start();
+        group.Stop();
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(group.IsPlaying, Is.False);
+            Assert.That(TestAudio.RenderMiddleSample(engine), Is.EqualTo(0f).Within(1e-6f));
+        });
+
+        group.Start();
+        Assert.That(TestAudio.RenderMiddleSample(engine), Is.EqualTo(0.25f).Within(1e-3f));
+    }
+
+    [Test]
+    public void CreateSoundGroup_WithParent_AppliesBothVolumes()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var parent = engine.CreateSoundGroup(flags: TestAudio.NodeFlags);
+        using var child = engine.CreateSoundGroup(parent, TestAudio.NodeFlags);
+        using var sound = TestAudio.CreateConstantSound(engine, 0.25f);
+
+        sound.AttachOutputBus(child);
+        parent.Volume = 0.5f;
+        child.Volume = 0.5f;
+        sound.Start();
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(child.Parent, Is.SameAs(parent));
+            Assert.That(TestAudio.RenderMiddleSample(engine), Is.EqualTo(0.0625f).Within(1e-3f));
+        });
+    }
+
+    [Test]
+    public void CreateInstance_PlaysThroughSourceGroup()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var group = engine.CreateSoundGroup(flags: TestAudio.NodeFlags);
+        using var buffer = MiniaudioPcmBuffer.Create(TestAudio.CreateConstantFrames(0.25f), TestAudio.Channels, TestAudio.SampleRate);
+        using var bufferSound = engine.CreateSoundFromPcmBuffer(buffer, TestAudio.NodeFlags);
+        using var assetSound = engine.CreateSound(TestAudio.CreateConstantWav(8192, 2, 48000, 4800), "grouped.wav", SoundInitFlags.Decode | TestAudio.NodeFlags);
+
+        bufferSound.AttachOutputBus(group);
+        assetSound.AttachOutputBus(group);
+        group.Volume = 0.5f;
+
+        // インスタンスはエンドポイントではなく、元のサウンドと同じグループを通る。
+        using var bufferInstance = bufferSound.CreateInstance();
+        using var assetInstance = assetSound.CreateInstance();
+        bufferInstance.Start();
+        assetInstance.Start();
+
+        Assert.That(TestAudio.RenderMiddleSample(engine), Is.EqualTo(0.25f).Within(1e-3f));
+    }
+
+    [Test]
+    public void DetachAllOutputBuses_RemovesSoundFromMix()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var sound = TestAudio.CreateConstantSound(engine, 0.25f);
+        sound.Start();
+
+        sound.DetachAllOutputBuses();
+        Assert.That(TestAudio.RenderMiddleSample(engine), Is.EqualTo(0f).Within(1e-6f));
+
+        sound.AttachOutputBus(engine.Endpoint);
+        Assert.That(TestAudio.RenderMiddleSample(engine), Is.EqualTo(0.25f).Within(1e-3f));
+    }
+
+    [Test]
+    public void SetOutputBusVolume_ScalesOutput()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var sound = TestAudio.CreateConstantSound(engine, 0.25f);
+
+        sound.SetOutputBusVolume(0, 0.5f);
+        sound.Start();
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(sound.GetOutputBusVolume(0), Is.EqualTo(0.5f));
+            Assert.That(TestAudio.RenderMiddleSample(engine), Is.EqualTo(0.125f).Within(1e-3f));
+        });
+    }
+
+    [Test]
+    public void Splitter_FeedsEveryOutputBus()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var splitter = engine.CreateSplitter(2);
+        using var wet = engine.CreateSoundGroup(flags: TestAudio.NodeFlags);
+        using var sound = TestAudio.CreateConstantSound(engine, 0.25f);
+
+        sound.AttachOutputBus(splitter);
+        splitter.AttachOutputBus(0, engine.Endpoint);
+        splitter.AttachOutputBus(1, wet);
+        wet.Volume = 0.5f;
+        sound.Start();
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(splitter.OutputBusCount, Is.EqualTo(2u));
+            Assert.That(splitter.Channels, Is.EqualTo(2u));
+            Assert.That(TestAudio.RenderMiddleSample(engine), Is.EqualTo(0.375f).Within(1e-3f));
+        });
+    }
+
+    [Test]
+    public void VoicePool_AttachOutputTo_RoutesEveryVoice()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var group = engine.CreateSoundGroup(flags: TestAudio.NodeFlags);
+        using var pool = engine.CreateVoicePool(2, 2, 48000, VoiceStealPolicy.Oldest, TestAudio.NodeFlags);
+        using var clip = MiniaudioPcmBuffer.Create(TestAudio.CreateConstantFrames(0.25f), 2, 48000);
+
+        pool.AttachOutputTo(group);
+        group.Volume = 0.5f;
+        pool.TryPlay(clip);
+        pool.TryPlay(clip);
+
+        Assert.That(TestAudio.RenderMiddleSample(engine), Is.EqualTo(0.25f).Within(1e-3f));
+    }
+
+    [Test]
+    public void AttachOutputBus_InvalidTargets_Throw()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var otherEngine = TestAudio.CreateEngine();
+        using var sound = TestAudio.CreateConstantSound(engine, 0.25f);
+        using var foreignGroup = otherEngine.CreateSoundGroup();
+        using var group = engine.CreateSoundGroup();
+
+        Assert.Throws<ArgumentException>(() => sound.AttachOutputBus(foreignGroup));
+        Assert.Throws<MiniaudioException>(() => sound.AttachOutputBus(3, group));
+    }
+
+    [Test]
+    public void Dispose_GroupWithAttachedSounds_LeavesSoundsDetached()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var sound = TestAudio.CreateConstantSound(engine, 0.25f);
+        var group = engine.CreateSoundGroup(flags: TestAudio.NodeFlags);
+
+        sound.AttachOutputBus(group);
+        sound.Start();
+        group.Dispose();
+        group.Dispose();
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(TestAudio.RenderMiddleSample(engine), Is.EqualTo(0f).Within(1e-6f));
+            Assert.Throws<ObjectDisposedException>(() => sound.AttachOutputBus(group));
+        });
+    }
+}
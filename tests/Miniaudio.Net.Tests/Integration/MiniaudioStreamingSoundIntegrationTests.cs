@@ -0,0 +1,386 @@
+using NUnit.Framework;
+using Miniaudio.Net;
+using System;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace Miniaudio.Net.Tests.Integration;
+
+/// <summary>
+/// MiniaudioStreamingSoundのインテグレーションテスト。
+/// これらのテストはネイティブライブラリが必要です。
+/// </summary>
+[TestFixture]
+[Category("Integration")]
+public class MiniaudioStreamingSoundIntegrationTests
+{
+    private MiniaudioEngine _engine = null!;
+
+    [SetUp]
+    public void SetUp()
+    {
+        var options = new MiniaudioEngineOptions
+        {
+            NoDevice = true,
+            SampleRate = 48000,
+            Channels = 2,
+        };
+        _engine = MiniaudioEngine.Create(options);
+    }
+
+    [TearDown]
+    public void TearDown()
+    {
+        _engine?.Dispose();
+    }
+
+    [Test]
+    public void AppendPcmFrames_S16Input_ConvertsToFloat()
+    {
+        using var stream = _engine.CreateStreamingSound(2, 48000, MiniaudioSampleFormat.S16, 1024, SoundInitFlags.NoSpatialization | SoundInitFlags.NoPitch);
+        var samples = new short[256 * 2];
+        Array.Fill(samples, (short)16384);
+
+        var written = stream.AppendPcmFrames(samples);
+        stream.Start();
+        var output = new float[256 * 2];
+        _engine.Render(output);
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(stream.InputFormat, Is.EqualTo(MiniaudioSampleFormat.S16));
+            Assert.That(written, Is.EqualTo(256UL));
+            Assert.That(output[128], Is.EqualTo(0.5f).Within(1e-3f));
+            Assert.That(output[^1], Is.EqualTo(0.5f).Within(1e-3f));
+        });
+    }
+
+    [Test]
+    public void AppendRawPcmFrames_S24Input_ConvertsPackedSamples()
+    {
+        using var stream = _engine.CreateStreamingSound(2, 48000, MiniaudioSampleFormat.S24, 1024, SoundInitFlags.NoSpatialization | SoundInitFlags.NoPitch);
+        var bytes = new byte[128 * 2 * 3];
+        for (var i = 0; i < bytes.Length; i += 3)
+        {
+            // -0.25 (0xE00000) として little-endian で格納
+            bytes[i] = 0x00;
+            bytes[i + 1] = 0x00;
+            bytes[i + 2] = 0xE0;
+        }
+
+        var written = stream.AppendRawPcmFrames(bytes);
+        stream.Start();
+        var output = new float[128 * 2];
+        _engine.Render(output);
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(written, Is.EqualTo(128UL));
+            Assert.That(output[128], Is.EqualTo(-0.25f).Within(1e-3f));
+        });
+    }
+
+    [Test]
+    public void AppendRawPcmFrames_PartialFrame_Throws()
+    {
+        using var stream = _engine.CreateStreamingSound(2, 48000, MiniaudioSampleFormat.S16, 1024);
+
+        Assert.Throws<ArgumentException>(() => stream.AppendRawPcmFrames(new byte[6]));
+    }
+
+    [Test]
+    public void AppendPcmFrames_S16IntoFloatStream_Throws()
+    {
+        using var stream = _engine.CreateStreamingSound(2, 48000, 1024);
+
+        Assert.Throws<InvalidOperationException>(() => stream.AppendPcmFrames(new short[4]));
+    }
+
+    [Test]
+    public void AppendPlanarPcmFrames_InterleavesChannels()
+    {
+        using var stream = _engine.CreateStreamingSound(2, 48000, 1024, SoundInitFlags.NoSpatialization | SoundInitFlags.NoPitch);
+        var left = new float[256];
+        var right = new float[256];
+        Array.Fill(left, 0.5f);
+        Array.Fill(right, -0.25f);
+
+        var written = stream.AppendPlanarPcmFrames(new ReadOnlyMemory<float>[] { left, right });
+        stream.Start();
+        var output = new float[256 * 2];
+        _engine.Render(output);
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(written, Is.EqualTo(256UL));
+            Assert.That(output[128 * 2], Is.EqualTo(0.5f).Within(1e-4f));
+            Assert.That(output[128 * 2 + 1], Is.EqualTo(-0.25f).Within(1e-4f));
+        });
+    }
+
+    [Test]
+    public void AppendPlanarPcmFrames_MismatchedPlanes_Throws()
+    {
+        using var stream = _engine.CreateStreamingSound(2, 48000, 1024);
+
+        Assert.Multiple(() =>
+        {
+            Assert.Throws<ArgumentException>(() => stream.AppendPlanarPcmFrames(new ReadOnlyMemory<float>[] { new float[16] }));
+            Assert.Throws<ArgumentException>(() => stream.AppendPlanarPcmFrames(new ReadOnlyMemory<float>[] { new float[16], new float[8] }));
+        });
+    }
+
+    [Test]
+    public void AcquireWrite_ThenCommitWrite_QueuesFrames()
+    {
+        using var stream = _engine.CreateStreamingSound(2, 48000, 1024);
+
+        var span = stream.AcquireWrite(256);
+        var mappedSamples = span.Length;
+        span.Fill(0.25f);
+        stream.CommitWrite(256);
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(mappedSamples, Is.EqualTo(512));
+            Assert.That(stream.QueuedFrames, Is.EqualTo(256UL));
+            Assert.That(stream.AvailableFramesToWrite, Is.EqualTo(768UL));
+        });
+    }
+
+    [Test]
+    public void AcquireWrite_MoreThanCapacity_ReturnsMappedRegionOnly()
+    {
+        using var stream = _engine.CreateStreamingSound(2, 48000, 1024);
+
+        var span = stream.AcquireWrite(4096);
+
+        Assert.That(span.Length, Is.EqualTo(1024 * 2));
+    }
+
+    [Test]
+    public void CommitWrite_MoreThanAcquired_Throws()
+    {
+        using var stream = _engine.CreateStreamingSound(2, 48000, 1024);
+
+        stream.AcquireWrite(64);
+
+        Assert.Throws<MiniaudioException>(() => stream.CommitWrite(128));
+    }
+
+    [Test]
+    public void AcquireWrite_AfterEndOfStream_Throws()
+    {
+        using var stream = _engine.CreateStreamingSound(2, 48000, 1024);
+        stream.SignalEndOfStream();
+
+        Assert.Throws<MiniaudioException>(() => stream.AcquireWrite(64));
+    }
+
+    [Test]
+    public void LowWatermark_DrainedBelowThreshold_SignalsWaitHandle()
+    {
+        using var stream = _engine.CreateStreamingSound(2, 48000, 4800);
+        stream.LowWatermarkInFrames = 1000;
+        stream.AppendPcmFrames(new float[2000 * 2]);
+        stream.Start();
+
+        Assert.That(stream.LowWatermarkWaitHandle.WaitOne(0), Is.False);
+
+        _engine.Render(new float[1200 * 2]);
+
+        Assert.That(stream.LowWatermarkWaitHandle.WaitOne(TimeSpan.FromSeconds(1)), Is.True);
+    }
+
+    [Test]
+    public async Task WaitForLowWatermarkAsync_CompletesAfterDrain()
+    {
+        using var stream = _engine.CreateStreamingSound(2, 48000, 4800);
+        stream.LowWatermarkInFrames = 1000;
+        stream.AppendPcmFrames(new float[2000 * 2]);
+        stream.Start();
+
+        var wait = stream.WaitForLowWatermarkAsync().AsTask();
+        Assert.That(wait.IsCompleted, Is.False);
+
+        _engine.Render(new float[1200 * 2]);
+
+        var completed = await Task.WhenAny(wait, Task.Delay(TimeSpan.FromSeconds(5)));
+        Assert.That(completed, Is.SameAs(wait));
+    }
+
+    [Test]
+    public void Dispose_WhileWaitingForLowWatermark_FaultsWaiter()
+    {
+        var stream = _engine.CreateStreamingSound(2, 48000, 4800);
+        stream.LowWatermarkInFrames = 1000;
+        stream.AppendPcmFrames(new float[2000 * 2]);
+
+        var wait = stream.WaitForLowWatermarkAsync().AsTask();
+
+        // 通知スレッドを閉じてから破棄するため、Dispose はブロックせずに待機中のタスクを失敗させる。
+        stream.Dispose();
+
+        Assert.ThrowsAsync<ObjectDisposedException>(async () => await wait);
+    }
+
+    [Test]
+    public void WaitForLowWatermarkAsync_AlreadyBelowThreshold_CompletesImmediately()
+    {
+        using var stream = _engine.CreateStreamingSound(2, 48000, 4800);
+        stream.LowWatermarkInFrames = 1000;
+
+        Assert.That(stream.WaitForLowWatermarkAsync().IsCompleted, Is.True);
+    }
+
+    [Test]
+    public void WaitForLowWatermarkAsync_WithoutWatermark_Throws()
+    {
+        using var stream = _engine.CreateStreamingSound(2, 48000, 4800);
+
+        Assert.Throws<InvalidOperationException>(() => stream.WaitForLowWatermarkAsync());
+    }
+
+    [Test]
+    public void LowWatermarkInFrames_ExceedsCapacity_Throws()
+    {
+        using var stream = _engine.CreateStreamingSound(2, 48000, 4800);
+
+        Assert.Throws<ArgumentOutOfRangeException>(() => stream.LowWatermarkInFrames = 4801);
+    }
+
+    [Test]
+    public void Statistics_RenderPastQueuedData_CountsUnderrunAndSilence()
+    {
+        using var stream = _engine.CreateStreamingSound(2, 48000, 4800);
+        stream.AppendPcmFrames(new float[1000 * 2]);
+        stream.Start();
+
+        _engine.Render(new float[1200 * 2]);
+
+        var stats = stream.Statistics;
+        Assert.Multiple(() =>
+        {
+            Assert.That(stats.FramesWritten, Is.EqualTo(1000UL));
+            Assert.That(stats.FramesRead, Is.EqualTo(1000UL));
+            Assert.That(stats.UnderrunCount, Is.GreaterThan(0UL));
+            Assert.That(stats.SilenceFramesInserted, Is.EqualTo(200UL));
+            Assert.That(stats.MaxQueuedFrames, Is.EqualTo(1000UL));
+            Assert.That(stats.MinQueuedFrames, Is.EqualTo(0UL));
+        });
+    }
+
+    [Test]
+    public void Statistics_EndOfStream_IsNotCountedAsUnderrun()
+    {
+        using var stream = _engine.CreateStreamingSound(2, 48000, 4800);
+        stream.AppendPcmFrames(new float[1000 * 2]);
+        stream.SignalEndOfStream();
+        stream.Start();
+
+        _engine.Render(new float[1200 * 2]);
+
+        Assert.That(stream.Statistics.UnderrunCount, Is.EqualTo(0UL));
+    }
+
+    [Test]
+    public void ResetStatistics_ClearsCountersAndRebasesQueueLevels()
+    {
+        using var stream = _engine.CreateStreamingSound(2, 48000, 4800);
+        stream.Start();
+        _engine.Render(new float[256 * 2]);
+        stream.AppendPcmFrames(new float[500 * 2]);
+
+        stream.ResetStatistics();
+
+        var stats = stream.Statistics;
+        Assert.Multiple(() =>
+        {
+            Assert.That(stats.UnderrunCount, Is.EqualTo(0UL));
+            Assert.That(stats.SilenceFramesInserted, Is.EqualTo(0UL));
+            Assert.That(stats.FramesRead, Is.EqualTo(0UL));
+            Assert.That(stats.FramesWritten, Is.EqualTo(0UL));
+            Assert.That(stats.MinQueuedFrames, Is.EqualTo(500UL));
+            Assert.That(stats.MaxQueuedFrames, Is.EqualTo(500UL));
+        });
+    }
+
+    [Test]
+    public void AppendPcmFramesAsync_FitsInBuffer_CompletesSynchronously()
+    {
+        using var stream = _engine.CreateStreamingSound(2, 48000, 1024);
+
+        var task = stream.AppendPcmFramesAsync(new float[512 * 2]);
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(task.IsCompletedSuccessfully, Is.True);
+            Assert.That(stream.QueuedFrames, Is.EqualTo(512UL));
+        });
+    }
+
+    [Test]
+    public async Task AppendPcmFramesAsync_LargerThanCapacity_CompletesAsAudioThreadDrains()
+    {
+        using var stream = _engine.CreateStreamingSound(2, 48000, 1024);
+        stream.Start();
+
+        var append = stream.AppendPcmFramesAsync(new float[3000 * 2]).AsTask();
+        Assert.That(append.IsCompleted, Is.False);
+
+        var block = new float[256 * 2];
+        for (var i = 0; i < 64 && !append.IsCompleted; i++)
+        {
+            _engine.Render(block);
+            await Task.Delay(1);
+        }
+
+        var completed = await Task.WhenAny(append, Task.Delay(TimeSpan.FromSeconds(5)));
+        Assert.That(completed, Is.SameAs(append));
+        await append;
+    }
+
+    [Test]
+    public void AppendPcmFramesAsync_Cancelled_Throws()
+    {
+        using var stream = _engine.CreateStreamingSound(2, 48000, 1024);
+        using var cts = new CancellationTokenSource();
+
+        var append = stream.AppendPcmFramesAsync(new float[2048 * 2], cts.Token).AsTask();
+        cts.Cancel();
+
+        Assert.CatchAsync<OperationCanceledException>(async () => await append);
+    }
+
+    [Test]
+    public async Task AppendPcmFramesAsync_CancelledWhileWaiting_NextCallWaitsForAudioThreadAgain()
+    {
+        using var stream = _engine.CreateStreamingSound(2, 48000, 1024);
+        using var cts = new CancellationTokenSource();
+
+        // 停止中のストリームでは書き込み領域が空かないため、待機中にキャンセルする。
+        var cancelled = stream.AppendPcmFramesAsync(new float[2048 * 2], cts.Token).AsTask();
+        await Task.Delay(20);
+        Assert.That(cancelled.IsCompleted, Is.False);
+
+        cts.Cancel();
+        Assert.CatchAsync<OperationCanceledException>(async () => await cancelled);
+
+        // 次の呼び出しもバッファが空くまで待機し、オーディオスレッドの読み出しで完了する。
+        stream.ResetBuffer();
+        stream.Start();
+        var append = stream.AppendPcmFramesAsync(new float[3000 * 2]).AsTask();
+        Assert.That(append.IsCompleted, Is.False);
+
+        var block = new float[256 * 2];
+        for (var i = 0; i < 64 && !append.IsCompleted; i++)
+        {
+            _engine.Render(block);
+            await Task.Delay(1);
+        }
+
+        var completed = await Task.WhenAny(append, Task.Delay(TimeSpan.FromSeconds(5)));
+        Assert.That(completed, Is.SameAs(append));
+        Assert.That(stream.Statistics.FramesWritten, Is.EqualTo(1024UL + 3000UL));
+    }
+}
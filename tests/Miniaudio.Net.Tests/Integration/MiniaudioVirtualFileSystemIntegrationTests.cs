@@ -0,0 +1,84 @@
+using NUnit.Framework;
+using Miniaudio.Net;
+using System;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.IO;
+using System.IO.Compression;
+
+namespace Miniaudio.Net.Tests.Integration;
+
+/// <summary>
+/// MiniaudioVirtualFileSystemのインテグレーションテスト。
+/// これらのテストはネイティブライブラリが必要です。
+/// </summary>
+[TestFixture]
+[Category("Integration")]
+public class MiniaudioVirtualFileSystemIntegrationTests
+{
+    [Test]
+    public void CreateSound_ReadsThroughVirtualFileSystem()
+    {
+        var files = new Dictionary<string, byte[]>
+        {
+            ["sfx/tone.wav"] = TestAudio.CreateConstantWav(8192, 2, 48000, 4800),
+        };
+        var opened = new ConcurrentQueue<string>();
+        var fileSystem = MiniaudioVirtualFileSystem.FromDelegate(path =>
+        {
+            opened.Enqueue(path);
+            return files.TryGetValue(path, out var data) ? new MemoryStream(data, writable: false) : null;
+        });
+
+        using var manager = MiniaudioResourceManager.Create(new MiniaudioResourceManagerOptions { VirtualFileSystem = fileSystem });
+        using var engine = TestAudio.CreateEngine(manager);
+        using var sound = engine.CreateSound("sfx/tone.wav", SoundInitFlags.Decode | SoundInitFlags.NoSpatialization | SoundInitFlags.NoPitch);
+
+        sound.Start();
+        var output = new float[1024 * 2];
+        engine.Render(output);
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(opened, Does.Contain("sfx/tone.wav"));
+            Assert.That(output[512 * 2], Is.EqualTo(0.25f).Within(1e-3f));
+            Assert.That(manager.Options.VirtualFileSystem, Is.SameAs(fileSystem));
+        });
+    }
+
+    [Test]
+    public void CreateSound_MissingVirtualFile_Throws()
+    {
+        var fileSystem = MiniaudioVirtualFileSystem.FromDelegate(_ => null);
+
+        using var manager = MiniaudioResourceManager.Create(new MiniaudioResourceManagerOptions { VirtualFileSystem = fileSystem });
+        using var engine = TestAudio.CreateEngine(manager);
+
+        Assert.Throws<InvalidOperationException>(() => engine.CreateSound("missing.wav", SoundInitFlags.Decode));
+    }
+
+    [Test]
+    public void CreateSound_NonSeekableStream_IsBuffered()
+    {
+        using var archiveData = new MemoryStream();
+        using (var archive = new ZipArchive(archiveData, ZipArchiveMode.Create, leaveOpen: true))
+        {
+            using var entry = archive.CreateEntry("bgm/loop.wav").Open();
+            entry.Write(TestAudio.CreateConstantWav(8192, 2, 48000, 4800));
+        }
+
+        archiveData.Position = 0;
+        using var reader = new ZipArchive(archiveData, ZipArchiveMode.Read);
+        var fileSystem = MiniaudioVirtualFileSystem.FromDelegate(path => reader.GetEntry(path)?.Open());
+
+        using var manager = MiniaudioResourceManager.Create(new MiniaudioResourceManagerOptions { VirtualFileSystem = fileSystem });
+        using var engine = TestAudio.CreateEngine(manager);
+        using var sound = engine.CreateSound("bgm/loop.wav", SoundInitFlags.Stream | SoundInitFlags.NoSpatialization | SoundInitFlags.NoPitch);
+
+        sound.Start();
+        var output = new float[1024 * 2];
+        engine.Render(output);
+
+        Assert.That(output[512 * 2], Is.EqualTo(0.25f).Within(1e-3f));
+    }
+}
@@ -0,0 +1,140 @@
+using NUnit.Framework;
+using Miniaudio.Net;
+using System;
+
+namespace Miniaudio.Net.Tests.Integration;
+
+/// <summary>
+/// MiniaudioVoicePoolのインテグレーションテスト。
+/// これらのテストはネイティブライブラリが必要です。
+/// </summary>
+[TestFixture]
+[Category("Integration")]
+public class MiniaudioVoicePoolIntegrationTests
+{
+    [Test]
+    public void TryPlay_MultipleVoices_MixesClips()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var clip = CreateConstantClip(0.25f, 4800);
+        using var pool = engine.CreateVoicePool(4, 2, 48000, VoiceStealPolicy.Oldest, TestAudio.NodeFlags);
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(pool.TryPlay(clip), Is.True);
+            Assert.That(pool.TryPlay(clip), Is.True);
+        });
+
+        var output = new float[1024 * 2];
+        engine.Render(output);
+
+        var stats = pool.Statistics;
+        Assert.Multiple(() =>
+        {
+            Assert.That(output[512 * 2], Is.EqualTo(0.5f).Within(1e-3f));
+            Assert.That(stats.Capacity, Is.EqualTo(4u));
+            Assert.That(stats.ActiveVoices, Is.EqualTo(2u));
+            Assert.That(stats.PlayCount, Is.EqualTo(2ul));
+        });
+    }
+
+    [Test]
+    public void TryPlay_PoolFullWithoutStealing_ReturnsFalse()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var clip = CreateConstantClip(0.25f, 4800);
+        using var pool = engine.CreateVoicePool(1, 2, 48000, VoiceStealPolicy.None, TestAudio.NodeFlags);
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(pool.TryPlay(clip), Is.True);
+            Assert.That(pool.TryPlay(clip), Is.False);
+            Assert.That(pool.Statistics.RejectCount, Is.EqualTo(1ul));
+        });
+    }
+
+    [Test]
+    public void TryPlay_PoolFull_StealsOldestVoice()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var first = CreateConstantClip(0.25f, 4800);
+        using var second = CreateConstantClip(-0.5f, 4800);
+        using var pool = engine.CreateVoicePool(1, 2, 48000, VoiceStealPolicy.Oldest, TestAudio.NodeFlags);
+
+        pool.TryPlay(first);
+        Assert.That(pool.TryPlay(second), Is.True);
+
+        var output = new float[1024 * 2];
+        engine.Render(output);
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(output[512 * 2], Is.EqualTo(-0.5f).Within(1e-3f));
+            Assert.That(pool.Statistics.StealCount, Is.EqualTo(1ul));
+        });
+    }
+
+    [Test]
+    public void TryPlay_PoolFull_StealsQuietestVoice()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var clip = CreateConstantClip(0.5f, 4800);
+        using var pool = engine.CreateVoicePool(2, 2, 48000, VoiceStealPolicy.Quietest, TestAudio.NodeFlags);
+
+        pool.TryPlay(clip, volume: 1f);
+        pool.TryPlay(clip, volume: 0.1f);
+        pool.TryPlay(clip, volume: 0.5f);
+
+        var output = new float[1024 * 2];
+        engine.Render(output);
+
+        // 0.1 の音量のボイスが奪われ、1.0 + 0.5 の 2 ボイスが残る。
+        Assert.That(output[512 * 2], Is.EqualTo(0.75f).Within(1e-3f));
+    }
+
+    [Test]
+    public void TryPlay_AfterClipEnds_ReusesVoice()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var clip = CreateConstantClip(0.25f, 256);
+        using var pool = engine.CreateVoicePool(1, 2, 48000, VoiceStealPolicy.None, TestAudio.NodeFlags);
+
+        pool.TryPlay(clip);
+        engine.Render(new float[1024 * 2]);
+
+        Assert.Multiple(() =>
+        {
+            Assert.That(pool.Statistics.ActiveVoices, Is.EqualTo(0u));
+            Assert.That(pool.TryPlay(clip), Is.True);
+            Assert.That(pool.Statistics.StealCount, Is.EqualTo(0ul));
+        });
+    }
+
+    [Test]
+    public void TryPlay_ClipFormatMismatch_Throws()
+    {
+        using var engine = TestAudio.CreateEngine();
+        using var clip = MiniaudioPcmBuffer.Create(new float[480], 1, 48000);
+        using var pool = engine.CreateVoicePool(2, 2, 48000);
+
+        Assert.Throws<ArgumentException>(() => pool.TryPlay(clip));
+    }
+
+    [Test]
+    public void Dispose_CanBeCalledMultipleTimes()
+    {
+        using var engine = TestAudio.CreateEngine();
+        var pool = engine.CreateVoicePool(2, 2, 48000);
+
+        Assert.DoesNotThrow(() =>
+        {
+            pool.Dispose();
+            pool.Dispose();
+        });
+    }
+
+    private static MiniaudioPcmBuffer CreateConstantClip(float value, int frames)
+    {
+        return MiniaudioPcmBuffer.Create(TestAudio.CreateConstantFrames(value, frames), TestAudio.Channels, TestAudio.SampleRate);
+    }
+}
@@ -0,0 +1,123 @@
+using Miniaudio.Net;
+using System;
+using System.IO;
+using System.Text;
+
+namespace Miniaudio.Net.Tests.Integration;
+
+/// <summary>
+/// インテグレーションテスト共通のヘルパー。
+/// デバイスなしのエンジン(48kHz / 2ch)の作成、WAV データの生成、テスト信号の生成、オフラインレンダリングを提供します。
+/// </summary>
+internal static class TestAudio
+{
+    public const uint SampleRate = 48000;
+    public const uint Channels = 2;
+    public const SoundInitFlags NodeFlags = SoundInitFlags.NoSpatialization | SoundInitFlags.NoPitch;
+
+    private const int RenderBlockFrames = 1024;
+
+    public static MiniaudioEngine CreateEngine(MiniaudioResourceManager? resourceManager = null, bool enableMetering = false)
+    {
+        return MiniaudioEngine.Create(new MiniaudioEngineOptions
+        {
+            NoDevice = true,
+            SampleRate = SampleRate,
+            Channels = Channels,
+            ResourceManager = resourceManager,
+            EnableMetering = enableMetering,
+        });
+    }
+
+    public static byte[] CreateConstantWav(short sample, int channels, int sampleRate, int frames)
+    {
+        using var stream = new MemoryStream();
+        using var writer = new BinaryWriter(stream, Encoding.ASCII);
+        var dataSize = frames * channels * sizeof(short);
+
+        writer.Write(Encoding.ASCII.GetBytes("RIFF"));
+        writer.Write(36 + dataSize);
+        writer.Write(Encoding.ASCII.GetBytes("WAVE"));
+        writer.Write(Encoding.ASCII.GetBytes("fmt "));
+        writer.Write(16);
+        writer.Write((short)1);
+        writer.Write((short)channels);
+        writer.Write(sampleRate);
+        writer.Write(sampleRate * channels * sizeof(short));
+        writer.Write((short)(channels * sizeof(short)));
+        writer.Write((short)16);
+        writer.Write(Encoding.ASCII.GetBytes("data"));
+        writer.Write(dataSize);
+        for (var i = 0; i < frames * channels; i++)
+        {
+            writer.Write(sample);
+        }
+
+        writer.Flush();
+        return stream.ToArray();
+    }
+
+    // 一時ディレクトリに書き出したファイルのパスを返す。削除は呼び出し側で行う。
+    public static string WriteTempWav(short sample, int channels, int frames)
+    {
+        var path = Path.Combine(Path.GetTempPath(), $"manet-test-{Guid.NewGuid():N}.wav");
+        File.WriteAllBytes(path, CreateConstantWav(sample, channels, (int)SampleRate, frames));
+        return path;
+    }
+
+    public static float[] CreateFrames(Func<int, float> generator, int frameCount)
+    {
+        return CreateFrames(generator, generator, frameCount);
+    }
+
+    public static float[] CreateFrames(Func<int, float> left, Func<int, float> right, int frameCount)
+    {
+        var samples = new float[frameCount * Channels];
+        for (var frame = 0; frame < frameCount; frame++)
+        {
+            samples[frame * Channels] = left(frame);
+            samples[frame * Channels + 1] = right(frame);
+        }
+
+        return samples;
+    }
+
+    public static float[] CreateConstantFrames(float value, int frameCount = (int)SampleRate)
+    {
+        var samples = new float[frameCount * Channels];
+        Array.Fill(samples, value);
+        return samples;
+    }
+
+    public static float[] CreateSineFrames(float frequency, float amplitude, int frameCount)
+    {
+        return CreateFrames(frame => amplitude * MathF.Sin(2f * MathF.PI * frequency * frame / SampleRate), frameCount);
+    }
+
+    public static MiniaudioSound CreateSound(MiniaudioEngine engine, float[] samples)
+    {
+        return engine.CreateSoundFromPcmFrames(samples, Channels, SampleRate, NodeFlags);
+    }
+
+    public static MiniaudioSound CreateConstantSound(MiniaudioEngine engine, float value)
+    {
+        return CreateSound(engine, CreateConstantFrames(value));
+    }
+
+    public static float[] Render(MiniaudioEngine engine, int frameCount)
+    {
+        var output = new float[frameCount * Channels];
+        for (var rendered = 0; rendered < frameCount; rendered += RenderBlockFrames)
+        {
+            var frames = Math.Min(RenderBlockFrames, frameCount - rendered);
+            engine.Render(output.AsSpan(rendered * (int)Channels, frames * (int)Channels));
+        }
+
+        return output;
+    }
+
+    public static float RenderMiddleSample(MiniaudioEngine engine)
+    {
+        return Render(engine, RenderBlockFrames)[RenderBlockFrames / 2 * Channels];
+    }
+}